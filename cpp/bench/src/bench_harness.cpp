@@ -0,0 +1,219 @@
+/************************/
+/*  bench_harness.cpp   */
+/*    Version 1.0       */
+/*     2026/10/19       */
+/************************/
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <ctime>
+#include <fstream>
+#include <iostream>
+#include <map>
+#include <numeric>
+#include <sstream>
+#include <stdexcept>
+#include "bench_harness.h"
+
+#ifdef __VERSION__
+#define BENCH_COMPILER __VERSION__
+#else
+#define BENCH_COMPILER "unknown"
+#endif
+
+namespace bench
+{
+    namespace
+    {
+        using Clock = std::chrono::steady_clock;
+
+        inline double ElapsedNs(const Clock::time_point& t0)
+        {
+            return std::chrono::duration<double, std::nano>(Clock::now() - t0).count();
+        }
+
+        void Statistics(Result& r)
+        {
+            std::vector<double> s_ = r.samples;
+            std::sort(s_.begin(), s_.end());
+            const size_t k = s_.size();
+            r.median       = (k % 2) ? s_[k / 2] : 0.5 * (s_[k / 2 - 1] + s_[k / 2]);
+            r.min          = s_.front();
+            r.mean         = std::accumulate(s_.begin(), s_.end(), 0.) / static_cast<double>(k);
+            double v_      = 0;
+            for (const double& x : s_) v_ += (x - r.mean) * (x - r.mean);
+            r.stddev = k > 1 ? std::sqrt(v_ / static_cast<double>(k - 1)) : 0;
+        }
+
+        // value following "key": on a line written by WriteJson
+        size_t FindKey(const std::string& line, const std::string& key)
+        {
+            const std::string k_ = "\"" + key + "\":";
+            const size_t pos     = line.find(k_);
+            if (pos == std::string::npos) throw std::runtime_error("ReadJson: missing key " + key);
+            return line.find_first_not_of(' ', pos + k_.size());
+        }
+
+        std::string ReadString(const std::string& line, const std::string& key)
+        {
+            const size_t b = FindKey(line, key) + 1;
+            return line.substr(b, line.find('"', b) - b);
+        }
+
+        double ReadNumber(const std::string& line, const std::string& key)
+        {
+            return std::stod(line.substr(FindKey(line, key)));
+        }
+
+        std::vector<double> ReadArray(const std::string& line, const std::string& key)
+        {
+            const size_t b = FindKey(line, key) + 1;
+            std::stringstream ss(line.substr(b, line.find(']', b) - b));
+            std::vector<double> res_;
+            std::string item;
+            while (std::getline(ss, item, ','))
+                if (item.find_first_not_of(' ') != std::string::npos) res_.push_back(std::stod(item));
+            return res_;
+        }
+    } // namespace
+
+    void Runner::Run(const std::string& name, const std::string& type, const size_t& n, const double& flops,
+                     const double& bytes, const std::function<void()>& fn)
+    {
+        if (!opt_.filter.empty() && name.find(opt_.filter) == std::string::npos) return;
+        Result r;
+        r.name  = name;
+        r.type  = type;
+        r.n     = n;
+        r.flops = flops;
+        r.bytes = bytes;
+        // warm up and calibrate the number of calls per sample
+        Clock::time_point t0 = Clock::now();
+        fn();
+        const double t1 = std::max(ElapsedNs(t0), 1.);
+        r.reps          = std::max(size_t(1), static_cast<size_t>(std::ceil(opt_.minTime * 1e9 / t1)));
+        r.samples.reserve(opt_.samples);
+        for (size_t s = 0; s < opt_.samples; ++s)
+        {
+            t0 = Clock::now();
+            for (size_t i = 0; i < r.reps; ++i) fn();
+            r.samples.push_back(ElapsedNs(t0) / static_cast<double>(r.reps));
+        }
+        Statistics(r);
+        std::cout << r.name << " " << r.type << " n=" << r.n << " " << r.median * 1e-3 << " us" << std::endl;
+        results_.push_back(std::move(r));
+    }
+
+    void WriteJson(const std::string& fname, const std::vector<Result>& results)
+    {
+        std::ofstream f(fname);
+        if (!f) throw std::runtime_error("WriteJson: cannot open " + fname);
+        const std::time_t now = std::time(nullptr);
+        char date[32];
+        std::strftime(date, sizeof(date), "%Y-%m-%dT%H:%M:%S", std::gmtime(&now));
+        f << "{\n  \"context\": {\"date\": \"" << date << "\", \"compiler\": \"" << BENCH_COMPILER << "\"},\n";
+        f << "  \"benchmarks\": [\n";
+        f.precision(10);
+        for (size_t i = 0; i < results.size(); ++i)
+        {
+            const Result& r = results[i];
+            f << "    {\"name\": \"" << r.name << "\", \"type\": \"" << r.type << "\", \"n\": " << r.n
+              << ", \"reps\": " << r.reps << ", \"flops\": " << r.flops << ", \"bytes\": " << r.bytes
+              << ", \"median_ns\": " << r.median << ", \"mean_ns\": " << r.mean << ", \"stddev_ns\": " << r.stddev
+              << ", \"min_ns\": " << r.min << ", \"gflops\": " << r.GFlops()
+              << ", \"bytes_per_s\": " << r.BytesPerSecond() << ", \"samples_ns\": [";
+            for (size_t s = 0; s < r.samples.size(); ++s) f << (s ? ", " : "") << r.samples[s];
+            f << "]}" << (i + 1 < results.size() ? "," : "") << "\n";
+        }
+        f << "  ]\n}\n";
+    }
+
+    std::vector<Result> ReadJson(const std::string& fname)
+    {
+        std::ifstream f(fname);
+        if (!f) throw std::runtime_error("ReadJson: cannot open " + fname);
+        std::vector<Result> res_;
+        std::string line;
+        while (std::getline(f, line))
+        {
+            if (line.find("\"samples_ns\"") == std::string::npos) continue;
+            Result r;
+            r.name    = ReadString(line, "name");
+            r.type    = ReadString(line, "type");
+            r.n       = static_cast<size_t>(ReadNumber(line, "n"));
+            r.reps    = static_cast<size_t>(ReadNumber(line, "reps"));
+            r.flops   = ReadNumber(line, "flops");
+            r.bytes   = ReadNumber(line, "bytes");
+            r.samples = ReadArray(line, "samples_ns");
+            if (r.samples.empty()) throw std::runtime_error("ReadJson: no samples for " + r.Key());
+            Statistics(r);
+            res_.push_back(std::move(r));
+        }
+        return res_;
+    }
+
+    std::vector<Comparison> Compare(const std::vector<Result>& current, const std::vector<Result>& baseline,
+                                    const Options& opt)
+    {
+        std::map<std::string, const Result*> base_;
+        for (const Result& r : baseline) base_[r.Key()] = &r;
+        std::vector<Comparison> res_;
+        for (const Result& r : current)
+        {
+            auto it = base_.find(r.Key());
+            if (it == base_.end()) continue;
+            const Result& b = *it->second;
+            Comparison c;
+            c.key   = r.Key();
+            c.ratio = r.median / b.median;
+            // ranks of the pooled samples, ties get the average rank
+            const size_t n1 = r.samples.size(), n2 = b.samples.size(), nt = n1 + n2;
+            std::vector<std::pair<double, size_t>> pool_;
+            pool_.reserve(nt);
+            for (const double& x : r.samples) pool_.emplace_back(x, 0);
+            for (const double& x : b.samples) pool_.emplace_back(x, 1);
+            std::sort(pool_.begin(), pool_.end());
+            double r1 = 0, ties = 0;
+            for (size_t i = 0; i < nt;)
+            {
+                size_t j = i;
+                while (j < nt && pool_[j].first == pool_[i].first) ++j;
+                const double rank = 0.5 * static_cast<double>(i + j + 1), t = static_cast<double>(j - i);
+                for (size_t k = i; k < j; ++k)
+                    if (pool_[k].second == 0) r1 += rank;
+                ties += t * t * t - t;
+                i = j;
+            }
+            const double d1 = static_cast<double>(n1), d2 = static_cast<double>(n2), dt = static_cast<double>(nt);
+            const double u  = r1 - d1 * (d1 + 1) / 2;
+            const double sd = std::sqrt(d1 * d2 / 12 * ((dt + 1) - ties / (dt * (dt - 1))));
+            // normal approximation with continuity correction, large U means the current samples are slower
+            c.pvalue = sd > 0 ? 0.5 * std::erfc((u - d1 * d2 / 2 - 0.5) / sd / std::sqrt(2.)) : 1;
+            c.slower = c.pvalue < opt.alpha && c.ratio > 1 + opt.threshold;
+            res_.push_back(c);
+        }
+        return res_;
+    }
+
+    void PrintResults(const std::vector<Result>& results)
+    {
+        std::printf("%-28s %-16s %6s %14s %10s %10s %12s\n", "name", "type", "n", "median [us]", "rsd [%]", "GFLOP/s",
+                    "GB/s");
+        for (const Result& r : results)
+            std::printf("%-28s %-16s %6zu %14.3f %10.2f %10.3f %12.3f\n", r.name.c_str(), r.type.c_str(), r.n,
+                        r.median * 1e-3, r.mean > 0 ? 100 * r.stddev / r.mean : 0., r.GFlops(),
+                        r.BytesPerSecond() * 1e-9);
+    }
+
+    void PrintComparison(const std::vector<Comparison>& cmp)
+    {
+        std::printf("%-56s %10s %12s\n", "case", "ratio", "p-value");
+        for (const Comparison& c : cmp)
+            std::printf("%-56s %10.3f %12.2e%s\n", c.key.c_str(), c.ratio, c.pvalue, c.slower ? "  SLOWER" : "");
+    }
+
+} // namespace bench
+
+#undef BENCH_COMPILER
@@ -0,0 +1,109 @@
+#ifndef _BENCH_HARNESS_H_D5BD533CFDF14FC18E43D788C4A3F4AA_
+#define _BENCH_HARNESS_H_D5BD533CFDF14FC18E43D788C4A3F4AA_
+
+/************************/
+/*   bench_harness.h    */
+/*    Version 1.0       */
+/*     2026/10/19       */
+/************************/
+
+#include <complex>
+#include <cstddef>
+#include <functional>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+namespace bench
+{
+    struct Options
+    {
+        // number of timed samples per case, each sample repeats the kernel for at least minTime seconds
+        size_t samples = 15;
+        double minTime = 0.02;
+        // substring that the case name must contain, empty for all
+        std::string filter;
+        // comparison mode: relative slowdown of the median and significance level of the one-sided test
+        double threshold = 0.05;
+        double alpha     = 0.01;
+    };
+
+    struct Result
+    {
+        std::string name;
+        std::string type;
+        size_t n    = 0;
+        size_t reps = 0;
+        // floating point operations and bytes moved by one call of the kernel (nominal counts)
+        double flops = 0;
+        double bytes = 0;
+        // time of one call in nanoseconds for each sample
+        std::vector<double> samples;
+        double median = 0;
+        double mean   = 0;
+        double stddev = 0;
+        double min    = 0;
+
+        inline double GFlops() const { return median > 0 ? flops / median : 0; }
+
+        inline double BytesPerSecond() const { return median > 0 ? bytes * 1e9 / median : 0; }
+
+        inline std::string Key() const { return name + "|" + type + "|" + std::to_string(n); }
+    };
+
+    struct Comparison
+    {
+        std::string key;
+        double ratio  = 0;
+        double pvalue = 1;
+        bool slower   = false;
+    };
+
+    template <typename T> inline const char* TypeName()
+    {
+        if constexpr (std::is_same<T, float>::value) return "float";
+        else if constexpr (std::is_same<T, double>::value) return "double";
+        else if constexpr (std::is_same<T, std::complex<float>>::value) return "complex<float>";
+        else return "complex<double>";
+    }
+
+    // flops of one multiply-add in units of real flops, 2 for real and 8 for complex types
+    template <typename T> constexpr double FmaFlops()
+    {
+        if constexpr (std::is_same<T, float>::value || std::is_same<T, double>::value) return 2.;
+        else return 8.;
+    }
+
+    class Runner
+    {
+      public:
+        explicit Runner(const Options& opt) : opt_(opt) {}
+
+        // time fn (after a warm up call) and store the result, skipped when the name does not match the filter
+        void Run(const std::string& name, const std::string& type, const size_t& n, const double& flops,
+                 const double& bytes, const std::function<void()>& fn);
+
+        inline const std::vector<Result>& Results() const { return results_; }
+
+      private:
+        Options opt_;
+        std::vector<Result> results_;
+    };
+
+    // one result per line so that the files can be diffed and read back by ReadJson
+    void WriteJson(const std::string& fname, const std::vector<Result>& results);
+
+    std::vector<Result> ReadJson(const std::string& fname);
+
+    // one-sided Mann-Whitney U test of the current samples being slower than the baseline ones, a case is flagged
+    // when the p-value is below alpha and the median slowed down by more than threshold
+    std::vector<Comparison> Compare(const std::vector<Result>& current, const std::vector<Result>& baseline,
+                                    const Options& opt);
+
+    void PrintResults(const std::vector<Result>& results);
+
+    void PrintComparison(const std::vector<Comparison>& cmp);
+
+} // namespace bench
+
+#endif
@@ -0,0 +1,367 @@
+/************************/
+/*    bench_main.cpp    */
+/*    Version 1.0       */
+/*     2026/10/19       */
+/************************/
+
+#include <cassert>
+#include <complex>
+#include <cstdlib>
+#include <iostream>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <vector>
+#include "bench_harness.h"
+#include "la_blas_mult.h"
+#include "la_lapack_eigen.h"
+#include "la_lapack_lu.h"
+#include "la_lapack_qr.h"
+#include "la_lapack_schur.h"
+#include "la_lapack_svd.h"
+#include "libnn/src/activations.h"
+#include "math/algebra/matrix.h"
+#include "math/algebra/matrix_operations.h"
+#include "std/string.hpp"
+
+#define T_C(x) static_cast<T>(x)
+
+namespace
+{
+    template <typename T> la::Matrix<T> Random(const size_t& m, const size_t& n, std::mt19937& gen)
+    {
+        std::uniform_real_distribution<double> dist(-1., 1.);
+        la::Matrix<T> A{m, n};
+        for (T& x : A.data())
+        {
+            if constexpr (std::is_same<T, float>::value || std::is_same<T, double>::value) x = T_C(dist(gen));
+            else x = T(static_cast<typename T::value_type>(dist(gen)), static_cast<typename T::value_type>(dist(gen)));
+        }
+        return A;
+    }
+
+    // reference loop of matrix_operations.h used when USE_BLAS is not defined, repeated here because the library
+    // instantiates the BLAS version under the same name
+    template <typename T> void NativeMatMult(la::Matrix<T>& res, const la::Matrix<T>& A, const la::Matrix<T>& B)
+    {
+        for (size_t j = 0; j < B.GetColsNb(); ++j)
+            for (size_t i = 0; i < A.GetRowsNb(); ++i)
+            {
+                res(i, j) = T_C(0);
+                for (size_t k = 0; k < A.GetColsNb(); ++k) res(i, j) += A(i, k) * B(k, j);
+            }
+    }
+
+    template <typename T> void NativeMatMultVec(la::Matrix<T>& res, const la::Matrix<T>& A, const la::Matrix<T>& B)
+    {
+        for (size_t i = 0; i < A.GetRowsNb(); ++i)
+        {
+            res(i, 0) = T_C(0);
+            for (size_t j = 0; j < A.GetColsNb(); ++j) res(i, 0) += A(i, j) * B(j, 0);
+        }
+    }
+
+    // elementwise operations, Transpose, products and RREF of the Matrix core
+    template <typename T> void BenchCore(bench::Runner& runner, const std::vector<size_t>& sizes)
+    {
+        const char* type = bench::TypeName<T>();
+        // real flops of an addition and of a multiplication
+        const bool cplx  = !std::is_floating_point<T>::value;
+        const double sz  = sizeof(T), fma = bench::FmaFlops<T>(), add = cplx ? 2 : 1, mul = cplx ? 6 : 1;
+        std::mt19937 gen(42);
+        for (const size_t& n : sizes)
+        {
+            const double n2 = static_cast<double>(n * n), n3 = n2 * static_cast<double>(n);
+            la::Matrix<T> A = Random<T>(n, n, gen), B = Random<T>(n, n, gen), C{n, n};
+            la::Matrix<T> x = Random<T>(n, 1, gen), y{n, 1};
+            runner.Run("Matrix/add", type, n, add * n2, 3 * n2 * sz, [&]() { C = A + B; });
+            runner.Run("Matrix/add_assign", type, n, add * n2, 3 * n2 * sz, [&]() { C += A; });
+            runner.Run("Matrix/scale", type, n, mul * n2, 2 * n2 * sz, [&]() { C *= T_C(-1); });
+            runner.Run("Matrix/Transpose", type, n, 0, 2 * n2 * sz, [&]() { C.Transpose(); });
+            runner.Run("MatMult/native", type, n, fma * n3, 3 * n2 * sz, [&]() { NativeMatMult(C, A, B); });
+            runner.Run("MatMult/blas", type, n, fma * n3, 3 * n2 * sz, [&]() { la::MatMult(C, A, B); });
+            runner.Run("MatMultVec/native", type, n, fma * n2, (n2 + 2 * static_cast<double>(n)) * sz,
+                       [&]() { NativeMatMultVec(y, A, x); });
+            runner.Run("MatMultVec/blas", type, n, fma * n2, (n2 + 2 * static_cast<double>(n)) * sz,
+                       [&]() { la::MatMultVec(y, A, x); });
+            if constexpr (std::is_same<T, float>::value || std::is_same<T, double>::value)
+            {
+                // Gauss-Jordan elimination, about n^3 multiply-adds
+                runner.Run("MatRref", type, n, fma * n3, 2 * n2 * sz, [&]() {
+                    C = A;
+                    la::MatRref(C);
+                });
+            }
+        }
+    }
+
+    // LAPACK drivers, the counts are the usual nominal ones so that the rates of the drivers can be compared, the
+    // input copy made by the const overloads is included in the timings
+    template <typename T> void BenchDecompositions(bench::Runner& runner, const std::vector<size_t>& sizes)
+    {
+        using RealType   = la::RealTypeOf<T>;
+        const char* type = bench::TypeName<T>();
+        const double sz  = sizeof(T), fma = bench::FmaFlops<T>();
+        std::mt19937 gen(43);
+        for (const size_t& n : sizes)
+        {
+            const double n2 = static_cast<double>(n * n), n3 = n2 * static_cast<double>(n);
+            const la::Matrix<T> A = Random<T>(n, n, gen);
+            la::Matrix<T> U{n, n}, V{n, n}, Q{n, n}, R{n, n}, S{n, n}, LU{0, 0}, E{0, 0};
+            std::vector<RealType> s(n);
+            std::vector<int> ipiv;
+            const std::pair<const char*, int> drivers[] = {{"SVD/GESVD", la::DRIVER::GESVD},
+                                                           {"SVD/GESDD", la::DRIVER::GESDD},
+                                                           {"SVD/GESVJ", la::DRIVER::GESVJ},
+                                                           {"SVD/GEJSV", la::DRIVER::GEJSV}};
+            for (const auto& d : drivers)
+                runner.Run(d.first, type, n, 11 * fma * n3, 3 * n2 * sz,
+                           [&]() { la::MatSVD(U, s, V, A, d.second); });
+            runner.Run("LU", type, n, fma / 3 * n3, 2 * n2 * sz, [&]() { la::MatLUFactor(LU, ipiv, A); });
+            runner.Run("QR", type, n, 4 * fma / 3 * n3, 3 * n2 * sz, [&]() { la::MatQR(Q, R, A); });
+            if constexpr (std::is_same<T, float>::value || std::is_same<T, double>::value) E = la::Matrix<T>{n, 2};
+            else E = la::Matrix<T>{n, 1};
+            runner.Run("Schur", type, n, 12.5 * fma * n3, 3 * n2 * sz,
+                       [&]() { la::MatSchur(E, &V, S, A, la::SCHUR::COMPUTE_V); });
+            runner.Run("Eigen", type, n, 13 * fma * n3, 2 * n2 * sz,
+                       [&]() { la::MatEigen(E, &V, A, la::EIGEN::COMPUTE_VR); });
+        }
+    }
+
+    // one SGD step of a minibatch on a fully connected sigmoid network as in nn::ANN_MLP_SGD::TrainSGD, computed
+    // sample by sample with the explicit transpose of the weights that was rebuilt for each sample, sample by sample
+    // with the transposed GEMV and the rank-1 update accumulated in place, and with the GEMM of the whole minibatch
+    template <typename T>
+    void BenchSGD(bench::Runner& runner, const std::vector<size_t>& layers, const std::vector<size_t>& batches)
+    {
+        const char* type = bench::TypeName<T>();
+        const size_t nL  = layers.size() - 1;
+        const T alpha    = T_C(-1e-6);
+        void (*pAct)(T*, const T*, size_t) = &nn::sigmoid<T>;
+        void (*pDAct)(T*, size_t)          = &nn::dsigmoid<T>;
+        std::mt19937 gen(44);
+        std::vector<la::Matrix<T>> w, b, wt, nw, nb, dnw;
+        double nW = 0, nW1 = static_cast<double>(layers[0] * layers[1]);
+        for (size_t l = 0; l < nL; ++l)
+        {
+            w.push_back(Random<T>(layers[l + 1], layers[l], gen));
+            b.push_back(Random<T>(layers[l + 1], 1, gen));
+            wt.push_back(la::Matrix<T>{layers[l], layers[l + 1]});
+            nw.push_back(la::Matrix<T>{layers[l + 1], layers[l]});
+            dnw.push_back(la::Matrix<T>{layers[l + 1], layers[l]});
+            nb.push_back(la::Matrix<T>{layers[l + 1], 1});
+            nW += static_cast<double>(layers[l] * layers[l + 1]);
+        }
+        for (const size_t& nB : batches)
+        {
+            const double dB = static_cast<double>(nB);
+            // forward, propagated delta (not needed for the first layer) and gradient
+            const double flops = bench::FmaFlops<T>() * (3 * nW - nW1) * dB, bytes = 3 * nW * sizeof(T);
+            const la::Matrix<T> X = Random<T>(layers[0], nB, gen), Y = Random<T>(layers[nL], nB, gen);
+            // per sample buffers
+            std::vector<la::Matrix<T>> a{la::Matrix<T>{layers[0], 1}}, z, d, d2;
+            // minibatch buffers
+            std::vector<la::Matrix<T>> A{X}, Z, D;
+            la::Matrix<T> one{nB, 1};
+            std::fill(one.data().begin(), one.data().end(), T_C(1));
+            for (size_t l = 1; l <= nL; ++l)
+            {
+                for (auto* v : {&a, &z, &d, &d2}) v->push_back(la::Matrix<T>{layers[l], 1});
+                for (auto* v : {&A, &Z, &D}) v->push_back(la::Matrix<T>{layers[l], nB});
+            }
+
+            // forward and output delta of sample k, shared by the two per sample variants
+            auto forward_ = [&](const size_t k) {
+                std::copy(X.data().begin() + (long)(k * layers[0]), X.data().begin() + (long)((k + 1) * layers[0]),
+                          a[0].data().begin());
+                for (size_t l = 0; l < nL; ++l)
+                {
+                    la::MatMultVec(z[l], w[l], a[l]);
+                    z[l] += b[l];
+                    nn::ActFunc(a[l + 1], z[l], pAct);
+                    nn::ActFunc(z[l], pDAct);
+                }
+                for (size_t i = 0; i < layers[nL]; ++i)
+                    d[nL - 1](i, 0) = (a[nL](i, 0) - Y(i, k)) * z[nL - 1](i, 0);
+            };
+            auto update_ = [&]() {
+                for (size_t l = 0; l < nL; ++l)
+                {
+                    la::MatAxpy(w[l], alpha, nw[l]);
+                    la::MatAxpy(b[l], alpha, nb[l]);
+                }
+            };
+
+            runner.Run("SGD/sample_transpose", type, nB, flops, bytes, [&]() {
+                for (size_t l = 0; l < nL; ++l)
+                {
+                    nw[l].Zeros();
+                    nb[l].Zeros();
+                }
+                for (size_t k = 0; k < nB; ++k)
+                {
+                    for (size_t l = 0; l < nL; ++l)
+                    {
+                        dnw[l].Zeros();
+                        la::MatTranspose(wt[l], w[l]);
+                    }
+                    forward_(k);
+                    for (size_t l = nL - 1; l > 0; --l)
+                    {
+                        la::MatMultVec(d2[l - 1], wt[l], d[l]);
+                        la::MatHadamard(d[l - 1], d2[l - 1], z[l - 1]);
+                    }
+                    for (size_t l = 0; l < nL; ++l)
+                    {
+                        la::MatOuter(dnw[l], d[l], a[l]);
+                        nw[l] += dnw[l];
+                        nb[l] += d[l];
+                    }
+                }
+                update_();
+            });
+            runner.Run("SGD/sample_gemv_t", type, nB, flops, bytes, [&]() {
+                for (size_t l = 0; l < nL; ++l)
+                {
+                    nw[l].Zeros();
+                    nb[l].Zeros();
+                }
+                for (size_t k = 0; k < nB; ++k)
+                {
+                    forward_(k);
+                    for (size_t l = nL - 1; l > 0; --l)
+                    {
+                        la::MatMultVec(d2[l - 1], w[l], d[l], la::MULT::A_T);
+                        la::MatHadamard(d[l - 1], d2[l - 1], z[l - 1]);
+                    }
+                    for (size_t l = 0; l < nL; ++l)
+                    {
+                        la::MatOuterAdd(nw[l], d[l], a[l]);
+                        nb[l] += d[l];
+                    }
+                }
+                update_();
+            });
+            runner.Run("SGD/minibatch_gemm", type, nB, flops, bytes, [&]() {
+                for (size_t l = 0; l < nL; ++l)
+                {
+                    const size_t m = layers[l + 1];
+                    for (size_t k = 0; k < nB; ++k)
+                        std::copy(b[l].data().begin(), b[l].data().end(), Z[l].data().begin() + (long)(k * m));
+                    la::Gemm('N', 'N', m, nB, layers[l], T_C(1), w[l].data().data(), m, A[l].data().data(),
+                             layers[l], T_C(1), Z[l].data().data(), m);
+                    nn::ActFunc(A[l + 1], Z[l], pAct);
+                    nn::ActFunc(Z[l], pDAct);
+                }
+                for (size_t i = 0; i < D[nL - 1].size(); ++i)
+                    D[nL - 1].data()[i] = (A[nL].data()[i] - Y.data()[i]) * Z[nL - 1].data()[i];
+                for (size_t l = nL; l > 0; --l)
+                {
+                    const size_t m = layers[l], n = layers[l - 1];
+                    if (l > 1)
+                    {
+                        la::Gemm('T', 'N', n, nB, m, T_C(1), w[l - 1].data().data(), m, D[l - 1].data().data(), m,
+                                 T_C(0), D[l - 2].data().data(), n);
+                        for (size_t i = 0; i < D[l - 2].size(); ++i) D[l - 2].data()[i] *= Z[l - 2].data()[i];
+                    }
+                    la::Gemm('N', 'T', m, n, nB, alpha, D[l - 1].data().data(), m, A[l - 1].data().data(), n,
+                             T_C(1), w[l - 1].data().data(), m);
+                    la::Gemm('N', 'N', m, 1, nB, alpha, D[l - 1].data().data(), m, one.data().data(), nB, T_C(1),
+                             b[l - 1].data().data(), m);
+                }
+            });
+        }
+        // per sample cost of the step
+        for (const bench::Result& r : runner.Results())
+            if (r.name.compare(0, 4, "SGD/") == 0 && r.type == type)
+                std::cout << r.name << " " << r.type << " batch=" << r.n << " "
+                          << r.median * 1e-3 / static_cast<double>(r.n) << " us / sample" << std::endl;
+    }
+
+    std::vector<size_t> ParseSizes(const std::string& s)
+    {
+        std::vector<size_t> res_;
+        for (const std::string& t : std_ext::tokenize(s, ',')) res_.push_back(std::stoul(t));
+        return res_;
+    }
+
+    void Usage()
+    {
+        std::cout << "Usage: cpp_bench [options]\n"
+                     "  --sizes a,b,...      matrix sizes of the Matrix core cases (default 32,128,512)\n"
+                     "  --dsizes a,b,...     matrix sizes of the decomposition cases (default 32,128,256)\n"
+                     "  --layers a,b,...     layer sizes of the SGD step cases (default 784,128,10)\n"
+                     "  --batches a,b,...    minibatch sizes of the SGD step cases (default 1,10,100)\n"
+                     "  --samples N          timed samples per case (default 15)\n"
+                     "  --min-time S         minimum duration of a sample in seconds (default 0.02)\n"
+                     "  --filter STR         only run the cases whose name contains STR\n"
+                     "  --json FILE          write the results to FILE\n"
+                     "  --baseline FILE      compare with the results stored in FILE, exit code 2 on slowdowns\n"
+                     "  --threshold X        relative slowdown of the median to flag (default 0.05)\n"
+                     "  --alpha P            significance level of the one-sided test (default 0.01)\n";
+    }
+} // namespace
+
+int main(int argc, char* argv[])
+{
+    bench::Options opt;
+    std::vector<size_t> sizes{32, 128, 512}, dsizes{32, 128, 256}, layers{784, 128, 10}, batches{1, 10, 100};
+    std::string json, baseline;
+    try
+    {
+        for (int i = 1; i < argc; ++i)
+        {
+            const std::string arg = argv[i];
+            if (arg == "-h" || arg == "--help")
+            {
+                Usage();
+                return 0;
+            }
+            if (i + 1 >= argc) throw std::invalid_argument("missing value for " + arg);
+            const std::string val = argv[++i];
+            if (arg == "--sizes") sizes = ParseSizes(val);
+            else if (arg == "--dsizes") dsizes = ParseSizes(val);
+            else if (arg == "--layers") layers = ParseSizes(val);
+            else if (arg == "--batches") batches = ParseSizes(val);
+            else if (arg == "--samples") opt.samples = std::max<size_t>(2, std::stoul(val));
+            else if (arg == "--min-time") opt.minTime = std::stod(val);
+            else if (arg == "--filter") opt.filter = val;
+            else if (arg == "--json") json = val;
+            else if (arg == "--baseline") baseline = val;
+            else if (arg == "--threshold") opt.threshold = std::stod(val);
+            else if (arg == "--alpha") opt.alpha = std::stod(val);
+            else throw std::invalid_argument("unknown option " + arg);
+        }
+        bench::Runner runner(opt);
+        BenchCore<float>(runner, sizes);
+        BenchCore<double>(runner, sizes);
+        BenchCore<std::complex<float>>(runner, sizes);
+        BenchCore<std::complex<double>>(runner, sizes);
+        BenchDecompositions<float>(runner, dsizes);
+        BenchDecompositions<double>(runner, dsizes);
+        BenchDecompositions<std::complex<float>>(runner, dsizes);
+        BenchDecompositions<std::complex<double>>(runner, dsizes);
+        if (layers.size() < 2) throw std::invalid_argument("at least two layers are needed");
+        BenchSGD<float>(runner, layers, batches);
+        BenchSGD<double>(runner, layers, batches);
+        bench::PrintResults(runner.Results());
+        if (!json.empty()) bench::WriteJson(json, runner.Results());
+        if (!baseline.empty())
+        {
+            const std::vector<bench::Comparison> cmp = bench::Compare(runner.Results(), bench::ReadJson(baseline), opt);
+            bench::PrintComparison(cmp);
+            for (const bench::Comparison& c : cmp)
+                if (c.slower) return 2;
+        }
+    }
+    catch (const std::exception& e)
+    {
+        std::cerr << "cpp_bench: " << e.what() << std::endl;
+        Usage();
+        return 1;
+    }
+    return 0;
+}
+
+#undef T_C
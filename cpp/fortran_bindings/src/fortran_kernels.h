@@ -0,0 +1,63 @@
+#ifndef _FORTRAN_KERNELS_H_63653A05B838463F9588543320D3C780_
+#define _FORTRAN_KERNELS_H_63653A05B838463F9588543320D3C780_
+
+/************************/
+/*  fortran_kernels.h   */
+/*    Version 1.0       */
+/*     2026/10/19       */
+/************************/
+
+#include <vector>
+#include "la_fortran_array.h"
+#include "math/algebra/matrix.h"
+
+// BIND(C) kernels of fortran/libalgebra (ALGEBRA_01_C) and fortran/libalgo (ALGO_UTILS_C)
+extern "C" void algebra_rref(CFI_cdesc_t* matrix, double tolerance);
+extern "C" void algo_quicksort_i4(CFI_cdesc_t* v);
+extern "C" void algo_quicksort_r8(CFI_cdesc_t* v);
+
+namespace la
+{
+    // reduced row echelon form computed in place by ALGEBRA_01::RREF on the buffer of A
+    inline Matrix<double>& MatRrefF(Matrix<double>& A, const double& tol = 1e-9)
+    {
+        FortranArray<double> d_(A);
+        algebra_rref(d_, tol);
+        return A;
+    }
+
+    // same on the m x n block of A starting at (i0, j0), the other elements are untouched
+    inline Matrix<double>& MatRrefF(Matrix<double>& A, const size_t& i0, const size_t& j0, const size_t& m,
+                                    const size_t& n, const double& tol = 1e-9)
+    {
+        FortranArray<double> d_(A, i0, j0, m, n);
+        algebra_rref(d_, tol);
+        return A;
+    }
+
+    // ascending sort in place by ALGO_UTILS::QUICKSORT_I4 / QUICKSORT_R8
+    inline std::vector<int>& SortF(std::vector<int>& v)
+    {
+        FortranArray<int> d_(v);
+        algo_quicksort_i4(d_);
+        return v;
+    }
+
+    inline std::vector<double>& SortF(std::vector<double>& v)
+    {
+        FortranArray<double> d_(v);
+        algo_quicksort_r8(d_);
+        return v;
+    }
+
+    // sorts the elements of A in column major order
+    inline Matrix<double>& SortF(Matrix<double>& A)
+    {
+        FortranArray<double> d_(A.data().data(), A.size());
+        algo_quicksort_r8(d_);
+        return A;
+    }
+
+} // namespace la
+
+#endif
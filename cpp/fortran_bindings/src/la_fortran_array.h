@@ -0,0 +1,140 @@
+#ifndef _LA_FORTRAN_ARRAY_H_DDCBF2424C174B0E8212AC96D32479EA_
+#define _LA_FORTRAN_ARRAY_H_DDCBF2424C174B0E8212AC96D32479EA_
+
+/************************/
+/*  la_fortran_array.h  */
+/*    Version 1.0       */
+/*     2026/10/19       */
+/************************/
+
+#include <ISO_Fortran_binding.h>
+#include <complex>
+#include <cstddef>
+#include <stdexcept>
+#include <type_traits>
+#include <vector>
+#include "math/algebra/matrix.h"
+
+namespace la
+{
+    // CFI type code of T
+    template <typename T> constexpr CFI_type_t CFIType()
+    {
+        if constexpr (std::is_same<T, float>::value) return CFI_type_float;
+        else if constexpr (std::is_same<T, double>::value) return CFI_type_double;
+        else if constexpr (std::is_same<T, std::complex<float>>::value) return CFI_type_float_Complex;
+        else if constexpr (std::is_same<T, std::complex<double>>::value) return CFI_type_double_Complex;
+        else
+        {
+            static_assert(std::is_same<T, int>::value, "CFIType: unsupported type");
+            return CFI_type_int;
+        }
+    }
+
+    // Descriptor of an assumed-shape Fortran array (rank 1 or 2) over a C++ buffer, for passing to a BIND(C)
+    // procedure with a DIMENSION(:) or DIMENSION(:,:) dummy. The buffer is not copied, la::Matrix and Fortran are both
+    // column major so the Fortran routine works directly on the matrix, which must outlive the descriptor.
+    template <typename T> class FortranArray
+    {
+      public:
+        // rank 2 descriptor of the m x n block at data with leading dimension ld (ld = m when contiguous)
+        inline FortranArray(T* data, const size_t& m, const size_t& n, const size_t& ld)
+        {
+            if (ld < m) throw std::invalid_argument("FortranArray: leading dimension smaller than the rows");
+            const CFI_index_t extents[2] = {static_cast<CFI_index_t>(m), static_cast<CFI_index_t>(n)};
+            Establish(data, 2, extents);
+            // a sub-block of a larger matrix keeps the column stride of the parent
+            desc()->dim[1].sm = static_cast<CFI_index_t>(ld * sizeof(T));
+        }
+
+        inline FortranArray(T* data, const size_t& m, const size_t& n) : FortranArray(data, m, n, m) {}
+
+        // rank 1 descriptor of n contiguous elements
+        inline FortranArray(T* data, const size_t& n)
+        {
+            const CFI_index_t extents[1] = {static_cast<CFI_index_t>(n)};
+            Establish(data, 1, extents);
+        }
+
+        inline explicit FortranArray(Matrix<T>& A) : FortranArray(A.data().data(), A.GetRowsNb(), A.GetColsNb()) {}
+
+        // rows i0 to i0 + m - 1 and columns j0 to j0 + n - 1 of A
+        inline FortranArray(Matrix<T>& A, const size_t& i0, const size_t& j0, const size_t& m, const size_t& n)
+            : FortranArray(A.data().data() + j0 * A.GetRowsNb() + i0, m, n, A.GetRowsNb())
+        {
+            if (i0 + m > A.GetRowsNb() || j0 + n > A.GetColsNb())
+                throw std::out_of_range("FortranArray: block outside of the matrix");
+        }
+
+        inline explicit FortranArray(std::vector<T>& v) : FortranArray(v.data(), v.size()) {}
+
+        inline CFI_cdesc_t* desc() { return reinterpret_cast<CFI_cdesc_t*>(&desc_); }
+
+        inline operator CFI_cdesc_t*() { return desc(); }
+
+      private:
+        inline void Establish(T* data, const CFI_rank_t& rank, const CFI_index_t extents[])
+        {
+            // a null base address is only accepted for pointers and allocatables, empty arrays get a dummy one
+            static T empty_[1];
+            if (CFI_establish(desc(), data ? data : empty_, CFI_attribute_other, CFIType<T>(), sizeof(T), rank,
+                              extents) != CFI_SUCCESS)
+                throw std::runtime_error("FortranArray: CFI_establish failed");
+        }
+
+        CFI_CDESC_T(2) desc_;
+    };
+
+    // Element access to an array received from Fortran through a C descriptor (rank 1 or 2), the strides of the
+    // descriptor are honoured so array sections are viewed without a copy. A rank 1 array is viewed as a column.
+    template <typename T> class FortranArrayView
+    {
+      public:
+        inline explicit FortranArrayView(const CFI_cdesc_t* d) : d_(d)
+        {
+            if (d->type != CFIType<T>() || d->elem_len != sizeof(T))
+                throw std::invalid_argument("FortranArrayView: type mismatch");
+            if (d->rank < 1 || d->rank > 2) throw std::invalid_argument("FortranArrayView: rank must be 1 or 2");
+            base_ = static_cast<char*>(d->base_addr);
+            rows_ = static_cast<size_t>(d->dim[0].extent);
+            smr_  = d->dim[0].sm;
+            cols_ = d->rank == 2 ? static_cast<size_t>(d->dim[1].extent) : 1;
+            smc_  = d->rank == 2 ? d->dim[1].sm : 0;
+        }
+
+        inline size_t GetRowsNb() const { return rows_; }
+
+        inline size_t GetColsNb() const { return cols_; }
+
+        inline size_t size() const { return rows_ * cols_; }
+
+        // column major without gaps, data() can then be handed to BLAS/LAPACK with ld = rows
+        inline bool IsContiguous() const { return CFI_is_contiguous(d_) == 1; }
+
+        inline T* data() const { return reinterpret_cast<T*>(base_); }
+
+        inline T& operator()(const size_t& i, const size_t& j) const
+        {
+            return *reinterpret_cast<T*>(base_ + static_cast<CFI_index_t>(i) * smr_ +
+                                         static_cast<CFI_index_t>(j) * smc_);
+        }
+
+        // copy into a la::Matrix, for the routines that need an owning matrix
+        inline Matrix<T>& CopyTo(Matrix<T>& A) const
+        {
+            if (A.GetRowsNb() != rows_ || A.GetColsNb() != cols_) A = Matrix<T>(rows_, cols_);
+            for (size_t j = 0; j < cols_; ++j)
+                for (size_t i = 0; i < rows_; ++i) A(i, j) = (*this)(i, j);
+            return A;
+        }
+
+      private:
+        const CFI_cdesc_t* d_;
+        char* base_;
+        size_t rows_, cols_;
+        CFI_index_t smr_, smc_;
+    };
+
+} // namespace la
+
+#endif
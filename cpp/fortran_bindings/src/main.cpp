@@ -17,6 +17,7 @@ extern "C" void exec_(void (*)(double*, double*));
 #include <iomanip>
 #include <iostream>
 #include <vector>
+#include "fortran_kernels.h"
 
 void op(double* x, double* f)
 {
@@ -42,6 +43,17 @@ int main()
     std::cout << "Expected is " << (ar1[ST_C(x - 1)] + ar2[ST_C(y - 1)]) << std::endl;
     exec_(&op);
     std::cout << "Expected is 3^2 = 9 " << std::endl;
+
+    /* la::Matrix buffers are handed to Fortran through C descriptors without copies */
+    la::Matrix<double> A{3, 4};
+    A.assign({1.0, 2.0, 3.0, 2.0, 5.0, 7.0, 3.0, 8.0, 12.0, 4.0, 2.0, 5.0});
+    la::MatRrefF(A);
+    std::cout << "RREF computed by Fortran" << std::endl << std::setprecision(3) << A;
+    std::vector<double> v = {3.5, -1.0, 2.25, 0.0};
+    la::SortF(v);
+    std::cout << "Sorted by Fortran:";
+    for (const double& x_ : v) std::cout << " " << x_;
+    std::cout << std::endl;
     return 0;
 }
 
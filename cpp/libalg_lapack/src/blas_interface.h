@@ -16,6 +16,27 @@
 #define cgemm_ CGEMM
 #define zgemv_ ZGEMV
 #define zgemm_ ZGEMM
+
+#define ssyrk_ SSYRK
+#define dsyrk_ DSYRK
+#define csyrk_ CSYRK
+#define zsyrk_ ZSYRK
+#define cherk_ CHERK
+#define zherk_ ZHERK
+#define sger_  SGER
+#define dger_  DGER
+#define cgeru_ CGERU
+#define zgeru_ ZGERU
+#define sdot_  SDOT
+#define ddot_  DDOT
+#define sscal_ SSCAL
+#define dscal_ DSCAL
+#define cscal_ CSCAL
+#define zscal_ ZSCAL
+#define saxpy_ SAXPY
+#define daxpy_ DAXPY
+#define caxpy_ CAXPY
+#define zaxpy_ ZAXPY
 #endif
 
 // float
@@ -38,5 +59,36 @@ extern "C" void zgemv_(char* trans, int* m, int* n, double* alpha, double* A, in
                        double* beta, double* y, int* incy);
 extern "C" void zgemm_(char* transa, char* transb, int* m, int* n, int* k, double* alpha, double* a, int* lda,
                        double* b, int* ldb, double* beta, double* c, int* ldc);
+// Level 3 rank-k update, level 2 rank-1 update and level 1 interface
+// float
+extern "C" void ssyrk_(char* uplo, char* trans, int* n, int* k, float* alpha, float* a, int* lda, float* beta, float* c,
+                       int* ldc);
+extern "C" void sger_(int* m, int* n, float* alpha, float* x, int* incx, float* y, int* incy, float* a, int* lda);
+extern "C" float sdot_(int* n, float* x, int* incx, float* y, int* incy);
+extern "C" void sscal_(int* n, float* alpha, float* x, int* incx);
+extern "C" void saxpy_(int* n, float* alpha, float* x, int* incx, float* y, int* incy);
+// double
+extern "C" void dsyrk_(char* uplo, char* trans, int* n, int* k, double* alpha, double* a, int* lda, double* beta,
+                       double* c, int* ldc);
+extern "C" void dger_(int* m, int* n, double* alpha, double* x, int* incx, double* y, int* incy, double* a, int* lda);
+extern "C" double ddot_(int* n, double* x, int* incx, double* y, int* incy);
+extern "C" void dscal_(int* n, double* alpha, double* x, int* incx);
+extern "C" void daxpy_(int* n, double* alpha, double* x, int* incx, double* y, int* incy);
+// complex
+extern "C" void csyrk_(char* uplo, char* trans, int* n, int* k, float* alpha, float* a, int* lda, float* beta, float* c,
+                       int* ldc);
+extern "C" void cherk_(char* uplo, char* trans, int* n, int* k, float* alpha, float* a, int* lda, float* beta, float* c,
+                       int* ldc);
+extern "C" void cgeru_(int* m, int* n, float* alpha, float* x, int* incx, float* y, int* incy, float* a, int* lda);
+extern "C" void cscal_(int* n, float* alpha, float* x, int* incx);
+extern "C" void caxpy_(int* n, float* alpha, float* x, int* incx, float* y, int* incy);
+// double complex
+extern "C" void zsyrk_(char* uplo, char* trans, int* n, int* k, double* alpha, double* a, int* lda, double* beta,
+                       double* c, int* ldc);
+extern "C" void zherk_(char* uplo, char* trans, int* n, int* k, double* alpha, double* a, int* lda, double* beta,
+                       double* c, int* ldc);
+extern "C" void zgeru_(int* m, int* n, double* alpha, double* x, int* incx, double* y, int* incy, double* a, int* lda);
+extern "C" void zscal_(int* n, double* alpha, double* x, int* incx);
+extern "C" void zaxpy_(int* n, double* alpha, double* x, int* incx, double* y, int* incy);
 
 #endif
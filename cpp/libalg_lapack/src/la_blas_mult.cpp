@@ -4,6 +4,7 @@
 /*     2023/06/04       */
 /************************/
 
+#include <algorithm>
 #include <cassert>
 #include <complex>
 #include <type_traits>
@@ -23,6 +24,66 @@
 namespace la
 {
 
+    template <typename T>
+    void Gemm(const char& transa, const char& transb, const size_t& m, const size_t& n, const size_t& k, const T& alpha,
+              const T* A, const size_t& lda, const T* B, const size_t& ldb, const T& beta, T* C, const size_t& ldc)
+    {
+        if (m == 0 || n == 0) return;
+        char ta = transa, tb = transb;
+        int m_ = INT_C(m), n_ = INT_C(n), k_ = INT_C(k), lda_ = INT_C(lda), ldb_ = INT_C(ldb), ldc_ = INT_C(ldc);
+        T alpha_ = alpha, beta_ = beta;
+        if constexpr (std::is_same_v<T, float>)
+        {
+            sgemm_(&ta, &tb, &m_, &n_, &k_, &alpha_, CONST_FLOAT_P_R(A), &lda_, CONST_FLOAT_P_R(B), &ldb_, &beta_, C,
+                   &ldc_);
+        }
+        else if constexpr (std::is_same_v<T, double>)
+        {
+            dgemm_(&ta, &tb, &m_, &n_, &k_, &alpha_, CONST_DOUBLE_P_R(A), &lda_, CONST_DOUBLE_P_R(B), &ldb_, &beta_, C,
+                   &ldc_);
+        }
+        else if constexpr (std::is_same_v<T, std::complex<float>>)
+        {
+            cgemm_(&ta, &tb, &m_, &n_, &k_, FLOAT_P_R(&alpha_), CONST_FLOAT_P_R(A), &lda_, CONST_FLOAT_P_R(B), &ldb_,
+                   FLOAT_P_R(&beta_), FLOAT_P_R(C), &ldc_);
+        }
+        else if constexpr (std::is_same_v<T, std::complex<double>>)
+        {
+            zgemm_(&ta, &tb, &m_, &n_, &k_, DOUBLE_P_R(&alpha_), CONST_DOUBLE_P_R(A), &lda_, CONST_DOUBLE_P_R(B), &ldb_,
+                   DOUBLE_P_R(&beta_), DOUBLE_P_R(C), &ldc_);
+        }
+        else { throw std::runtime_error("Gemm: type not supported"); }
+    }
+
+    template <typename T>
+    void Gemv(const char& trans, const size_t& m, const size_t& n, const T& alpha, const T* A, const size_t& lda,
+              const T* x, const size_t& incx, const T& beta, T* y, const size_t& incy)
+    {
+        if (m == 0 || n == 0) return;
+        char ta = trans;
+        int m_ = INT_C(m), n_ = INT_C(n), lda_ = INT_C(lda), incx_ = INT_C(incx), incy_ = INT_C(incy);
+        T alpha_ = alpha, beta_ = beta;
+        if constexpr (std::is_same_v<T, float>)
+        {
+            sgemv_(&ta, &m_, &n_, &alpha_, CONST_FLOAT_P_R(A), &lda_, CONST_FLOAT_P_R(x), &incx_, &beta_, y, &incy_);
+        }
+        else if constexpr (std::is_same_v<T, double>)
+        {
+            dgemv_(&ta, &m_, &n_, &alpha_, CONST_DOUBLE_P_R(A), &lda_, CONST_DOUBLE_P_R(x), &incx_, &beta_, y, &incy_);
+        }
+        else if constexpr (std::is_same_v<T, std::complex<float>>)
+        {
+            cgemv_(&ta, &m_, &n_, FLOAT_P_R(&alpha_), CONST_FLOAT_P_R(A), &lda_, CONST_FLOAT_P_R(x), &incx_,
+                   FLOAT_P_R(&beta_), FLOAT_P_R(y), &incy_);
+        }
+        else if constexpr (std::is_same_v<T, std::complex<double>>)
+        {
+            zgemv_(&ta, &m_, &n_, DOUBLE_P_R(&alpha_), CONST_DOUBLE_P_R(A), &lda_, CONST_DOUBLE_P_R(x), &incx_,
+                   DOUBLE_P_R(&beta_), DOUBLE_P_R(y), &incy_);
+        }
+        else { throw std::runtime_error("Gemv: type not supported"); }
+    }
+
     template <typename T> Matrix<T>& MatMultVec(Matrix<T>& res, const Matrix<T>& A, const Matrix<T>& B)
     {
         assert(A.GetColsNb() == B.GetRowsNb());
@@ -57,6 +118,24 @@ namespace la
         return res;
     }
 
+    template <typename T>
+    Matrix<T>& MatMultVec(Matrix<T>& res, const Matrix<T>& A, const Matrix<T>& B, const int& flags)
+    {
+        const char trans = (flags & MULT::A_HT) ? 'C' : ((flags & MULT::A_T) ? 'T' : 'N');
+        assert(B.GetColsNb() == 1);
+        assert(res.GetColsNb() == 1);
+        assert(B.GetRowsNb() == ((trans == 'N') ? A.GetColsNb() : A.GetRowsNb()));
+        assert(res.GetRowsNb() == ((trans == 'N') ? A.GetRowsNb() : A.GetColsNb()));
+        if (A.GetRowsNb() == 0 || A.GetColsNb() == 0)
+        {
+            res.Zeros();
+            return res;
+        }
+        Gemv(trans, A.GetRowsNb(), A.GetColsNb(), T(1), A.data().data(), A.GetRowsNb(), B.data().data(), SIZE_T_C(1),
+             T(0), res.data().data(), SIZE_T_C(1));
+        return res;
+    }
+
     template <typename T> inline Matrix<T>& MatMult(Matrix<T>& res, const Matrix<T>& A, const Matrix<T>& B)
     {
         assert(res.GetRowsNb() == A.GetRowsNb());
@@ -92,6 +171,182 @@ namespace la
         return res;
     }
 
+    template <typename T>
+    Matrix<T>& MatMult(Matrix<T>& res, const Matrix<T>& A, const Matrix<T>& B, const int& flags)
+    {
+        const char transa = (flags & MULT::A_HT) ? 'C' : ((flags & MULT::A_T) ? 'T' : 'N');
+        const char transb = (flags & MULT::B_HT) ? 'C' : ((flags & MULT::B_T) ? 'T' : 'N');
+        const size_t m = (transa == 'N') ? A.GetRowsNb() : A.GetColsNb();
+        const size_t k = (transa == 'N') ? A.GetColsNb() : A.GetRowsNb();
+        const size_t n = (transb == 'N') ? B.GetColsNb() : B.GetRowsNb();
+        assert(k == ((transb == 'N') ? B.GetRowsNb() : B.GetColsNb()));
+        assert(res.GetRowsNb() == m);
+        assert(res.GetColsNb() == n);
+        Gemm(transa, transb, m, n, k, T(1), A.data().data(), std::max(A.GetRowsNb(), SIZE_T_C(1)), B.data().data(),
+             std::max(B.GetRowsNb(), SIZE_T_C(1)), T(0), res.data().data(), std::max(m, SIZE_T_C(1)));
+        return res;
+    }
+
+    template <typename T> Matrix<T>& MatGram(Matrix<T>& res, const Matrix<T>& A, const int& flags)
+    {
+        const bool bOuter = flags & GRAM::A_AH;
+        const size_t n = bOuter ? A.GetRowsNb() : A.GetColsNb(), k = bOuter ? A.GetColsNb() : A.GetRowsNb();
+        assert(res.GetRowsNb() == n && res.GetColsNb() == n);
+        if (n == 0) return res;
+        constexpr bool bComplex = std::is_same_v<T, std::complex<float>> || std::is_same_v<T, std::complex<double>>;
+        const bool bHerm        = bComplex && !(flags & GRAM::TRANSPOSE);
+        char uplo = 'U', trans = bOuter ? 'N' : (bHerm ? 'C' : 'T');
+        int n_ = INT_C(n), k_ = INT_C(k), lda = INT_C(std::max(A.GetRowsNb(), SIZE_T_C(1))), ldc = n_;
+        T* a = const_cast<T*>(A.data().data());
+        T* c = res.data().data();
+        if constexpr (std::is_same_v<T, float>)
+        {
+            float alpha = 1, beta = 0;
+            ssyrk_(&uplo, &trans, &n_, &k_, &alpha, a, &lda, &beta, c, &ldc);
+        }
+        else if constexpr (std::is_same_v<T, double>)
+        {
+            double alpha = 1, beta = 0;
+            dsyrk_(&uplo, &trans, &n_, &k_, &alpha, a, &lda, &beta, c, &ldc);
+        }
+        else if constexpr (std::is_same_v<T, std::complex<float>>)
+        {
+            if (bHerm)
+            {
+                float alpha = 1, beta = 0;
+                cherk_(&uplo, &trans, &n_, &k_, &alpha, FLOAT_P_R(a), &lda, &beta, FLOAT_P_R(c), &ldc);
+            }
+            else
+            {
+                T alpha = 1, beta = 0;
+                csyrk_(&uplo, &trans, &n_, &k_, FLOAT_P_R(&alpha), FLOAT_P_R(a), &lda, FLOAT_P_R(&beta), FLOAT_P_R(c),
+                       &ldc);
+            }
+        }
+        else if constexpr (std::is_same_v<T, std::complex<double>>)
+        {
+            if (bHerm)
+            {
+                double alpha = 1, beta = 0;
+                zherk_(&uplo, &trans, &n_, &k_, &alpha, DOUBLE_P_R(a), &lda, &beta, DOUBLE_P_R(c), &ldc);
+            }
+            else
+            {
+                T alpha = 1, beta = 0;
+                zsyrk_(&uplo, &trans, &n_, &k_, DOUBLE_P_R(&alpha), DOUBLE_P_R(a), &lda, DOUBLE_P_R(&beta),
+                       DOUBLE_P_R(c), &ldc);
+            }
+        }
+        else { throw std::runtime_error("MatGram: type not supported"); }
+        if (flags & GRAM::UPPER) return res;
+        // mirror the upper triangle
+        for (size_t j = 0; j < n; ++j)
+            for (size_t i = j + 1; i < n; ++i)
+            {
+                if constexpr (bComplex) c[j * n + i] = bHerm ? std::conj(c[i * n + j]) : c[i * n + j];
+                else c[j * n + i] = c[i * n + j];
+            }
+        return res;
+    }
+
+    template <typename T> Matrix<T>& MatAtA(Matrix<T>& res, const Matrix<T>& A)
+    {
+        return MatGram(res, A, GRAM::TRANSPOSE);
+    }
+
+    template <typename T> Matrix<T>& MatOuter(Matrix<T>& res, const Matrix<T>& A, const Matrix<T>& B)
+    {
+        assert(res.GetRowsNb() == A.GetRowsNb());
+        assert(res.GetColsNb() == B.GetRowsNb());
+        assert(A.GetColsNb() == 1);
+        assert(B.GetColsNb() == 1);
+        // k = 1 product, overwrites res without a zero fill
+        const size_t m = A.GetRowsNb(), n = B.GetRowsNb();
+        Gemm('N', 'T', m, n, 1, T(1), A.data().data(), std::max(m, SIZE_T_C(1)), B.data().data(),
+             std::max(n, SIZE_T_C(1)), T(0), res.data().data(), std::max(m, SIZE_T_C(1)));
+        return res;
+    }
+
+    template <typename T>
+    Matrix<T>& MatOuterAdd(Matrix<T>& res, const Matrix<T>& A, const Matrix<T>& B, const T& alpha)
+    {
+        assert(res.GetRowsNb() == A.GetRowsNb());
+        assert(res.GetColsNb() == B.GetRowsNb());
+        assert(A.GetColsNb() == 1);
+        assert(B.GetColsNb() == 1);
+        int m = INT_C(A.GetRowsNb()), n = INT_C(B.GetRowsNb()), lda = std::max(m, 1), inc = 1;
+        if (m == 0 || n == 0) return res;
+        T alpha_ = alpha;
+        T *x = const_cast<T*>(A.data().data()), *y = const_cast<T*>(B.data().data()), *a = res.data().data();
+        if constexpr (std::is_same_v<T, float>) sger_(&m, &n, &alpha_, x, &inc, y, &inc, a, &lda);
+        else if constexpr (std::is_same_v<T, double>) dger_(&m, &n, &alpha_, x, &inc, y, &inc, a, &lda);
+        else if constexpr (std::is_same_v<T, std::complex<float>>)
+            cgeru_(&m, &n, FLOAT_P_R(&alpha_), FLOAT_P_R(x), &inc, FLOAT_P_R(y), &inc, FLOAT_P_R(a), &lda);
+        else if constexpr (std::is_same_v<T, std::complex<double>>)
+            zgeru_(&m, &n, DOUBLE_P_R(&alpha_), DOUBLE_P_R(x), &inc, DOUBLE_P_R(y), &inc, DOUBLE_P_R(a), &lda);
+        else { throw std::runtime_error("MatOuterAdd: type not supported"); }
+        return res;
+    }
+
+    template <typename T> T MatDot(const Matrix<T>& A, const Matrix<T>& B)
+    {
+        assert(A.GetColsNb() == 1);
+        assert(B.GetColsNb() == 1);
+        assert(A.GetRowsNb() == B.GetRowsNb());
+        int n = INT_C(A.GetRowsNb()), inc = 1;
+        T *x = const_cast<T*>(A.data().data()), *y = const_cast<T*>(B.data().data());
+        if constexpr (std::is_same_v<T, float>) return sdot_(&n, x, &inc, y, &inc);
+        else if constexpr (std::is_same_v<T, double>) return ddot_(&n, x, &inc, y, &inc);
+        else { throw std::runtime_error("MatDot: type not supported"); }
+    }
+
+    template <typename T> T MatDot(const Matrix<std::complex<T>>& A, const Matrix<std::complex<T>>& B)
+    {
+        assert(A.GetColsNb() == 1);
+        assert(B.GetColsNb() == 1);
+        assert(A.GetRowsNb() == B.GetRowsNb());
+        // Re(conj(a) * b) = Re(a) * Re(b) + Im(a) * Im(b), the complex dot functions are not used since their return
+        // convention differs between BLAS libraries
+        int n = 2 * INT_C(A.GetRowsNb()), inc = 1;
+        T* x = const_cast<T*>(reinterpret_cast<const T*>(A.data().data()));
+        T* y = const_cast<T*>(reinterpret_cast<const T*>(B.data().data()));
+        if constexpr (std::is_same_v<T, float>) return sdot_(&n, x, &inc, y, &inc);
+        else if constexpr (std::is_same_v<T, double>) return ddot_(&n, x, &inc, y, &inc);
+        else { throw std::runtime_error("MatDot: type not supported"); }
+    }
+
+    template <typename T> Matrix<T>& MatScal(Matrix<T>& A, const T& alpha)
+    {
+        int n = INT_C(A.size()), inc = 1;
+        T alpha_ = alpha;
+        T* x     = A.data().data();
+        if (n == 0) return A;
+        if constexpr (std::is_same_v<T, float>) sscal_(&n, &alpha_, x, &inc);
+        else if constexpr (std::is_same_v<T, double>) dscal_(&n, &alpha_, x, &inc);
+        else if constexpr (std::is_same_v<T, std::complex<float>>) cscal_(&n, FLOAT_P_R(&alpha_), FLOAT_P_R(x), &inc);
+        else if constexpr (std::is_same_v<T, std::complex<double>>)
+            zscal_(&n, DOUBLE_P_R(&alpha_), DOUBLE_P_R(x), &inc);
+        else { throw std::runtime_error("MatScal: type not supported"); }
+        return A;
+    }
+
+    template <typename T> Matrix<T>& MatAxpy(Matrix<T>& Y, const T& alpha, const Matrix<T>& X)
+    {
+        assert(X.size() == Y.size());
+        int n = INT_C(Y.size()), inc = 1;
+        if (n == 0) return Y;
+        T alpha_ = alpha;
+        T *x = const_cast<T*>(X.data().data()), *y = Y.data().data();
+        if constexpr (std::is_same_v<T, float>) saxpy_(&n, &alpha_, x, &inc, y, &inc);
+        else if constexpr (std::is_same_v<T, double>) daxpy_(&n, &alpha_, x, &inc, y, &inc);
+        else if constexpr (std::is_same_v<T, std::complex<float>>)
+            caxpy_(&n, FLOAT_P_R(&alpha_), FLOAT_P_R(x), &inc, FLOAT_P_R(y), &inc);
+        else if constexpr (std::is_same_v<T, std::complex<double>>)
+            zaxpy_(&n, DOUBLE_P_R(&alpha_), DOUBLE_P_R(x), &inc, DOUBLE_P_R(y), &inc);
+        else { throw std::runtime_error("MatAxpy: type not supported"); }
+        return Y;
+    }
+
 } // namespace la
 
 #undef CONST_DOUBLE_P_R
@@ -121,3 +376,38 @@ template la::Matrix<std::complex<float>>& la::MatMult(la::Matrix<std::complex<fl
 template la::Matrix<std::complex<double>>& la::MatMult(la::Matrix<std::complex<double>>& res,
                                                        const la::Matrix<std::complex<double>>& A,
                                                        const la::Matrix<std::complex<double>>& B);
+// MatDot returns the real part for complex types
+template float la::MatDot(const la::Matrix<float>& A, const la::Matrix<float>& B);
+template double la::MatDot(const la::Matrix<double>& A, const la::Matrix<double>& B);
+template float la::MatDot(const la::Matrix<std::complex<float>>& A, const la::Matrix<std::complex<float>>& B);
+template double la::MatDot(const la::Matrix<std::complex<double>>& A, const la::Matrix<std::complex<double>>& B);
+
+#define INSTANTIATE_BLAS_MULT_TEMPLATE(type)                                                                           \
+    template void la::Gemm<type>(const char&, const char&, const size_t&, const size_t&, const size_t&, const type&,   \
+                                 const type*, const size_t&, const type*, const size_t&, const type&, type*,           \
+                                 const size_t&);                                                                       \
+    template void la::Gemv<type>(const char&, const size_t&, const size_t&, const type&, const type*, const size_t&,   \
+                                 const type*, const size_t&, const type&, type*, const size_t&);                       \
+    template la::Matrix<type>& la::MatMultVec<type>(la::Matrix<type>&, const la::Matrix<type>&,                        \
+                                                    const la::Matrix<type>&, const int&);                              \
+    template la::Matrix<type>& la::MatMult<type>(la::Matrix<type>&, const la::Matrix<type>&, const la::Matrix<type>&,  \
+                                                 const int&);                                                          \
+    template la::Matrix<type>& la::MatGram<type>(la::Matrix<type>&, const la::Matrix<type>&, const int&);              \
+    template la::Matrix<type>& la::MatAtA<type>(la::Matrix<type>&, const la::Matrix<type>&);                           \
+    template la::Matrix<type>& la::MatOuter<type>(la::Matrix<type>&, const la::Matrix<type>&,                          \
+                                                  const la::Matrix<type>&);                                            \
+    template la::Matrix<type>& la::MatOuterAdd<type>(la::Matrix<type>&, const la::Matrix<type>&,                       \
+                                                     const la::Matrix<type>&, const type&);                            \
+    template la::Matrix<type>& la::MatScal<type>(la::Matrix<type>&, const type&);                                      \
+    template la::Matrix<type>& la::MatAxpy<type>(la::Matrix<type>&, const type&, const la::Matrix<type>&);
+
+#define INSTANTIATE_ALL_BLAS_MULT_TEMPLATES                                                                            \
+    INSTANTIATE_BLAS_MULT_TEMPLATE(float)                                                                              \
+    INSTANTIATE_BLAS_MULT_TEMPLATE(double)                                                                             \
+    INSTANTIATE_BLAS_MULT_TEMPLATE(std::complex<float>)                                                                \
+    INSTANTIATE_BLAS_MULT_TEMPLATE(std::complex<double>)
+
+INSTANTIATE_ALL_BLAS_MULT_TEMPLATES
+
+#undef INSTANTIATE_BLAS_MULT_TEMPLATE
+#undef INSTANTIATE_ALL_BLAS_MULT_TEMPLATES
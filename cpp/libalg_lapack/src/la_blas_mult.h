@@ -11,16 +11,123 @@
 #error "USE_BLAS is not defined"
 #endif
 
+#include <cassert>
+#include <complex>
+#include <vector>
+#include "la_blas_threads.h"
 #include "math/algebra/matrix.h"
 #include "math/algebra/matrix_operations.h"
 
 namespace la
 {
+    namespace MULT
+    {
+        enum Flags : int {
+            // use the transpose of A
+            A_T  = 1 << 0,
+            // use the conjugate transpose of A
+            A_HT = 1 << 1,
+            // use the transpose of B
+            B_T  = 1 << 2,
+            // use the conjugate transpose of B
+            B_HT = 1 << 3,
+        };
+    }
+
+    namespace GRAM
+    {
+        enum Flags : int {
+            // A * A^H (m x m) instead of A^H * A (n x n)
+            A_AH      = 1 << 0,
+            // transpose instead of conjugate transpose for complex types, the result is complex symmetric (?syrk)
+            TRANSPOSE = 1 << 1,
+            // only the upper triangle of the result is set, the strictly lower part is left untouched
+            UPPER     = 1 << 2,
+        };
+    }
+
+    // C = alpha * op(A) * op(B) + beta * C on column major arrays
+    // transa and transb are 'N', 'T' or 'C', op(A) is m x k, op(B) is k x n and C is m x n
+    template <typename T>
+    void Gemm(const char& transa, const char& transb, const size_t& m, const size_t& n, const size_t& k, const T& alpha,
+              const T* A, const size_t& lda, const T* B, const size_t& ldb, const T& beta, T* C, const size_t& ldc);
+
+    // y = alpha * op(A) * x + beta * y on column major arrays, trans is 'N', 'T' or 'C' and A is m x n
+    template <typename T>
+    void Gemv(const char& trans, const size_t& m, const size_t& n, const T& alpha, const T* A, const size_t& lda,
+              const T* x, const size_t& incx, const T& beta, T* y, const size_t& incy);
 
     template <typename T> Matrix<T>& MatMultVec(Matrix<T>& res, const Matrix<T>& A, const Matrix<T>& B);
 
+    // res = op(A) * B for the column vector B where op is selected by the MULT flags of A, no explicit transpose is
+    // formed
+    template <typename T>
+    Matrix<T>& MatMultVec(Matrix<T>& res, const Matrix<T>& A, const Matrix<T>& B, const int& flags);
+
     template <typename T> Matrix<T>& MatMult(Matrix<T>& res, const Matrix<T>& A, const Matrix<T>& B);
 
+    // res = op(A) * op(B) where op is selected by MULT flags, no explicit transpose is formed
+    template <typename T>
+    Matrix<T>& MatMult(Matrix<T>& res, const Matrix<T>& A, const Matrix<T>& B, const int& flags);
+
+    // res = A^H * A or A * A^H (GRAM flags) with ?syrk / ?herk, only one triangle is computed (half the flops of
+    // MatMult) and mirrored into the other one unless UPPER is set
+    template <typename T> Matrix<T>& MatGram(Matrix<T>& res, const Matrix<T>& A, const int& flags = 0);
+
+    // res = A^T * A (no conjugation for complex types as in matrix_operations.h) with ?syrk
+    template <typename T> Matrix<T>& MatAtA(Matrix<T>& res, const Matrix<T>& A);
+
+    // res = A * B^T for the column vectors A and B (no conjugation), res is overwritten
+    template <typename T> Matrix<T>& MatOuter(Matrix<T>& res, const Matrix<T>& A, const Matrix<T>& B);
+
+    // res += alpha * A * B^T for the column vectors A and B, rank-1 update of an existing matrix (?ger / ?geru)
+    template <typename T>
+    Matrix<T>& MatOuterAdd(Matrix<T>& res, const Matrix<T>& A, const Matrix<T>& B, const T& alpha = T(1));
+
+    // dot product of the column vectors A and B (?dot)
+    template <typename T> T MatDot(const Matrix<T>& A, const Matrix<T>& B);
+
+    // real part of A^H * B as in matrix_operations.h, the real dot product of the interleaved parts
+    template <typename T> T MatDot(const Matrix<std::complex<T>>& A, const Matrix<std::complex<T>>& B);
+
+    // A *= alpha (?scal)
+    template <typename T> Matrix<T>& MatScal(Matrix<T>& A, const T& alpha);
+
+    // Y += alpha * X (?axpy), X and Y have the same number of elements
+    template <typename T> Matrix<T>& MatAxpy(Matrix<T>& Y, const T& alpha, const Matrix<T>& X);
+
+    // res = A * diag(d), column j of A is scaled by d[j] in O(m * n) without forming the diagonal matrix.
+    // d may hold real values for a complex A, res may be A itself.
+    template <typename T, typename D>
+    inline Matrix<T>& MatMultDiag(Matrix<T>& res, const Matrix<T>& A, const std::vector<D>& d)
+    {
+        const size_t m = A.GetRowsNb(), n = A.GetColsNb();
+        assert(d.size() == n);
+        assert(res.GetRowsNb() == m && res.GetColsNb() == n);
+        const T* a = A.data().data();
+        T* r       = res.data().data();
+        for (size_t j = 0; j < n; ++j)
+        {
+            const T dj = static_cast<T>(d[j]);
+            for (size_t i = 0; i < m; ++i) r[j * m + i] = a[j * m + i] * dj;
+        }
+        return res;
+    }
+
+    // res = diag(d) * A, row i of A is scaled by d[i], res may be A itself
+    template <typename T, typename D>
+    inline Matrix<T>& MatDiagMult(Matrix<T>& res, const std::vector<D>& d, const Matrix<T>& A)
+    {
+        const size_t m = A.GetRowsNb(), n = A.GetColsNb();
+        assert(d.size() == m);
+        assert(res.GetRowsNb() == m && res.GetColsNb() == n);
+        const T* a = A.data().data();
+        T* r       = res.data().data();
+        for (size_t j = 0; j < n; ++j)
+            for (size_t i = 0; i < m; ++i) r[j * m + i] = static_cast<T>(d[i]) * a[j * m + i];
+        return res;
+    }
+
     template <typename T> inline Matrix<T> MatMultVec(const Matrix<T>& A, const Matrix<T>& B)
     {
         Matrix<T> res_{A.GetRowsNb(), 1};
@@ -33,6 +140,12 @@ namespace la
         return la::MatMult(res_, A, B);
     }
 
+    template <typename T> inline Matrix<T> MatOuter(const Matrix<T>& A, const Matrix<T>& B)
+    {
+        Matrix<T> res_{A.GetRowsNb(), B.GetRowsNb()};
+        return la::MatOuter(res_, A, B);
+    }
+
 } // namespace la
 
 #endif
@@ -0,0 +1,212 @@
+#ifndef _LA_BLAS_THREADS_H_BFEBBBE7B1374B208C01565D0E223759_
+#define _LA_BLAS_THREADS_H_BFEBBBE7B1374B208C01565D0E223759_
+
+/************************/
+/*  la_blas_threads.h   */
+/*    Version 1.0       */
+/*     2026/10/19       */
+/************************/
+
+#include <atomic>
+#include <mutex>
+
+// The threading entry points of the BLAS library are resolved at run time so the same binary works with OpenBLAS,
+// MKL, an OpenMP BLAS or the reference BLAS. Define USE_OPENBLAS or USE_MKL to call them directly instead, this is
+// required on Windows and when the BLAS library is linked statically.
+#if defined(USE_OPENBLAS)
+extern "C" void openblas_set_num_threads(int num_threads);
+extern "C" int openblas_get_num_threads(void);
+#elif defined(USE_MKL)
+extern "C" int MKL_Set_Num_Threads_Local(int nth);
+extern "C" int MKL_Get_Max_Threads(void);
+#elif !defined(_MSC_VER)
+#include <dlfcn.h>
+#endif
+
+namespace la
+{
+    namespace BLAS_THREADS
+    {
+        enum Backend : int {
+            // the thread count cannot be controlled (reference BLAS or unknown library)
+            NONE     = 0,
+            // openblas_set_num_threads, the setting is global to the process
+            OPENBLAS = 1,
+            // mkl_set_num_threads_local, the setting is local to the calling thread
+            MKL      = 2,
+            // omp_set_num_threads, the setting is local to the calling thread
+            OPENMP   = 3,
+        };
+    }
+
+    // threading entry points of the linked BLAS library, resolved once
+    struct BlasThreadsApi
+    {
+        int backend_              = BLAS_THREADS::NONE;
+        void (*openblasSet_)(int) = nullptr;
+        int (*openblasGet_)()     = nullptr;
+        int (*mklSetLocal_)(int)  = nullptr;
+        int (*mklGet_)()          = nullptr;
+        void (*ompSet_)(int)      = nullptr;
+        int (*ompGet_)()          = nullptr;
+    };
+
+    inline const BlasThreadsApi& BlasThreadsLib()
+    {
+        static const BlasThreadsApi api_ = []() {
+            BlasThreadsApi api;
+#if defined(USE_OPENBLAS)
+            api.openblasSet_ = &openblas_set_num_threads;
+            api.openblasGet_ = &openblas_get_num_threads;
+#elif defined(USE_MKL)
+            api.mklSetLocal_ = &MKL_Set_Num_Threads_Local;
+            api.mklGet_      = &MKL_Get_Max_Threads;
+#elif !defined(_MSC_VER)
+            api.mklSetLocal_ = reinterpret_cast<int (*)(int)>(dlsym(RTLD_DEFAULT, "MKL_Set_Num_Threads_Local"));
+            api.mklGet_      = reinterpret_cast<int (*)()>(dlsym(RTLD_DEFAULT, "MKL_Get_Max_Threads"));
+            api.openblasSet_ = reinterpret_cast<void (*)(int)>(dlsym(RTLD_DEFAULT, "openblas_set_num_threads"));
+            api.openblasGet_ = reinterpret_cast<int (*)()>(dlsym(RTLD_DEFAULT, "openblas_get_num_threads"));
+            api.ompSet_      = reinterpret_cast<void (*)(int)>(dlsym(RTLD_DEFAULT, "omp_set_num_threads"));
+            api.ompGet_      = reinterpret_cast<int (*)()>(dlsym(RTLD_DEFAULT, "omp_get_max_threads"));
+#endif
+            // MKL first since it may be loaded together with an OpenMP runtime
+            if (api.mklSetLocal_ && api.mklGet_) api.backend_ = BLAS_THREADS::MKL;
+            else if (api.openblasSet_ && api.openblasGet_) api.backend_ = BLAS_THREADS::OPENBLAS;
+            else if (api.ompSet_ && api.ompGet_) api.backend_ = BLAS_THREADS::OPENMP;
+            return api;
+        }();
+        return api_;
+    }
+
+    // threading backend of the linked BLAS library (BLAS_THREADS::Backend)
+    inline int BlasThreadsBackend() { return BlasThreadsLib().backend_; }
+
+    // number of threads used by the BLAS calls of the calling thread, 1 when it cannot be controlled
+    inline int BlasGetNumThreads()
+    {
+        const BlasThreadsApi& api_ = BlasThreadsLib();
+        switch (api_.backend_)
+        {
+        case BLAS_THREADS::OPENBLAS: return api_.openblasGet_();
+        case BLAS_THREADS::MKL: return api_.mklGet_();
+        case BLAS_THREADS::OPENMP: return api_.ompGet_();
+        default: return 1;
+        }
+    }
+
+    // set the number of BLAS threads (global with OpenBLAS, local to the calling thread with MKL and OpenMP),
+    // returns the previous setting which restores it when passed back (0 for MKL means the global setting)
+    inline int BlasSetNumThreads(const int& n)
+    {
+        const BlasThreadsApi& api_ = BlasThreadsLib();
+        int prev                   = 1;
+        switch (api_.backend_)
+        {
+        case BLAS_THREADS::OPENBLAS:
+            prev = api_.openblasGet_();
+            if (n > 0 && n != prev) api_.openblasSet_(n);
+            break;
+        case BLAS_THREADS::MKL: prev = api_.mklSetLocal_(n > 0 ? n : 0); break;
+        case BLAS_THREADS::OPENMP:
+            prev = api_.ompGet_();
+            if (n > 0 && n != prev) api_.ompSet_(n);
+            break;
+        default: break;
+        }
+        return prev;
+    }
+
+    // BLAS thread count for the lifetime of the object, the previous setting is restored on destruction
+    class BlasThreadsScope
+    {
+      public:
+        explicit BlasThreadsScope(const int& n) : prev_(BlasSetNumThreads(n)) {}
+
+        ~BlasThreadsScope() { BlasSetNumThreads(prev_); }
+
+        BlasThreadsScope(const BlasThreadsScope&)            = delete;
+        BlasThreadsScope& operator=(const BlasThreadsScope&) = delete;
+
+      private:
+        int prev_;
+    };
+
+    // when enabled (default) the BLAS and LAPACK calls made by the blocks of ParallelFor run single-threaded, the
+    // calls made outside of it keep the multithreaded setting of the library
+    inline std::atomic<bool>& BlasAutoThreads()
+    {
+        static std::atomic<bool> bAuto_{true};
+        return bAuto_;
+    }
+
+    // Held by the thread submitting ParallelFor blocks. A global (OpenBLAS) setting is reduced to one thread while
+    // at least one ParallelFor is running and restored when the last one ends.
+    class BlasPoolRegion
+    {
+      public:
+        BlasPoolRegion() : active_(BlasAutoThreads() && BlasThreadsBackend() == BLAS_THREADS::OPENBLAS)
+        {
+            if (!active_) return;
+            std::lock_guard<std::mutex> lock_(Mutex());
+            if (Count()++ == 0) Prev() = BlasSetNumThreads(1);
+        }
+
+        ~BlasPoolRegion()
+        {
+            if (!active_) return;
+            std::lock_guard<std::mutex> lock_(Mutex());
+            if (--Count() == 0) BlasSetNumThreads(Prev());
+        }
+
+        BlasPoolRegion(const BlasPoolRegion&)            = delete;
+        BlasPoolRegion& operator=(const BlasPoolRegion&) = delete;
+
+      private:
+        static std::mutex& Mutex()
+        {
+            static std::mutex mtx_;
+            return mtx_;
+        }
+
+        static int& Count()
+        {
+            static int count_ = 0;
+            return count_;
+        }
+
+        static int& Prev()
+        {
+            static int prev_ = 1;
+            return prev_;
+        }
+
+        bool active_;
+    };
+
+    // Held by a pool worker while it runs a block, a per-thread (MKL, OpenMP) setting is reduced to one thread.
+    class BlasPoolWorker
+    {
+      public:
+        BlasPoolWorker()
+            : active_(BlasAutoThreads() && (BlasThreadsBackend() == BLAS_THREADS::MKL ||
+                                            BlasThreadsBackend() == BLAS_THREADS::OPENMP)),
+              prev_(active_ ? BlasSetNumThreads(1) : 0)
+        {
+        }
+
+        ~BlasPoolWorker()
+        {
+            if (active_) BlasSetNumThreads(prev_);
+        }
+
+        BlasPoolWorker(const BlasPoolWorker&)            = delete;
+        BlasPoolWorker& operator=(const BlasPoolWorker&) = delete;
+
+      private:
+        bool active_;
+        int prev_;
+    };
+
+} // namespace la
+
+#endif
@@ -3,8 +3,8 @@
 
 /**********************/
 /* la_decomposition.h */
-/*      Version 3.0   */
-/*     2023/05/23     */
+/*      Version 3.1   */
+/*     2026/10/19     */
 /**********************/
 
 #ifdef USE_LAPACK
@@ -16,7 +16,14 @@
 #include <cmath>
 #include <complex>
 #include <iostream>
+#include <limits>
 #include <numeric>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+#ifdef USE_THREAD_POOL
+#include "la_thread_pool.h"
+#endif
 #include "math/algebra/matrix.h"
 #include "math/algebra/matrix_operations.h"
 
@@ -25,51 +32,331 @@
 namespace la
 {
 
-    // compute Gram-Schmidt orthogonalization
-    template <typename T> Matrix<T>& MatGramSchmidt(Matrix<T>& res, const Matrix<T>& A, const bool& decreasing = false)
+    // call f(begin, end, block) on [first, last), split in blocks on the library thread pool with USE_THREAD_POOL
+    // (see ParallelFor) and in a single call otherwise, so that the header has no dependency by default
+    template <typename F> inline void DecompositionFor(const size_t first, const size_t last, F&& f, size_t nBlocks)
     {
-        assert(res.GetRowsNb() == A.GetRowsNb());
-        assert(res.GetColsNb() == A.GetColsNb());
+#ifdef USE_THREAD_POOL
+        ParallelFor(first, last, std::forward<F>(f), nBlocks);
+#else
+        (void)nBlocks;
+        if (first < last) f(first, last, 0);
+#endif
+    }
 
-        Matrix<T> tmp{A.GetRowsNb(), A.GetColsNb()};
-        // copy the matrix A and reorder based on the  norm of column from the bigger
-        // to the smaller
-        std::vector<size_t> idx(A.GetColsNb());
-        std::iota(idx.begin(), idx.end(), 0);
-        if (decreasing)
+    // Householder reflector H = I - tau * v * v^T with H * x = (beta, 0, ..., 0)^T for x = QR(j : m, j).
+    // v(0) = 1 is implicit, v(1 : m - j) overwrites x(1 : m - j) and beta x(0) (as ?larfg).
+    template <typename T> inline T MatHouseholderVector(Matrix<T>& QR, const size_t& j)
+    {
+        const size_t m = QR.GetRowsNb();
+        T* x           = &QR.data()[j * m];
+        T xnorm        = 0;
+        for (size_t i = j + 1; i < m; ++i) xnorm += x[i] * x[i];
+        if (xnorm == T_C(0)) return 0;
+        const T alpha = x[j];
+        const T beta  = -std::copysign(std::sqrt(alpha * alpha + xnorm), alpha);
+        const T scal  = T_C(1) / (alpha - beta);
+        for (size_t i = j + 1; i < m; ++i) x[i] *= scal;
+        x[j] = beta;
+        return (beta - alpha) / beta;
+    }
+
+    // apply the reflector stored in column j of QR to column c of C (rows j to m - 1)
+    template <typename T>
+    inline void MatHouseholderApplyCol(Matrix<T>& C, const size_t& c, const Matrix<T>& QR, const size_t& j,
+                                       const T& tau)
+    {
+        const size_t m = QR.GetRowsNb();
+        const T* v     = &QR.data()[j * m];
+        T* y           = &C.data()[c * m];
+        T w            = y[j];
+        for (size_t i = j + 1; i < m; ++i) w += v[i] * y[i];
+        w *= tau;
+        y[j] -= w;
+        for (size_t i = j + 1; i < m; ++i) y[i] -= w * v[i];
+    }
+
+    // triangular factor Tm (jb x jb) of the block reflector H_j0 ... H_(j0 + jb - 1) = I - V * Tm * V^T (as ?larft)
+    template <typename T>
+    void MatHouseholderBlockT(std::vector<T>& Tm, const Matrix<T>& QR, const std::vector<T>& tau, const size_t& j0,
+                              const size_t& jb)
+    {
+        const size_t m = QR.GetRowsNb();
+        Tm.assign(jb * jb, T_C(0));
+        std::vector<T> w(jb);
+        for (size_t i = 0; i < jb; ++i)
         {
-            std::sort(idx.begin(), idx.end(), [&A](size_t i1, size_t i2) {
-                T sum1 = 0;
-                T sum2 = 0;
-                for (size_t i = 0; i < A.GetRowsNb(); ++i)
-                {
-                    sum1 += A(i, i1) * A(i, i1);
-                    sum2 += A(i, i2) * A(i, i2);
-                }
-                return sum1 > sum2;
-            });
+            const size_t ci = j0 + i;
+            // w = V(:, 0 : i)^T * v_i
+            for (size_t l = 0; l < i; ++l)
+            {
+                const T* vl = &QR.data()[(j0 + l) * m];
+                const T* vi = &QR.data()[ci * m];
+                T sum_      = vl[ci];
+                for (size_t r = ci + 1; r < m; ++r) sum_ += vl[r] * vi[r];
+                w[l] = sum_;
+            }
+            // Tm(0 : i, i) = -tau_i * Tm(0 : i, 0 : i) * w
+            for (size_t r = 0; r < i; ++r)
+            {
+                T sum_ = 0;
+                for (size_t l = r; l < i; ++l) sum_ += Tm[l * jb + r] * w[l];
+                Tm[i * jb + r] = -tau[ci] * sum_;
+            }
+            Tm[i * jb + i] = tau[ci];
         }
-        for (size_t i = 0; i < A.GetColsNb(); ++i)
-            for (size_t j = 0; j < A.GetRowsNb(); ++j) tmp(j, i) = A(j, idx[i]);
+    }
 
-        for (size_t i = 0; i < A.GetColsNb(); ++i)
+    // block reflector applied to the NC contiguous columns y of C, each element of V is loaded once for all of them.
+    // Vt is V (m - j0 x jb, unit diagonal, zero above) stored by rows so that V^T * y vectorizes over the reflectors.
+    template <size_t NC, typename T>
+    inline void MatHouseholderBlockApplyCols(T* y, const size_t& m, const T* V, const T* Vt, const std::vector<T>& Tm,
+                                             const size_t& j0, const size_t& jb, const bool& trans, T* w, T* u)
+    {
+        // w = V^T * y accumulated row by row from the row-major copy Vt of V
+        std::fill_n(w, NC * jb, T_C(0));
+        for (size_t r = j0; r < m; ++r)
         {
-            // copy the column
-            for (size_t j = 0; j < A.GetRowsNb(); ++j) res(j, i) = tmp(j, i);
-            // subtract the projection of the previous columns
-            for (size_t j = 0; j < i; ++j)
+            const T* vr = &Vt[(r - j0) * jb];
+            for (size_t c = 0; c < NC; ++c)
+            {
+                const T yr = y[c * m + r];
+                T* wc      = &w[c * jb];
+                for (size_t l = 0; l < jb; ++l) wc[l] += vr[l] * yr;
+            }
+        }
+        // u = Tm * w or Tm^T * w
+        for (size_t c = 0; c < NC; ++c)
+            for (size_t r = 0; r < jb; ++r)
             {
                 T sum_ = 0;
-                for (size_t k = 0; k < A.GetRowsNb(); ++k) sum_ += tmp(k, i) * res(k, j);
-                for (size_t k = 0; k < A.GetRowsNb(); ++k) res(k, i) -= sum_ * res(k, j);
+                if (trans)
+                    for (size_t l = 0; l <= r; ++l) sum_ += Tm[r * jb + l] * w[c * jb + l];
+                else
+                    for (size_t l = r; l < jb; ++l) sum_ += Tm[l * jb + r] * w[c * jb + l];
+                u[c * jb + r] = sum_;
+            }
+        // y -= V * u
+        for (size_t l = 0; l < jb; ++l)
+        {
+            const size_t cl = j0 + l;
+            const T* vl     = &V[cl * m];
+            T ul[NC];
+            for (size_t c = 0; c < NC; ++c)
+            {
+                ul[c] = u[c * jb + l];
+                y[c * m + cl] -= ul[c];
+            }
+            for (size_t r = cl + 1; r < m; ++r)
+                for (size_t c = 0; c < NC; ++c) y[c * m + r] -= ul[c] * vl[r];
+        }
+    }
+
+    // C(:, c0 : c1) = (I - V * Tm * V^T) * C(:, c0 : c1), or the transpose of the block reflector with trans,
+    // V holds the reflectors of columns j0 to j0 + jb - 1 of QR. The columns are updated by groups of 4, in parallel
+    // with USE_THREAD_POOL.
+    template <typename T>
+    void MatHouseholderBlockApply(Matrix<T>& C, const size_t& c0, const size_t& c1, const Matrix<T>& QR,
+                                  const std::vector<T>& Tm, const size_t& j0, const size_t& jb, const bool& trans)
+    {
+        constexpr size_t nc = 4;
+        const size_t m      = QR.GetRowsNb();
+        const size_t nGrp   = (c1 - c0 + nc - 1) / nc;
+        const T* V          = QR.data().data();
+        std::vector<T> Vt((m - j0) * jb, T_C(0));
+        for (size_t l = 0; l < jb; ++l)
+        {
+            Vt[l * jb + l] = 1;
+            for (size_t r = j0 + l + 1; r < m; ++r) Vt[(r - j0) * jb + l] = V[(j0 + l) * m + r];
+        }
+        // enough work per block to amortize the scheduling
+        const size_t nBlocks = (c1 - c0) * (m - j0) * jb < 65536 ? 1 : 0;
+        DecompositionFor(
+            0, nGrp,
+            [&](const size_t begin, const size_t end, size_t) {
+                std::vector<T> w(nc * jb), u(nc * jb);
+                for (size_t g = begin; g < end; ++g)
+                {
+                    const size_t c = c0 + g * nc;
+                    T* y           = &C.data()[c * m];
+                    if (c + nc <= c1)
+                        MatHouseholderBlockApplyCols<nc>(y, m, V, Vt.data(), Tm, j0, jb, trans, w.data(), u.data());
+                    else
+                        for (size_t cc = c; cc < c1; ++cc)
+                            MatHouseholderBlockApplyCols<1>(&C.data()[cc * m], m, V, Vt.data(), Tm, j0, jb, trans,
+                                                            w.data(), u.data());
+                }
+            },
+            nBlocks);
+    }
+
+    // Householder QR factorization A = Q * R in compact form (as ?geqrf), R is stored on and above the diagonal of QR
+    // and the reflectors below it, tau holds their min(m, n) scalar factors.
+    // Blocked algorithm, panels of nb columns are factorized with Householder vectors and the trailing matrix is
+    // updated with the compact WY representation I - V * Tm * V^T of the panel, in parallel over its columns with
+    // USE_THREAD_POOL.
+    template <typename T>
+    Matrix<T>& MatQRFactor(Matrix<T>& QR, std::vector<T>& tau, const Matrix<T>& A, const size_t& nb = 32)
+    {
+        const size_t m = A.GetRowsNb(), n = A.GetColsNb(), k = std::min(m, n);
+        QR             = A;
+        tau.assign(k, T_C(0));
+        std::vector<T> Tm;
+        for (size_t j0 = 0; j0 < k; j0 += std::max<size_t>(nb, 1))
+        {
+            const size_t jb = std::min(std::max<size_t>(nb, 1), k - j0);
+            // unblocked panel factorization
+            for (size_t j = j0; j < j0 + jb; ++j)
+            {
+                tau[j] = MatHouseholderVector(QR, j);
+                if (tau[j] != T_C(0))
+                    for (size_t c = j + 1; c < j0 + jb; ++c) MatHouseholderApplyCol(QR, c, QR, j, tau[j]);
+            }
+            // trailing matrix update C = H^T * C
+            if (j0 + jb < n)
+            {
+                MatHouseholderBlockT(Tm, QR, tau, j0, jb);
+                MatHouseholderBlockApply(QR, j0 + jb, n, QR, Tm, j0, jb, true);
             }
-            // normalize the column
+        }
+        return QR;
+    }
+
+    // Householder QR factorization with column pivoting A(:, piv) = Q * R (as ?geqp3), the column of largest
+    // remaining norm is selected at each step. The column norms are computed once and downdated after each
+    // reflector, they are only recomputed when cancellation makes the downdate inaccurate.
+    template <typename T>
+    Matrix<T>& MatQRFactorPivot(Matrix<T>& QR, std::vector<T>& tau, std::vector<size_t>& piv, const Matrix<T>& A)
+    {
+        const size_t m = A.GetRowsNb(), n = A.GetColsNb(), k = std::min(m, n);
+        QR             = A;
+        tau.assign(k, T_C(0));
+        piv.resize(n);
+        std::iota(piv.begin(), piv.end(), 0);
+        auto colNorm = [&QR, m](const size_t& j, const size_t& i0) {
             T sum_ = 0;
-            for (size_t k = 0; k < A.GetRowsNb(); ++k) sum_ += res(k, i) * res(k, i);
-            sum_ = sqrt(sum_);
-            if (sum_ != T_C(0))
-                for (size_t k = 0; k < A.GetRowsNb(); ++k) res(k, i) /= sum_;
+            for (size_t i = i0; i < m; ++i) sum_ += QR(i, j) * QR(i, j);
+            return std::sqrt(sum_);
+        };
+        // partial (vn1) and reference (vn2) column norms
+        std::vector<T> vn1(n), vn2(n);
+        for (size_t j = 0; j < n; ++j) vn1[j] = vn2[j] = colNorm(j, 0);
+        const T tol3z = std::sqrt(std::numeric_limits<T>::epsilon());
+        for (size_t j = 0; j < k; ++j)
+        {
+            const size_t p = static_cast<size_t>(std::max_element(vn1.begin() + j, vn1.end()) - vn1.begin());
+            if (p != j)
+            {
+                std::swap_ranges(&QR.data()[p * m], &QR.data()[p * m] + m, &QR.data()[j * m]);
+                std::swap(piv[p], piv[j]);
+                vn1[p] = vn1[j];
+                vn2[p] = vn2[j];
+            }
+            tau[j] = MatHouseholderVector(QR, j);
+            if (tau[j] != T_C(0))
+            {
+                const size_t nBlocks = (n - j) * (m - j) < 65536 ? 1 : 0;
+                DecompositionFor(
+                    j + 1, n,
+                    [&](const size_t begin, const size_t end, size_t) {
+                        for (size_t c = begin; c < end; ++c) MatHouseholderApplyCol(QR, c, QR, j, tau[j]);
+                    },
+                    nBlocks);
+            }
+            for (size_t c = j + 1; c < n; ++c)
+            {
+                if (vn1[c] == T_C(0)) continue;
+                T temp = std::abs(QR(j, c)) / vn1[c];
+                temp   = std::max(T_C(0), (T_C(1) + temp) * (T_C(1) - temp));
+                if (temp * (vn1[c] / vn2[c]) * (vn1[c] / vn2[c]) <= tol3z)
+                {
+                    vn1[c] = colNorm(c, j + 1);
+                    vn2[c] = vn1[c];
+                }
+                else vn1[c] *= std::sqrt(temp);
+            }
+        }
+        return QR;
+    }
+
+    // form the first Q.GetColsNb() columns of Q = H_0 * H_1 ... H_(k - 1) from a compact factorization (as ?orgqr)
+    template <typename T>
+    Matrix<T>& MatQRFormQ(Matrix<T>& Q, const Matrix<T>& QR, const std::vector<T>& tau, const size_t& nb = 32)
+    {
+        const size_t m = QR.GetRowsNb(), qc = Q.GetColsNb(), k = std::min(tau.size(), qc);
+        assert(Q.GetRowsNb() == m);
+        assert(qc <= m);
+        Q.Zeros();
+        for (size_t i = 0; i < qc; ++i) Q(i, i) = 1;
+        if (k == 0) return Q;
+        // apply the block reflectors backward, each only touches Q(j0 : m, j0 : qc)
+        std::vector<T> Tm;
+        const size_t bs = std::max<size_t>(nb, 1);
+        for (size_t j0 = ((k - 1) / bs) * bs;; j0 -= bs)
+        {
+            const size_t jb = std::min(bs, k - j0);
+            MatHouseholderBlockT(Tm, QR, tau, j0, jb);
+            MatHouseholderBlockApply(Q, j0, qc, QR, Tm, j0, jb, false);
+            if (j0 == 0) break;
         }
+        return Q;
+    }
+
+    // thin factors Q (m x n) and R (n x n) from the compact factorization, the diagonal of R is made non negative.
+    // When m < n the trailing columns of Q and rows of R are zero.
+    template <typename T>
+    void MatQRExpand(Matrix<T>& Q, Matrix<T>& R, const Matrix<T>& QR, const std::vector<T>& tau)
+    {
+        const size_t m = QR.GetRowsNb(), n = QR.GetColsNb(), k = std::min(m, n);
+        assert(Q.GetRowsNb() == m && Q.GetColsNb() == n);
+        assert(R.GetRowsNb() == n && R.GetColsNb() == n);
+        Matrix<T> Qk{m, k};
+        MatQRFormQ(Qk, QR, tau);
+        Q.Zeros();
+        R.Zeros();
+        std::copy_n(Qk.data().begin(), m * k, Q.data().begin());
+        for (size_t j = 0; j < n; ++j)
+            for (size_t i = 0; i < std::min(j + 1, k); ++i) R(i, j) = QR(i, j);
+        for (size_t i = 0; i < k; ++i)
+            if (R(i, i) < T_C(0))
+            {
+                for (size_t j = i; j < n; ++j) R(i, j) = -R(i, j);
+                for (size_t r = 0; r < m; ++r) Q(r, i) = -Q(r, i);
+            }
+    }
+
+    // orthonormal basis of the columns of A processed from the bigger to the smaller remaining norm (column
+    // pivoting), res spans the columns A(:, piv[0]), A(:, piv[1]), ... in this order
+    template <typename T> Matrix<T>& MatGramSchmidt(Matrix<T>& res, std::vector<size_t>& piv, const Matrix<T>& A)
+    {
+        assert(res.GetRowsNb() == A.GetRowsNb());
+        assert(res.GetColsNb() == A.GetColsNb());
+        Matrix<T> R{A.GetColsNb(), A.GetColsNb()};
+        Matrix<T> QR{A.GetRowsNb(), A.GetColsNb()};
+        std::vector<T> tau;
+        MatQRFactorPivot(QR, tau, piv, A);
+        MatQRExpand(res, R, QR, tau);
+        return res;
+    }
+
+    // compute an orthonormal basis of the columns of A with a Householder QR factorization, it matches the
+    // Gram-Schmidt orthogonalization of the columns in exact arithmetic when A has full column rank.
+    // With decreasing the columns are processed from the bigger to the smaller remaining norm (column pivoting),
+    // use the overload with piv to know their order.
+    template <typename T> Matrix<T>& MatGramSchmidt(Matrix<T>& res, const Matrix<T>& A, const bool& decreasing = false)
+    {
+        assert(res.GetRowsNb() == A.GetRowsNb());
+        assert(res.GetColsNb() == A.GetColsNb());
+        if (decreasing)
+        {
+            std::vector<size_t> piv;
+            return MatGramSchmidt(res, piv, A);
+        }
+        Matrix<T> R{A.GetColsNb(), A.GetColsNb()};
+        Matrix<T> QR{A.GetRowsNb(), A.GetColsNb()};
+        std::vector<T> tau;
+        MatQRFactor(QR, tau, A);
+        MatQRExpand(res, R, QR, tau);
         return res;
     }
 
@@ -79,42 +366,40 @@ namespace la
         return MatGramSchmidt(res, A);
     }
 
-    // compute the QR decomposition
-    // a = q * r
+    // thin QR decomposition with column pivoting by norm, a(:, piv) = q * r (see MatQRFactorPivot)
+    template <typename T>
+    Matrix<T>& MatQR(Matrix<T>& Q, Matrix<T>& R, std::vector<size_t>& piv, const Matrix<T>& A)
+    {
+        assert(Q.GetRowsNb() == A.GetRowsNb());
+        assert(Q.GetColsNb() == A.GetColsNb());
+        assert(R.GetRowsNb() == A.GetColsNb());
+        assert(R.GetColsNb() == A.GetColsNb());
+        Matrix<T> QR{A.GetRowsNb(), A.GetColsNb()};
+        std::vector<T> tau;
+        MatQRFactorPivot(QR, tau, piv, A);
+        MatQRExpand(Q, R, QR, tau);
+        return Q;
+    }
+
+    // compute the thin QR decomposition with blocked Householder reflectors
+    // a = q * r with q m x n and r n x n upper triangular with a non negative diagonal
+    // with decreasing the columns are pivoted by norm, use the overload with piv to get the permutation
     template <typename T>
     Matrix<T>& MatQR(Matrix<T>& Q, Matrix<T>& R, const Matrix<T>& A, const bool& decreasing = false)
     {
         assert(Q.GetRowsNb() == A.GetRowsNb());
-        assert(Q.GetColsNb() == A.GetRowsNb());
+        assert(Q.GetColsNb() == A.GetColsNb());
         assert(R.GetRowsNb() == A.GetColsNb());
         assert(R.GetColsNb() == A.GetColsNb());
-        // compute the Gram-Schmidt orthogonalization
-        MatGramSchmidt(Q, A, decreasing);
-        // q is order by the norm of the column from the bigger to the smaller
-        // compute the norm of the columns and order it
-        std::vector<size_t> idx(A.GetColsNb());
-        std::iota(idx.begin(), idx.end(), 0);
         if (decreasing)
         {
-            std::sort(idx.begin(), idx.end(), [&A](size_t i1, size_t i2) {
-                T sum1 = 0;
-                T sum2 = 0;
-                for (size_t i = 0; i < A.GetRowsNb(); ++i)
-                {
-                    sum1 += A(i, i1) * A(i, i1);
-                    sum2 += A(i, i2) * A(i, i2);
-                }
-                return sum1 > sum2;
-            });
+            std::vector<size_t> piv;
+            return MatQR(Q, R, piv, A);
         }
-        // compute the R matrix using the ordered columns (if decreasing is true) or the original columns
-        for (size_t i = 0; i < A.GetColsNb(); ++i)
-            for (size_t j = 0; j <= i; ++j)
-            {
-                T sum_ = 0;
-                for (size_t k = 0; k < A.GetRowsNb(); ++k) sum_ += A(k, idx[i]) * Q(k, j);
-                R(j, i) = sum_;
-            }
+        Matrix<T> QR{A.GetRowsNb(), A.GetColsNb()};
+        std::vector<T> tau;
+        MatQRFactor(QR, tau, A);
+        MatQRExpand(Q, R, QR, tau);
         return Q;
     }
 
@@ -179,28 +464,364 @@ namespace la
         return res;
     }
 
+    // Householder reduction to upper Hessenberg form, A = Q * H * Q^T
+    // pV, when not null, receives the orthogonal matrix Q
+    template <typename T> Matrix<T>& MatHessenberg(Matrix<T>& H, const Matrix<T>& A, Matrix<T>* pV = nullptr)
+    {
+        assert(A.GetRowsNb() == A.GetColsNb());
+        const size_t n = A.GetRowsNb();
+        H              = A;
+        if (pV)
+        {
+            *pV = Matrix<T>(n, n);
+            pV->Eyes();
+        }
+        std::vector<T> v(n);
+        for (size_t k = 0; k + 2 < n; ++k)
+        {
+            // reflector P = I - beta * v * v^T zeroing H(k + 2 : n, k)
+            T alpha = 0;
+            for (size_t i = k + 1; i < n; ++i) alpha += H(i, k) * H(i, k);
+            alpha = std::sqrt(alpha);
+            if (alpha == T_C(0)) continue;
+            if (H(k + 1, k) > T_C(0)) alpha = -alpha;
+            T vnorm = 0;
+            for (size_t i = k + 1; i < n; ++i)
+            {
+                v[i] = H(i, k);
+                if (i == k + 1) v[i] -= alpha;
+                vnorm += v[i] * v[i];
+            }
+            if (vnorm == T_C(0)) continue;
+            const T beta = T_C(2) / vnorm;
+            // H = P * H * P
+            for (size_t j = k; j < n; ++j)
+            {
+                T s_ = 0;
+                for (size_t i = k + 1; i < n; ++i) s_ += v[i] * H(i, j);
+                s_ *= beta;
+                for (size_t i = k + 1; i < n; ++i) H(i, j) -= s_ * v[i];
+            }
+            for (size_t i = 0; i < n; ++i)
+            {
+                T s_ = 0;
+                for (size_t j = k + 1; j < n; ++j) s_ += H(i, j) * v[j];
+                s_ *= beta;
+                for (size_t j = k + 1; j < n; ++j) H(i, j) -= s_ * v[j];
+            }
+            H(k + 1, k) = alpha;
+            for (size_t i = k + 2; i < n; ++i) H(i, k) = 0;
+            // Q = Q * P
+            if (pV)
+                for (size_t i = 0; i < n; ++i)
+                {
+                    T s_ = 0;
+                    for (size_t j = k + 1; j < n; ++j) s_ += (*pV)(i, j) * v[j];
+                    s_ *= beta;
+                    for (size_t j = k + 1; j < n; ++j) (*pV)(i, j) -= s_ * v[j];
+                }
+        }
+        return H;
+    }
+
+    // reflector I - beta * v * v^T applied on the left to rows k, k + 1 (, k + 2) of H, columns c0 to c1 - 1,
+    // and on the right to the same columns of H, rows r0 to r1 - 1, and of pV
+    template <typename T>
+    inline void MatHouseholderApply(Matrix<T>& H, Matrix<T>* pV, const size_t& k, const size_t& nv, const T* v,
+                                    const T& beta, const size_t& c0, const size_t& c1, const size_t& r0,
+                                    const size_t& r1)
+    {
+        for (size_t j = c0; j < c1; ++j)
+        {
+            T s_ = 0;
+            for (size_t i = 0; i < nv; ++i) s_ += v[i] * H(k + i, j);
+            s_ *= beta;
+            for (size_t i = 0; i < nv; ++i) H(k + i, j) -= s_ * v[i];
+        }
+        for (size_t i = r0; i < r1; ++i)
+        {
+            T s_ = 0;
+            for (size_t j = 0; j < nv; ++j) s_ += H(i, k + j) * v[j];
+            s_ *= beta;
+            for (size_t j = 0; j < nv; ++j) H(i, k + j) -= s_ * v[j];
+        }
+        if (pV)
+            for (size_t i = 0; i < pV->GetRowsNb(); ++i)
+            {
+                T s_ = 0;
+                for (size_t j = 0; j < nv; ++j) s_ += (*pV)(i, k + j) * v[j];
+                s_ *= beta;
+                for (size_t j = 0; j < nv; ++j) (*pV)(i, k + j) -= s_ * v[j];
+            }
+    }
+
+    // split the 2 x 2 diagonal block at (i, i) of the quasi-triangular H with a rotation when its eigenvalues are real
+    template <typename T> inline void MatSchurSplit2x2(Matrix<T>& H, Matrix<T>* pV, const size_t& i)
+    {
+        const size_t n = H.GetRowsNb();
+        const T a = H(i, i), b = H(i, i + 1), c = H(i + 1, i), d = H(i + 1, i + 1);
+        const T p = (a - d) / T_C(2), disc = p * p + b * c;
+        if (c == T_C(0) || disc < T_C(0)) return;
+        // the first column of the rotation is an eigenvector of the block
+        const T lambda = (a + d) / T_C(2) + std::copysign(std::sqrt(disc), p);
+        T x = b, y = lambda - a;
+        if (std::abs(lambda - d) + std::abs(c) > std::abs(x) + std::abs(y))
+        {
+            x = lambda - d;
+            y = c;
+        }
+        const T r = std::hypot(x, y);
+        if (r == T_C(0)) return;
+        const T cs = x / r, sn = y / r;
+        // H = G^T * H * G with G = [cs -sn; sn cs]
+        for (size_t j = i; j < n; ++j)
+        {
+            const T h1 = H(i, j), h2 = H(i + 1, j);
+            H(i, j)     = cs * h1 + sn * h2;
+            H(i + 1, j) = cs * h2 - sn * h1;
+        }
+        for (size_t k = 0; k < i + 2; ++k)
+        {
+            const T h1 = H(k, i), h2 = H(k, i + 1);
+            H(k, i)     = cs * h1 + sn * h2;
+            H(k, i + 1) = cs * h2 - sn * h1;
+        }
+        if (pV)
+            for (size_t k = 0; k < n; ++k)
+            {
+                const T v1 = (*pV)(k, i), v2 = (*pV)(k, i + 1);
+                (*pV)(k, i)     = cs * v1 + sn * v2;
+                (*pV)(k, i + 1) = cs * v2 - sn * v1;
+            }
+        H(i + 1, i) = 0;
+    }
+
+    // Real Schur form A = V * S * V^T with S quasi upper triangular, 2 x 2 diagonal blocks hold complex pairs.
+    // Householder reduction to Hessenberg form followed by the implicit double shift (Francis) QR iteration with
+    // deflation, pV when not null receives the Schur vectors.
+    template <typename T> Matrix<T>& MatSchur(Matrix<T>& S, const Matrix<T>& A, Matrix<T>* pV = nullptr)
+    {
+        assert(A.GetRowsNb() == A.GetColsNb());
+        const size_t n = A.GetRowsNb();
+        MatHessenberg(S, A, pV);
+        if (n < 2) return S;
+        const T eps = std::numeric_limits<T>::epsilon();
+        T anorm     = 0;
+        for (size_t j = 0; j < n; ++j)
+            for (size_t i = 0; i < std::min(j + 2, n); ++i) anorm = std::max(anorm, std::abs(S(i, j)));
+        // active window S(l : p + 1, l : p + 1)
+        size_t p = n - 1, iter = 0;
+        T v[3];
+        while (p > 0)
+        {
+            size_t l = p;
+            for (; l > 0; --l)
+            {
+                T s_ = std::abs(S(l - 1, l - 1)) + std::abs(S(l, l));
+                if (s_ == T_C(0)) s_ = anorm;
+                if (std::abs(S(l, l - 1)) <= eps * s_)
+                {
+                    S(l, l - 1) = 0;
+                    break;
+                }
+            }
+            if (l == p)
+            {
+                // 1 x 1 block converged
+                --p;
+                iter = 0;
+                continue;
+            }
+            if (l + 1 == p)
+            {
+                // 2 x 2 block converged
+                MatSchurSplit2x2(S, pV, l);
+                p    = l > 0 ? l - 1 : 0;
+                iter = 0;
+                continue;
+            }
+            if (++iter > 30 * std::max<size_t>(n, 10))
+                throw std::runtime_error("MatSchur: QR iteration failed to converge");
+            // shifts from the trailing 2 x 2 block, exceptional shifts every 10 iterations
+            T sh = S(p - 1, p - 1) + S(p, p), th = S(p - 1, p - 1) * S(p, p) - S(p - 1, p) * S(p, p - 1);
+            if (iter % 10 == 0)
+            {
+                const T w = std::abs(S(p, p - 1)) + std::abs(S(p - 1, p - 2));
+                sh        = T_C(1.5) * w;
+                th        = w * w;
+            }
+            // first column of (S - s1 * I) * (S - s2 * I)
+            T x = S(l, l) * S(l, l) + S(l, l + 1) * S(l + 1, l) - sh * S(l, l) + th;
+            T y = S(l + 1, l) * (S(l, l) + S(l + 1, l + 1) - sh);
+            T z = S(l + 1, l) * S(l + 2, l + 1);
+            for (size_t k = l; k + 1 < p; ++k)
+            {
+                // chase the bulge with 3 x 3 reflectors
+                T alpha = std::sqrt(x * x + y * y + z * z);
+                if (alpha != T_C(0))
+                {
+                    if (x > T_C(0)) alpha = -alpha;
+                    v[0]         = x - alpha;
+                    v[1]         = y;
+                    v[2]         = z;
+                    const T beta = T_C(2) / (v[0] * v[0] + v[1] * v[1] + v[2] * v[2]);
+                    MatHouseholderApply(S, pV, k, 3, v, beta, k > l ? k - 1 : l, n, 0, std::min(k + 4, p + 1));
+                    if (k > l)
+                    {
+                        S(k, k - 1)     = alpha;
+                        S(k + 1, k - 1) = 0;
+                        S(k + 2, k - 1) = 0;
+                    }
+                }
+                x = S(k + 1, k);
+                y = S(k + 2, k);
+                if (k + 2 < p) z = S(k + 3, k);
+            }
+            // last 2 x 2 reflector on rows p - 1 and p
+            T alpha = std::sqrt(x * x + y * y);
+            if (alpha != T_C(0))
+            {
+                if (x > T_C(0)) alpha = -alpha;
+                v[0]         = x - alpha;
+                v[1]         = y;
+                const T beta = T_C(2) / (v[0] * v[0] + v[1] * v[1]);
+                MatHouseholderApply(S, pV, p - 1, 2, v, beta, p - 2, n, 0, p + 1);
+                S(p - 1, p - 2) = alpha;
+                S(p, p - 2)     = 0;
+            }
+        }
+        return S;
+    }
+
+    // Eigenvalues (ascending) and eigenvectors of a real symmetric matrix.
+    // Householder tridiagonalization followed by the implicit QL iteration with Wilkinson shifts.
+    template <typename T> std::vector<T>& MatEigenSym(std::vector<T>& E, Matrix<T>* pV, const Matrix<T>& A)
+    {
+        assert(A.GetRowsNb() == A.GetColsNb());
+        const int n = static_cast<int>(A.GetRowsNb());
+        Matrix<T> Tri{A.GetRowsNb(), A.GetColsNb()};
+        // the Hessenberg form of a symmetric matrix is tridiagonal
+        MatHessenberg(Tri, A, pV);
+        std::vector<T> e(A.GetRowsNb(), T_C(0));
+        E.resize(A.GetRowsNb());
+        for (int i = 0; i < n; ++i)
+        {
+            E[static_cast<size_t>(i)] = Tri(static_cast<size_t>(i), static_cast<size_t>(i));
+            if (i + 1 < n) e[static_cast<size_t>(i)] = Tri(static_cast<size_t>(i + 1), static_cast<size_t>(i));
+        }
+        const T eps = std::numeric_limits<T>::epsilon();
+        auto d      = [&E](int i) -> T& { return E[static_cast<size_t>(i)]; };
+        auto f      = [&e](int i) -> T& { return e[static_cast<size_t>(i)]; };
+        for (int l = 0; l < n; ++l)
+        {
+            int iter = 0, m;
+            do
+            {
+                for (m = l; m < n - 1; ++m)
+                {
+                    const T dd = std::abs(d(m)) + std::abs(d(m + 1));
+                    if (std::abs(f(m)) <= eps * dd) break;
+                }
+                if (m != l)
+                {
+                    if (iter++ == 30 * std::max(n, 10))
+                        throw std::runtime_error("MatEigenSym: QL iteration failed to converge");
+                    T g = (d(l + 1) - d(l)) / (T_C(2) * f(l));
+                    T r = std::hypot(g, T_C(1));
+                    g   = d(m) - d(l) + f(l) / (g + std::copysign(r, g));
+                    T s = 1, c = 1, p = 0;
+                    int i;
+                    for (i = m - 1; i >= l; --i)
+                    {
+                        T ff = s * f(i), b = c * f(i);
+                        r        = std::hypot(ff, g);
+                        f(i + 1) = r;
+                        if (r == T_C(0))
+                        {
+                            // underflow, restart from the split
+                            d(i + 1) -= p;
+                            f(m) = 0;
+                            break;
+                        }
+                        s        = ff / r;
+                        c        = g / r;
+                        g        = d(i + 1) - p;
+                        r        = (d(i) - g) * s + T_C(2) * c * b;
+                        p        = s * r;
+                        d(i + 1) = g + p;
+                        g        = c * r - b;
+                        if (pV)
+                            for (size_t k = 0; k < A.GetRowsNb(); ++k)
+                            {
+                                T& v1      = (*pV)(k, static_cast<size_t>(i));
+                                T& v2      = (*pV)(k, static_cast<size_t>(i + 1));
+                                const T tv = v2;
+                                v2         = s * v1 + c * tv;
+                                v1         = c * v1 - s * tv;
+                            }
+                    }
+                    if (r == T_C(0) && i >= l) continue;
+                    d(l) -= p;
+                    f(l) = g;
+                    f(m) = 0;
+                }
+            } while (m != l);
+        }
+        // sort in ascending order
+        std::vector<size_t> idx(E.size());
+        std::iota(idx.begin(), idx.end(), 0);
+        std::sort(idx.begin(), idx.end(), [&E](size_t i1, size_t i2) { return E[i1] < E[i2]; });
+        std::vector<T> Es(E.size());
+        for (size_t i = 0; i < idx.size(); ++i) Es[i] = E[idx[i]];
+        E = Es;
+        if (pV)
+        {
+            Matrix<T> Vs{pV->GetRowsNb(), pV->GetColsNb()};
+            for (size_t j = 0; j < idx.size(); ++j)
+                for (size_t i = 0; i < Vs.GetRowsNb(); ++i) Vs(i, j) = (*pV)(i, idx[j]);
+            *pV = Vs;
+        }
+        return E;
+    }
+
+    template <typename T> inline bool MatIsSymmetric(const Matrix<T>& A)
+    {
+        for (size_t j = 0; j < A.GetColsNb(); ++j)
+            for (size_t i = j + 1; i < A.GetRowsNb(); ++i)
+                if (A(i, j) != A(j, i)) return false;
+        return true;
+    }
+
+    // eigenvalues of A on the diagonal of res. For a symmetric matrix res is diagonal with the eigenvalues in
+    // decreasing magnitude, the order the unshifted QR iteration converged to. Otherwise res is the real Schur form of
+    // A (see MatSchur) and the eigenvalues are in the order of the deflation, they are not sorted.
+    // decreasing is kept for compatibility, it has no effect
     template <typename T> Matrix<T>& MatEigen(Matrix<T>& res, const Matrix<T>& A, const bool& decreasing = false)
     {
         assert(A.GetRowsNb() == A.GetColsNb());
-        res = A;
-        // qr decomposition
-        Matrix<T> q{A.GetColsNb(), A.GetColsNb()};
-        Matrix<T> r{A.GetColsNb(), A.GetColsNb()};
-        // compute the eigenvalues, the number of iterations is arbitrary
-        for (size_t i = 0; i < 500; ++i)
+        (void)decreasing;
+        if (MatIsSymmetric(A))
         {
-            MatQR(q, r, res, decreasing);
-            MatMult(res, r, q);
+            std::vector<T> E;
+            MatEigenSym<T>(E, nullptr, A);
+            // ascending from MatEigenSym, for equal magnitudes the positive eigenvalue comes first
+            std::stable_sort(E.begin(), E.end(), [](const T& e1, const T& e2) {
+                return std::abs(e1) > std::abs(e2) || (std::abs(e1) == std::abs(e2) && e1 > e2);
+            });
+            res = Matrix<T>(A.GetRowsNb(), A.GetColsNb());
+            for (size_t i = 0; i < E.size(); ++i) res(i, i) = E[i];
+            return res;
         }
-        return res;
+        return MatSchur(res, A);
     }
 
+    // diagonal of the real Schur form, the eigenvalues when they are all real
     template <typename T>
     std::vector<T>& MatEigen(std::vector<T>& res, const Matrix<T>& A, const bool& decreasing = false)
     {
         assert(A.GetRowsNb() == A.GetColsNb());
         res.resize(A.GetColsNb());
-        Matrix<T> eigen{A};
+        Matrix<T> eigen{A.GetRowsNb(), A.GetColsNb()};
         MatEigen(eigen, A, decreasing);
         for (size_t i = 0; i < A.GetColsNb(); ++i) res[i] = eigen(i, i);
         return res;
@@ -216,29 +837,21 @@ namespace la
     Matrix<std::complex<T>>& MatEigen(Matrix<std::complex<T>>& res, const Matrix<T>& A, const bool& decreasing)
     {
         assert(A.GetRowsNb() == A.GetColsNb());
-        Matrix<T> res_ = A;
-        // qr decomposition
-        Matrix<T> q{A.GetColsNb(), A.GetColsNb()};
-        Matrix<T> r{A.GetColsNb(), A.GetColsNb()};
-        // compute the Schur decomposition, the number of iterations is arbitrary
-        for (size_t i = 0; i < 500; ++i)
-        {
-            MatQR(q, r, res_, decreasing);
-            MatMult(res_, r, q);
-        }
+        Matrix<T> res_{A.GetRowsNb(), A.GetColsNb()};
+        MatEigen(res_, A, decreasing);
         // compute the eigenvalues
         res = Matrix<std::complex<T>>(A.GetColsNb(), 1);
-        // check on each 2x2 block if the eigenvalues are real or complex
+        // the 2x2 blocks left by MatSchur have complex eigenvalues
         for (size_t i = 0; i < A.GetColsNb(); ++i)
         {
-            if (i < A.GetColsNb() - 1 && fabs(res_(i + 1, i)) > 1e-10)
+            if (i < A.GetColsNb() - 1 && res_(i + 1, i) != T_C(0))
             {
                 // the eigenvalues are complex
                 std::complex<T> a     = res_(i, i);
                 std::complex<T> b     = res_(i, i + 1);
                 std::complex<T> c     = res_(i + 1, i);
                 std::complex<T> d     = res_(i + 1, i + 1);
-                std::complex<T> delta = sqrt((a + d) * (a + d) - T_C(4) * (a * d - b * c));
+                std::complex<T> delta = sqrt((a - d) * (a - d) + T_C(4) * b * c);
                 res(i, 0)             = (a + d + delta) / T_C(2);
                 res(i + 1, 0)         = (a + d - delta) / T_C(2);
                 ++i;
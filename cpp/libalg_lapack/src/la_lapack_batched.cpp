@@ -0,0 +1,350 @@
+/************************/
+/* la_lapack_batched.cpp*/
+/*    Version 1.0       */
+/*     2026/10/19       */
+/************************/
+
+#include <algorithm>
+#include <cassert>
+#include <complex>
+#include <numeric>
+#include <type_traits>
+#include <typeinfo>
+#include "la_lapack_batched.h"
+#include "la_lapack_macro.h"
+#include "la_thread_pool.h"
+#include "lapack_interface.h"
+
+#define T_C(x)         static_cast<T>(x)
+#define INT_C(x)       static_cast<int>(x)
+#define SIZE_T_C(x)    static_cast<size_t>(x)
+#define PTRDIFF_T_C(x) static_cast<std::ptrdiff_t>(x)
+#define FLOAT_P_R(x)   reinterpret_cast<float*>(x)
+#define DOUBLE_P_R(x)  reinterpret_cast<double*>(x)
+
+namespace la
+{
+    namespace
+    {
+        // typed wrappers of the LAPACK routines used by the batched drivers. rwork is ignored for real types
+        template <typename T, typename R>
+        void BatchedGesvd(int m, int n, T* a, R* s, T* u, T* vt, T* work, int lwork, R* rwork, int& info)
+        {
+            char jobu = 'A';
+            int lda = m, ldu = m, ldvt = n;
+            if constexpr (std::is_same_v<T, float>)
+                sgesvd_(&jobu, &jobu, &m, &n, a, &lda, s, u, &ldu, vt, &ldvt, work, &lwork, &info);
+            else if constexpr (std::is_same_v<T, double>)
+                dgesvd_(&jobu, &jobu, &m, &n, a, &lda, s, u, &ldu, vt, &ldvt, work, &lwork, &info);
+            else if constexpr (std::is_same_v<T, std::complex<float>>)
+                cgesvd_(&jobu, &jobu, &m, &n, FLOAT_P_R(a), &lda, s, FLOAT_P_R(u), &ldu, FLOAT_P_R(vt), &ldvt,
+                        FLOAT_P_R(work), &lwork, rwork, &info);
+            else if constexpr (std::is_same_v<T, std::complex<double>>)
+                zgesvd_(&jobu, &jobu, &m, &n, DOUBLE_P_R(a), &lda, s, DOUBLE_P_R(u), &ldu, DOUBLE_P_R(vt), &ldvt,
+                        DOUBLE_P_R(work), &lwork, rwork, &info);
+            else throw std::runtime_error("MatSVDBatched: unsupported type");
+            if constexpr (std::is_same_v<T, float> || std::is_same_v<T, double>) (void)rwork;
+        }
+
+        template <typename T, typename R>
+        void BatchedGesdd(int m, int n, T* a, R* s, T* u, T* vt, T* work, int lwork, R* rwork, int* iwork, int& info)
+        {
+            char jobz = 'A';
+            int lda = m, ldu = m, ldvt = n;
+            if constexpr (std::is_same_v<T, float>)
+                sgesdd_(&jobz, &m, &n, a, &lda, s, u, &ldu, vt, &ldvt, work, &lwork, iwork, &info);
+            else if constexpr (std::is_same_v<T, double>)
+                dgesdd_(&jobz, &m, &n, a, &lda, s, u, &ldu, vt, &ldvt, work, &lwork, iwork, &info);
+            else if constexpr (std::is_same_v<T, std::complex<float>>)
+                cgesdd_(&jobz, &m, &n, FLOAT_P_R(a), &lda, s, FLOAT_P_R(u), &ldu, FLOAT_P_R(vt), &ldvt,
+                        FLOAT_P_R(work), &lwork, rwork, iwork, &info);
+            else if constexpr (std::is_same_v<T, std::complex<double>>)
+                zgesdd_(&jobz, &m, &n, DOUBLE_P_R(a), &lda, s, DOUBLE_P_R(u), &ldu, DOUBLE_P_R(vt), &ldvt,
+                        DOUBLE_P_R(work), &lwork, rwork, iwork, &info);
+            else throw std::runtime_error("MatSVDBatched: unsupported type");
+            if constexpr (std::is_same_v<T, float> || std::is_same_v<T, double>) (void)rwork;
+        }
+
+        // e1 contains the real part and e2 the imaginary part for real types, e1 the eigenvalues for complex types
+        template <typename T, typename R>
+        void BatchedGeev(char jobvl, char jobvr, int n, T* a, T* e1, T* e2, T* vl, T* vr, T* work, int lwork, R* rwork,
+                         int& info)
+        {
+            int lda = n, ldvl = n, ldvr = n;
+            if constexpr (std::is_same_v<T, float>)
+                sgeev_(&jobvl, &jobvr, &n, a, &lda, e1, e2, vl, &ldvl, vr, &ldvr, work, &lwork, &info);
+            else if constexpr (std::is_same_v<T, double>)
+                dgeev_(&jobvl, &jobvr, &n, a, &lda, e1, e2, vl, &ldvl, vr, &ldvr, work, &lwork, &info);
+            else if constexpr (std::is_same_v<T, std::complex<float>>)
+                cgeev_(&jobvl, &jobvr, &n, FLOAT_P_R(a), &lda, FLOAT_P_R(e1), FLOAT_P_R(vl), &ldvl, FLOAT_P_R(vr),
+                       &ldvr, FLOAT_P_R(work), &lwork, rwork, &info);
+            else if constexpr (std::is_same_v<T, std::complex<double>>)
+                zgeev_(&jobvl, &jobvr, &n, DOUBLE_P_R(a), &lda, DOUBLE_P_R(e1), DOUBLE_P_R(vl), &ldvl, DOUBLE_P_R(vr),
+                       &ldvr, DOUBLE_P_R(work), &lwork, rwork, &info);
+            else throw std::runtime_error("MatEigenBatched: unsupported type");
+            if constexpr (std::is_same_v<T, float> || std::is_same_v<T, double>) (void)rwork;
+            else (void)e2;
+        }
+
+        template <typename T> void BatchedGeqrf(int m, int n, T* a, T* tau, T* work, int lwork, int& info)
+        {
+            int lda = m;
+            if constexpr (std::is_same_v<T, float>) sgeqrf_(&m, &n, a, &lda, tau, work, &lwork, &info);
+            else if constexpr (std::is_same_v<T, double>) dgeqrf_(&m, &n, a, &lda, tau, work, &lwork, &info);
+            else if constexpr (std::is_same_v<T, std::complex<float>>)
+                cgeqrf_(&m, &n, FLOAT_P_R(a), &lda, FLOAT_P_R(tau), FLOAT_P_R(work), &lwork, &info);
+            else if constexpr (std::is_same_v<T, std::complex<double>>)
+                zgeqrf_(&m, &n, DOUBLE_P_R(a), &lda, DOUBLE_P_R(tau), DOUBLE_P_R(work), &lwork, &info);
+            else throw std::runtime_error("MatQRBatched: unsupported type");
+        }
+
+        template <typename T> void BatchedOrgqr(int m, int n, int k, T* a, T* tau, T* work, int lwork, int& info)
+        {
+            int lda = m;
+            if constexpr (std::is_same_v<T, float>) sorgqr_(&m, &n, &k, a, &lda, tau, work, &lwork, &info);
+            else if constexpr (std::is_same_v<T, double>) dorgqr_(&m, &n, &k, a, &lda, tau, work, &lwork, &info);
+            else if constexpr (std::is_same_v<T, std::complex<float>>)
+                cungqr_(&m, &n, &k, FLOAT_P_R(a), &lda, FLOAT_P_R(tau), FLOAT_P_R(work), &lwork, &info);
+            else if constexpr (std::is_same_v<T, std::complex<double>>)
+                zungqr_(&m, &n, &k, DOUBLE_P_R(a), &lda, DOUBLE_P_R(tau), DOUBLE_P_R(work), &lwork, &info);
+            else throw std::runtime_error("MatQRBatched: unsupported type");
+        }
+
+        template <typename T> void BatchedGetrf(int m, int n, T* a, int* ipiv, int& info)
+        {
+            int lda = m;
+            if constexpr (std::is_same_v<T, float>) sgetrf_(&m, &n, a, &lda, ipiv, &info);
+            else if constexpr (std::is_same_v<T, double>) dgetrf_(&m, &n, a, &lda, ipiv, &info);
+            else if constexpr (std::is_same_v<T, std::complex<float>>) cgetrf_(&m, &n, FLOAT_P_R(a), &lda, ipiv, &info);
+            else if constexpr (std::is_same_v<T, std::complex<double>>)
+                zgetrf_(&m, &n, DOUBLE_P_R(a), &lda, ipiv, &info);
+            else throw std::runtime_error("MatLUBatched: unsupported type");
+        }
+
+        // conjugate transpose of a n x n column major block
+        template <typename T> void BatchedHermitian(T* a, size_t n)
+        {
+            for (size_t j = 0; j < n; ++j)
+                for (size_t i = 0; i < j; ++i) std::swap(a[i + j * n], a[j + i * n]);
+            if constexpr (std::is_same_v<T, std::complex<float>> || std::is_same_v<T, std::complex<double>>)
+                for (size_t i = 0; i < n * n; ++i) a[i] = std::conj(a[i]);
+        }
+    } // namespace
+
+    template <typename T>
+    Matrix<T>& MatSVDBatched(Matrix<T>& U, Matrix<T>& S, Matrix<T>& V, const Matrix<T>& A, const size_t& nBatch,
+                             const int& DRIVER, const int& flags)
+    {
+        REALTYPE_DEFINE
+        assert(nBatch > 0);
+        assert(A.GetColsNb() % nBatch == 0);
+        const size_t m = A.GetRowsNb(), n = A.GetColsNb() / nBatch, mn = std::min(m, n), mx = std::max(m, n);
+        assert(U.GetRowsNb() == m);
+        assert(U.GetColsNb() == m * nBatch);
+        assert(S.GetRowsNb() == mn);
+        assert(S.GetColsNb() == nBatch);
+        assert(V.GetRowsNb() == n);
+        assert(V.GetColsNb() == n * nBatch);
+        if (DRIVER != la::DRIVER::GESVD && DRIVER != la::DRIVER::GESDD)
+            throw std::runtime_error("MatSVDBatched: unsupported DRIVER");
+        ParallelFor(0, nBatch, [&](const size_t first, const size_t last, const size_t) {
+            // workspace of the thread, allocated once for all the matrices of the block
+            int m_ = INT_C(m), n_ = INT_C(n), lwork = -1, info = 0;
+            std::vector<T> Atmp(m * n), work(1);
+            std::vector<RealType> s(mn), rwork;
+            std::vector<int> iwork(8 * mn);
+            if constexpr (std::is_same_v<T, std::complex<float>> || std::is_same_v<T, std::complex<double>>)
+            {
+                if (DRIVER == la::DRIVER::GESVD) rwork.resize(5 * mn);
+                else rwork.resize(std::max(5 * mn * mn + 5 * mn, 2 * mx * mn + 2 * mn * mn + mn));
+            }
+            T* u_  = U.data().data() + first * m * m;
+            T* vt_ = V.data().data() + first * n * n;
+            if (DRIVER == la::DRIVER::GESVD)
+                BatchedGesvd(m_, n_, Atmp.data(), s.data(), u_, vt_, work.data(), lwork, rwork.data(), info);
+            else
+                BatchedGesdd(m_, n_, Atmp.data(), s.data(), u_, vt_, work.data(), lwork, rwork.data(), iwork.data(),
+                             info);
+            lwork = INT_C(std::real(work[0]));
+            work.resize(SIZE_T_C(lwork));
+            for (size_t b = first; b < last; ++b)
+            {
+                std::copy(A.data().begin() + PTRDIFF_T_C(b * m * n), A.data().begin() + PTRDIFF_T_C((b + 1) * m * n),
+                          Atmp.begin());
+                u_  = U.data().data() + b * m * m;
+                vt_ = V.data().data() + b * n * n;
+                if (DRIVER == la::DRIVER::GESVD)
+                    BatchedGesvd(m_, n_, Atmp.data(), s.data(), u_, vt_, work.data(), lwork, rwork.data(), info);
+                else
+                    BatchedGesdd(m_, n_, Atmp.data(), s.data(), u_, vt_, work.data(), lwork, rwork.data(),
+                                 iwork.data(), info);
+                if (info < 0) throw std::runtime_error("MatSVDBatched: illegal value");
+                else if (info > 0) throw std::runtime_error("MatSVDBatched: convergence not reached");
+                for (size_t i = 0; i < mn; ++i) S(i, b) = T_C(s[i]);
+                // LAPACK returns V^H
+                if (!(flags & la::SVD::V_HT)) BatchedHermitian(vt_, n);
+            }
+        });
+        return S;
+    }
+
+    template <typename T>
+    Matrix<T>& MatEigenBatched(Matrix<T>& E, Matrix<T>* pVL, Matrix<T>* pVR, const Matrix<T>& A, const size_t& nBatch,
+                               const int& flags)
+    {
+        (void)flags;
+        REALTYPE_DEFINE
+        assert(nBatch > 0);
+        const size_t n = A.GetRowsNb();
+        assert(A.GetColsNb() == n * nBatch);
+        constexpr bool bReal_ = std::is_same_v<T, float> || std::is_same_v<T, double>;
+        assert(E.GetRowsNb() == n);
+        assert(E.GetColsNb() == (bReal_ ? 2 : 1) * nBatch);
+        const char jobvl = pVL ? 'V' : 'N', jobvr = pVR ? 'V' : 'N';
+        if (pVL)
+        {
+            assert(pVL->GetRowsNb() == n);
+            assert(pVL->GetColsNb() == n * nBatch);
+        }
+        if (pVR)
+        {
+            assert(pVR->GetRowsNb() == n);
+            assert(pVR->GetColsNb() == n * nBatch);
+        }
+        ParallelFor(0, nBatch, [&](const size_t first, const size_t last, const size_t) {
+            int n_ = INT_C(n), lwork = -1, info = 0;
+            std::vector<T> Atmp(n * n), work(1);
+            std::vector<RealType> rwork(2 * n);
+            auto eigen_ = [&](const size_t b) {
+                T* e1_  = E.data().data() + (bReal_ ? 2 * b : b) * n;
+                T* e2_  = bReal_ ? e1_ + n : nullptr;
+                T* vl_  = pVL ? pVL->data().data() + b * n * n : nullptr;
+                T* vr_  = pVR ? pVR->data().data() + b * n * n : nullptr;
+                BatchedGeev(jobvl, jobvr, n_, Atmp.data(), e1_, e2_, vl_, vr_, work.data(), lwork, rwork.data(), info);
+            };
+            eigen_(first);
+            lwork = INT_C(std::real(work[0]));
+            work.resize(SIZE_T_C(lwork));
+            for (size_t b = first; b < last; ++b)
+            {
+                std::copy(A.data().begin() + PTRDIFF_T_C(b * n * n), A.data().begin() + PTRDIFF_T_C((b + 1) * n * n),
+                          Atmp.begin());
+                eigen_(b);
+                if (info < 0) throw std::runtime_error("MatEigenBatched: illegal value");
+                else if (info > 0) throw std::runtime_error("MatEigenBatched: failed to converge");
+            }
+        });
+        return E;
+    }
+
+    template <typename T>
+    Matrix<T>& MatQRBatched(Matrix<T>& Q, Matrix<T>& R, const Matrix<T>& A, const size_t& nBatch, const int& flags)
+    {
+        (void)flags;
+        assert(nBatch > 0);
+        assert(A.GetColsNb() % nBatch == 0);
+        const size_t m = A.GetRowsNb(), n = A.GetColsNb() / nBatch, mn = std::min(m, n);
+        assert(Q.GetRowsNb() == m);
+        assert(Q.GetColsNb() == m * nBatch);
+        assert(R.GetRowsNb() == m);
+        assert(R.GetColsNb() == n * nBatch);
+        ParallelFor(0, nBatch, [&](const size_t first, const size_t last, const size_t) {
+            int m_ = INT_C(m), n_ = INT_C(n), k_ = INT_C(mn), lwork = -1, info = 0;
+            // the reflectors are expanded in place, so the buffer needs at least m columns
+            std::vector<T> Atmp(m * std::max(m, n)), tau(std::max(mn, SIZE_T_C(1))), work(1);
+            BatchedGeqrf(m_, n_, Atmp.data(), tau.data(), work.data(), lwork, info);
+            lwork = INT_C(std::real(work[0]));
+            BatchedOrgqr(m_, m_, k_, Atmp.data(), tau.data(), work.data(), -1, info);
+            lwork = std::max(lwork, INT_C(std::real(work[0])));
+            work.resize(SIZE_T_C(lwork));
+            for (size_t b = first; b < last; ++b)
+            {
+                std::copy(A.data().begin() + PTRDIFF_T_C(b * m * n), A.data().begin() + PTRDIFF_T_C((b + 1) * m * n),
+                          Atmp.begin());
+                BatchedGeqrf(m_, n_, Atmp.data(), tau.data(), work.data(), lwork, info);
+                if (info < 0) throw std::runtime_error("MatQRBatched: illegal value");
+                T* r_ = R.data().data() + b * m * n;
+                for (size_t j = 0; j < n; ++j)
+                    for (size_t i = 0; i < m; ++i) r_[i + j * m] = (i <= j) ? Atmp[i + j * m] : T_C(0);
+                BatchedOrgqr(m_, m_, k_, Atmp.data(), tau.data(), work.data(), lwork, info);
+                if (info < 0) throw std::runtime_error("MatQRBatched: illegal value");
+                std::copy(Atmp.begin(), Atmp.begin() + PTRDIFF_T_C(m * m), Q.data().begin() + PTRDIFF_T_C(b * m * m));
+            }
+        });
+        return Q;
+    }
+
+    template <typename T>
+    Matrix<T>& MatLUBatched(Matrix<T>& L, Matrix<T>& U, Matrix<T>& P, const Matrix<T>& A, const size_t& nBatch,
+                            const int& flags)
+    {
+        (void)flags;
+        assert(nBatch > 0);
+        assert(A.GetColsNb() % nBatch == 0);
+        const size_t m = A.GetRowsNb(), n = A.GetColsNb() / nBatch, mn = std::min(m, n);
+        assert(L.GetRowsNb() == m);
+        assert(L.GetColsNb() == mn * nBatch);
+        assert(U.GetRowsNb() == mn);
+        assert(U.GetColsNb() == n * nBatch);
+        assert(P.GetRowsNb() == m);
+        assert(P.GetColsNb() == m * nBatch);
+        ParallelFor(0, nBatch, [&](const size_t first, const size_t last, const size_t) {
+            int m_ = INT_C(m), n_ = INT_C(n), info = 0;
+            std::vector<T> Atmp(m * n);
+            std::vector<int> ipiv(std::max(mn, SIZE_T_C(1)));
+            std::vector<size_t> perm(m);
+            for (size_t b = first; b < last; ++b)
+            {
+                std::copy(A.data().begin() + PTRDIFF_T_C(b * m * n), A.data().begin() + PTRDIFF_T_C((b + 1) * m * n),
+                          Atmp.begin());
+                BatchedGetrf(m_, n_, Atmp.data(), ipiv.data(), info);
+                if (info < 0) throw std::runtime_error("MatLUBatched: illegal value");
+                else if (info > 0) throw std::runtime_error("MatLUBatched: singular matrix");
+                T *l_ = L.data().data() + b * m * mn, *u_ = U.data().data() + b * mn * n,
+                  *p_ = P.data().data() + b * m * m;
+                for (size_t j = 0; j < mn; ++j)
+                    for (size_t i = 0; i < m; ++i)
+                        l_[i + j * m] = (i > j) ? Atmp[i + j * m] : ((i == j) ? T_C(1) : T_C(0));
+                for (size_t j = 0; j < n; ++j)
+                    for (size_t i = 0; i < mn; ++i) u_[i + j * mn] = (i <= j) ? Atmp[i + j * m] : T_C(0);
+                // compose the row interchanges, P^T * A = L * U
+                std::iota(perm.begin(), perm.end(), SIZE_T_C(0));
+                for (size_t i = 0; i < mn; ++i) std::swap(perm[i], perm[SIZE_T_C(ipiv[i] - 1)]);
+                std::fill(p_, p_ + m * m, T_C(0));
+                for (size_t i = 0; i < m; ++i) p_[perm[i] + i * m] = T_C(1);
+            }
+        });
+        return L;
+    }
+
+} // namespace la
+
+#undef DOUBLE_P_R
+#undef FLOAT_P_R
+#undef INT_C
+#undef PTRDIFF_T_C
+#undef SIZE_T_C
+#undef T_C
+
+// Explicit template instantiation
+#define INSTANTIATE_BATCHED_TEMPLATE(type)                                                                             \
+    template la::Matrix<type>& la::MatSVDBatched<type>(la::Matrix<type>&, la::Matrix<type>&, la::Matrix<type>&,        \
+                                                       const la::Matrix<type>&, const size_t&, const int&,             \
+                                                       const int&);                                                    \
+    template la::Matrix<type>& la::MatEigenBatched<type>(la::Matrix<type>&, la::Matrix<type>*, la::Matrix<type>*,      \
+                                                         const la::Matrix<type>&, const size_t&, const int&);          \
+    template la::Matrix<type>& la::MatQRBatched<type>(la::Matrix<type>&, la::Matrix<type>&, const la::Matrix<type>&,   \
+                                                      const size_t&, const int&);                                      \
+    template la::Matrix<type>& la::MatLUBatched<type>(la::Matrix<type>&, la::Matrix<type>&, la::Matrix<type>&,         \
+                                                      const la::Matrix<type>&, const size_t&, const int&);
+
+#define INSTANTIATE_ALL_BATCHED_TEMPLATES                                                                              \
+    INSTANTIATE_BATCHED_TEMPLATE(float)                                                                                \
+    INSTANTIATE_BATCHED_TEMPLATE(double)                                                                               \
+    INSTANTIATE_BATCHED_TEMPLATE(std::complex<float>)                                                                  \
+    INSTANTIATE_BATCHED_TEMPLATE(std::complex<double>)
+
+INSTANTIATE_ALL_BATCHED_TEMPLATES
+
+#undef INSTANTIATE_BATCHED_TEMPLATE
+#undef INSTANTIATE_ALL_BATCHED_TEMPLATES
@@ -0,0 +1,68 @@
+#ifndef _LA_LAPACK_BATCHED_H_6748738A49184F85B6DF8183D9B38A23_
+#define _LA_LAPACK_BATCHED_H_6748738A49184F85B6DF8183D9B38A23_
+
+/************************/
+/* la_lapack_batched.h  */
+/*    Version 1.0       */
+/*     2026/10/19       */
+/************************/
+
+#ifndef USE_LAPACK
+#error "USE_LAPACK is not defined"
+#endif
+
+#include "la_blas_mult.h"
+#include "la_lapack_eigen.h"
+#include "la_lapack_svd.h"
+#include "math/algebra/matrix.h"
+#include "math/algebra/matrix_operations.h"
+
+namespace la
+{
+    // Batched decompositions of nBatch independent matrices with the same shape m x n.
+    // The batch is stored contiguously: A is a m x (n * nBatch) matrix and the matrix b occupies the columns
+    // [b * n, (b + 1) * n), so that each matrix is a contiguous column major block.
+    // The outputs follow the same layout, each block having the shape of the corresponding single matrix routine.
+    // The batch is split among the threads of la::ThreadPool(), every thread allocating its own workspace once and
+    // reusing it for all the matrices of its block.
+
+    // SVD of each matrix (see MatSVD). Only GESVD and GESDD drivers are supported.
+    // U is m x (m * nBatch)
+    // S is min(m, n) x nBatch, the column b contains the singular values of the matrix b in descending order
+    // V is n x (n * nBatch), V_HT flag is honoured as in MatSVD
+    template <typename T>
+    Matrix<T>& MatSVDBatched(Matrix<T>& U, Matrix<T>& S, Matrix<T>& V, const Matrix<T>& A, const size_t& nBatch,
+                             const int& DRIVER = 1, const int& flags = 0);
+
+    // Eigenvalues and optionally eigenvectors of each square matrix (see MatEigen).
+    // E is n x (2 * nBatch) for real types (real and imaginary part of the matrix b in the columns 2 * b and
+    // 2 * b + 1) and n x nBatch for complex types
+    // pVL and pVR, when not null, are n x (n * nBatch)
+    template <typename T>
+    Matrix<T>& MatEigenBatched(Matrix<T>& E, Matrix<T>* pVL, Matrix<T>* pVR, const Matrix<T>& A, const size_t& nBatch,
+                               const int& flags = 0);
+
+    template <typename T>
+    Matrix<T>& MatEigenBatched(Matrix<T>& E, const Matrix<T>& A, const size_t& nBatch, const int& flags = 0)
+    {
+        return MatEigenBatched<T>(E, nullptr, nullptr, A, nBatch, flags);
+    }
+
+    // QR decomposition of each matrix (see MatQR).
+    // Q is m x (m * nBatch)
+    // R is m x (n * nBatch), upper trapezoidal
+    template <typename T>
+    Matrix<T>& MatQRBatched(Matrix<T>& Q, Matrix<T>& R, const Matrix<T>& A, const size_t& nBatch,
+                            const int& flags = 0);
+
+    // LU decomposition with partial pivoting of each matrix A = P * L * U (see MatLU).
+    // L is m x (min(m, n) * nBatch), lower trapezoidal with unit diagonal
+    // U is min(m, n) x (n * nBatch), upper trapezoidal
+    // P is m x (m * nBatch), permutation matrices
+    template <typename T>
+    Matrix<T>& MatLUBatched(Matrix<T>& L, Matrix<T>& U, Matrix<T>& P, const Matrix<T>& A, const size_t& nBatch,
+                            const int& flags = 0);
+
+} // namespace la
+
+#endif
@@ -0,0 +1,338 @@
+/************************/
+/*la_lapack_cholesky.cpp*/
+/*    Version 1.0       */
+/*     2026/10/19       */
+/************************/
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <complex>
+#include <string>
+#include <type_traits>
+#include <typeinfo>
+#include "la_blas_mult.h"
+#include "la_lapack_cholesky.h"
+#include "la_lapack_macro.h"
+#include "lapack_interface.h"
+
+#define T_C(x)        static_cast<T>(x)
+#define INT_C(x)      static_cast<int>(x)
+#define SIZE_T_C(x)   static_cast<size_t>(x)
+#define FLOAT_P_R(x)  reinterpret_cast<float*>(x)
+#define DOUBLE_P_R(x) reinterpret_cast<double*>(x)
+
+namespace la
+{
+    namespace
+    {
+        template <typename T> inline T CholeskyConj(const T& z)
+        {
+            if constexpr (std::is_same_v<T, float> || std::is_same_v<T, double>) return z;
+            else return std::conj(z);
+        }
+
+        // set to zero the triangle of the factor not referenced by LAPACK
+        template <typename T> void CholeskyClearTriangle(Matrix<T>& L, const bool bUpper)
+        {
+            const size_t n = L.GetRowsNb();
+            for (size_t j = 0; j < n; ++j)
+                for (size_t i = 0; i < n; ++i)
+                    if ((bUpper && i > j) || (!bUpper && i < j)) L(i, j) = T_C(0);
+        }
+
+        // L * L^H + sign * x * x^H, the columns of the lower factor are rotated one at a time.
+        // The upper factor is handled through U(k, i) = conj(L(i, k)).
+        template <typename T>
+        void CholeskyRank1(Matrix<T>& L, const Matrix<T>& x, const int& flags, const RealTypeOf<T> sign,
+                           const char* name)
+        {
+            REALTYPE_DEFINE
+            assert(L.GetRowsNb() == L.GetColsNb());
+            assert(x.GetRowsNb() == L.GetRowsNb() && x.GetColsNb() == 1);
+            const bool bUpper = flags & CHOLESKY::UPPER;
+            const size_t n    = L.GetRowsNb();
+            // the downdate may fail, the factor is modified on a copy
+            Matrix<T> Lt{L}, w{x};
+            auto get_ = [&](const size_t i, const size_t k) { return bUpper ? CholeskyConj(Lt(k, i)) : Lt(i, k); };
+            auto set_ = [&](const size_t i, const size_t k, const T& v) {
+                if (bUpper) Lt(k, i) = CholeskyConj(v);
+                else Lt(i, k) = v;
+            };
+            for (size_t k = 0; k < n; ++k)
+            {
+                const RealType d  = std::real(get_(k, k));
+                const RealType r2 = d * d + sign * std::norm(w(k, 0));
+                if (!(r2 > 0)) throw std::runtime_error(std::string(name) + ": not positive definite");
+                const RealType r = std::sqrt(r2), c = r / d;
+                const T s        = w(k, 0) / d;
+                set_(k, k, T_C(r));
+                for (size_t i = k + 1; i < n; ++i)
+                {
+                    const T l_ = (get_(i, k) + sign * CholeskyConj(s) * w(i, 0)) / c;
+                    set_(i, k, l_);
+                    w(i, 0) = c * w(i, 0) - s * l_;
+                }
+            }
+            L = Lt;
+        }
+    } // namespace
+
+    template <typename T> Matrix<T>& MatCholesky(Matrix<T>& L, const Matrix<T>& A, const int& flags)
+    {
+        assert(A.GetRowsNb() == A.GetColsNb());
+        assert(L.GetRowsNb() == A.GetRowsNb());
+        assert(L.GetColsNb() == A.GetColsNb());
+        char uplo = (flags & CHOLESKY::UPPER) ? 'U' : 'L';
+        int n = INT_C(A.GetRowsNb()), lda = std::max(n, 1), info = 0;
+        L = A;
+        if constexpr (std::is_same_v<T, float>) spotrf_(&uplo, &n, L.data().data(), &lda, &info);
+        else if constexpr (std::is_same_v<T, double>) dpotrf_(&uplo, &n, L.data().data(), &lda, &info);
+        else if constexpr (std::is_same_v<T, std::complex<float>>)
+            cpotrf_(&uplo, &n, FLOAT_P_R(L.data().data()), &lda, &info);
+        else if constexpr (std::is_same_v<T, std::complex<double>>)
+            zpotrf_(&uplo, &n, DOUBLE_P_R(L.data().data()), &lda, &info);
+        else throw std::runtime_error("MatCholesky: unsupported type");
+        if (info < 0) throw std::runtime_error("MatCholesky: illegal value");
+        else if (info > 0) throw std::runtime_error("MatCholesky: not positive definite");
+        CholeskyClearTriangle(L, flags & CHOLESKY::UPPER);
+        return L;
+    }
+
+    template <typename T>
+    Matrix<T>& MatCholeskySolve(Matrix<T>& X, const Matrix<T>& L, const Matrix<T>& B, const int& flags)
+    {
+        assert(L.GetRowsNb() == L.GetColsNb());
+        assert(B.GetRowsNb() == L.GetRowsNb());
+        assert(X.GetRowsNb() == B.GetRowsNb());
+        assert(X.GetColsNb() == B.GetColsNb());
+        char uplo = (flags & CHOLESKY::UPPER) ? 'U' : 'L';
+        int n = INT_C(L.GetRowsNb()), nrhs = INT_C(B.GetColsNb()), lda = std::max(n, 1), ldb = std::max(n, 1),
+            info = 0;
+        if (&X != &B) X = B;
+        // potrs does not modify the factor
+        T* a = const_cast<T*>(L.data().data());
+        if constexpr (std::is_same_v<T, float>) spotrs_(&uplo, &n, &nrhs, a, &lda, X.data().data(), &ldb, &info);
+        else if constexpr (std::is_same_v<T, double>)
+            dpotrs_(&uplo, &n, &nrhs, a, &lda, X.data().data(), &ldb, &info);
+        else if constexpr (std::is_same_v<T, std::complex<float>>)
+            cpotrs_(&uplo, &n, &nrhs, FLOAT_P_R(a), &lda, FLOAT_P_R(X.data().data()), &ldb, &info);
+        else if constexpr (std::is_same_v<T, std::complex<double>>)
+            zpotrs_(&uplo, &n, &nrhs, DOUBLE_P_R(a), &lda, DOUBLE_P_R(X.data().data()), &ldb, &info);
+        else throw std::runtime_error("MatCholeskySolve: unsupported type");
+        if (info < 0) throw std::runtime_error("MatCholeskySolve: illegal value");
+        return X;
+    }
+
+    template <typename T>
+    size_t MatCholeskyPivoted(Matrix<T>& L, std::vector<int>& piv, const Matrix<T>& A, const RealTypeOf<T>& tol,
+                              const int& flags)
+    {
+        REALTYPE_DEFINE
+        assert(A.GetRowsNb() == A.GetColsNb());
+        assert(L.GetRowsNb() == A.GetRowsNb());
+        assert(L.GetColsNb() == A.GetColsNb());
+        const bool bUpper = flags & CHOLESKY::UPPER;
+        char uplo         = bUpper ? 'U' : 'L';
+        int n = INT_C(A.GetRowsNb()), lda = std::max(n, 1), rank = 0, info = 0;
+        RealType tol_ = tol;
+        std::vector<RealType> work(SIZE_T_C(2 * std::max(n, 1)));
+        L = A;
+        piv.resize(SIZE_T_C(n));
+        if constexpr (std::is_same_v<T, float>)
+            spstrf_(&uplo, &n, L.data().data(), &lda, piv.data(), &rank, &tol_, work.data(), &info);
+        else if constexpr (std::is_same_v<T, double>)
+            dpstrf_(&uplo, &n, L.data().data(), &lda, piv.data(), &rank, &tol_, work.data(), &info);
+        else if constexpr (std::is_same_v<T, std::complex<float>>)
+            cpstrf_(&uplo, &n, FLOAT_P_R(L.data().data()), &lda, piv.data(), &rank, &tol_, work.data(), &info);
+        else if constexpr (std::is_same_v<T, std::complex<double>>)
+            zpstrf_(&uplo, &n, DOUBLE_P_R(L.data().data()), &lda, piv.data(), &rank, &tol_, work.data(), &info);
+        else throw std::runtime_error("MatCholeskyPivoted: unsupported type");
+        // info > 0 only reports a rank deficient matrix
+        if (info < 0) throw std::runtime_error("MatCholeskyPivoted: illegal value");
+        CholeskyClearTriangle(L, bUpper);
+        // the trailing block is not factorized
+        for (size_t j = SIZE_T_C(rank); j < SIZE_T_C(n); ++j)
+            for (size_t i = SIZE_T_C(rank); i < SIZE_T_C(n); ++i) L(i, j) = T_C(0);
+        return SIZE_T_C(rank);
+    }
+
+    template <typename T> Matrix<T>& MatCholeskyUpdate(Matrix<T>& L, const Matrix<T>& x, const int& flags)
+    {
+        CholeskyRank1(L, x, flags, RealTypeOf<T>(1), "MatCholeskyUpdate");
+        return L;
+    }
+
+    template <typename T> Matrix<T>& MatCholeskyDowndate(Matrix<T>& L, const Matrix<T>& x, const int& flags)
+    {
+        CholeskyRank1(L, x, flags, RealTypeOf<T>(-1), "MatCholeskyDowndate");
+        return L;
+    }
+
+    template <typename T>
+    Matrix<T>& MatLDLTFactor(Matrix<T>& LD, std::vector<int>& ipiv, const Matrix<T>& A, const int& flags)
+    {
+        assert(A.GetRowsNb() == A.GetColsNb());
+        char uplo = 'L';
+        int n = INT_C(A.GetRowsNb()), lda = std::max(n, 1), lwork = -1, info = 0;
+        const bool bHerm = flags & LDLT::HERMITIAN;
+        LD               = A;
+        ipiv.resize(SIZE_T_C(n));
+        std::vector<T> work(1);
+        for (int pass = 0; pass < 2; ++pass)
+        {
+            if constexpr (std::is_same_v<T, float>)
+                ssytrf_(&uplo, &n, LD.data().data(), &lda, ipiv.data(), work.data(), &lwork, &info);
+            else if constexpr (std::is_same_v<T, double>)
+                dsytrf_(&uplo, &n, LD.data().data(), &lda, ipiv.data(), work.data(), &lwork, &info);
+            else if constexpr (std::is_same_v<T, std::complex<float>>)
+            {
+                if (bHerm)
+                    chetrf_(&uplo, &n, FLOAT_P_R(LD.data().data()), &lda, ipiv.data(), FLOAT_P_R(work.data()),
+                            &lwork, &info);
+                else
+                    csytrf_(&uplo, &n, FLOAT_P_R(LD.data().data()), &lda, ipiv.data(), FLOAT_P_R(work.data()),
+                            &lwork, &info);
+            }
+            else if constexpr (std::is_same_v<T, std::complex<double>>)
+            {
+                if (bHerm)
+                    zhetrf_(&uplo, &n, DOUBLE_P_R(LD.data().data()), &lda, ipiv.data(), DOUBLE_P_R(work.data()),
+                            &lwork, &info);
+                else
+                    zsytrf_(&uplo, &n, DOUBLE_P_R(LD.data().data()), &lda, ipiv.data(), DOUBLE_P_R(work.data()),
+                            &lwork, &info);
+            }
+            else throw std::runtime_error("MatLDLTFactor: unsupported type");
+            if (info < 0) throw std::runtime_error("MatLDLTFactor: illegal value");
+            else if (info > 0) throw std::runtime_error("MatLDLTFactor: singular matrix");
+            if (pass == 0)
+            {
+                lwork = std::max(INT_C(std::real(work[0])), 1);
+                work.resize(SIZE_T_C(lwork));
+            }
+        }
+        return LD;
+    }
+
+    template <typename T>
+    Matrix<T>& MatLDLTSolve(Matrix<T>& X, const Matrix<T>& LD, const std::vector<int>& ipiv, const Matrix<T>& B,
+                            const int& flags)
+    {
+        assert(LD.GetRowsNb() == LD.GetColsNb());
+        assert(B.GetRowsNb() == LD.GetRowsNb());
+        assert(X.GetRowsNb() == B.GetRowsNb());
+        assert(X.GetColsNb() == B.GetColsNb());
+        assert(ipiv.size() == LD.GetRowsNb());
+        char uplo = 'L';
+        int n = INT_C(LD.GetRowsNb()), nrhs = INT_C(B.GetColsNb()), lda = std::max(n, 1), ldb = std::max(n, 1),
+            info = 0;
+        const bool bHerm = flags & LDLT::HERMITIAN;
+        if (&X != &B) X = B;
+        // sytrs and hetrs do not modify the factors and the pivots
+        T* a    = const_cast<T*>(LD.data().data());
+        int* pv = const_cast<int*>(ipiv.data());
+        if constexpr (std::is_same_v<T, float>) ssytrs_(&uplo, &n, &nrhs, a, &lda, pv, X.data().data(), &ldb, &info);
+        else if constexpr (std::is_same_v<T, double>)
+            dsytrs_(&uplo, &n, &nrhs, a, &lda, pv, X.data().data(), &ldb, &info);
+        else if constexpr (std::is_same_v<T, std::complex<float>>)
+        {
+            if (bHerm) chetrs_(&uplo, &n, &nrhs, FLOAT_P_R(a), &lda, pv, FLOAT_P_R(X.data().data()), &ldb, &info);
+            else csytrs_(&uplo, &n, &nrhs, FLOAT_P_R(a), &lda, pv, FLOAT_P_R(X.data().data()), &ldb, &info);
+        }
+        else if constexpr (std::is_same_v<T, std::complex<double>>)
+        {
+            if (bHerm) zhetrs_(&uplo, &n, &nrhs, DOUBLE_P_R(a), &lda, pv, DOUBLE_P_R(X.data().data()), &ldb, &info);
+            else zsytrs_(&uplo, &n, &nrhs, DOUBLE_P_R(a), &lda, pv, DOUBLE_P_R(X.data().data()), &ldb, &info);
+        }
+        else throw std::runtime_error("MatLDLTSolve: unsupported type");
+        if (info < 0) throw std::runtime_error("MatLDLTSolve: illegal value");
+        return X;
+    }
+
+    template <typename T>
+    Matrix<T>& MatLDLTExpand(Matrix<T>& L, Matrix<T>& D, const Matrix<T>& LD, const std::vector<int>& ipiv,
+                             const int& flags)
+    {
+        assert(LD.GetRowsNb() == LD.GetColsNb());
+        assert(L.GetRowsNb() == LD.GetRowsNb() && L.GetColsNb() == LD.GetColsNb());
+        assert(D.GetRowsNb() == LD.GetRowsNb() && D.GetColsNb() == LD.GetColsNb());
+        assert(ipiv.size() == LD.GetRowsNb());
+        const bool bHerm = (flags & LDLT::HERMITIAN) || std::is_same_v<T, float> || std::is_same_v<T, double>;
+        const size_t n   = LD.GetRowsNb();
+        // L = P(1) * L(1) * P(2) * L(2) * ..., each L(k) being unit lower triangular with the multipliers v of
+        // the 1 x 1 or 2 x 2 block k stored below the block
+        L.Eyes();
+        D.Zeros();
+        for (size_t k = 0; k < n;)
+        {
+            const size_t s = (ipiv[k] > 0) ? 1 : 2;
+            const size_t p = (ipiv[k] > 0) ? SIZE_T_C(ipiv[k] - 1) : SIZE_T_C(-ipiv[k] - 1);
+            const size_t q = k + s - 1;
+            // L = L * P(k), P(k) interchanges k (k + 1 for a 2 x 2 block) and p
+            if (p != q)
+                for (size_t i = 0; i < n; ++i) std::swap(L(i, q), L(i, p));
+            // L = L * L(k)
+            if (k + s < n)
+                Gemm('N', 'N', n, s, n - k - s, T_C(1), L.data().data() + (k + s) * n, n,
+                     LD.data().data() + k * n + k + s, n, T_C(1), L.data().data() + k * n, n);
+            D(k, k) = LD(k, k);
+            if (s == 2)
+            {
+                D(k + 1, k)     = LD(k + 1, k);
+                D(k + 1, k + 1) = LD(k + 1, k + 1);
+                D(k, k + 1)     = bHerm ? CholeskyConj(LD(k + 1, k)) : LD(k + 1, k);
+            }
+            k += s;
+        }
+        return L;
+    }
+
+    template <typename T> Matrix<T>& MatLDLT(Matrix<T>& L, Matrix<T>& D, const Matrix<T>& A, const int& flags)
+    {
+        Matrix<T> LD{A.GetRowsNb(), A.GetColsNb()};
+        std::vector<int> ipiv;
+        MatLDLTFactor(LD, ipiv, A, flags);
+        return MatLDLTExpand(L, D, LD, ipiv, flags);
+    }
+
+} // namespace la
+
+#undef DOUBLE_P_R
+#undef FLOAT_P_R
+#undef INT_C
+#undef SIZE_T_C
+#undef T_C
+
+// Explicit template instantiation
+#define INSTANTIATE_CHOLESKY_TEMPLATE(type)                                                                            \
+    template la::Matrix<type>& la::MatCholesky(la::Matrix<type>& L, const la::Matrix<type>& A, const int& flags);      \
+    template la::Matrix<type>& la::MatCholeskySolve(la::Matrix<type>& X, const la::Matrix<type>& L,                    \
+                                                    const la::Matrix<type>& B, const int& flags);                      \
+    template size_t la::MatCholeskyPivoted(la::Matrix<type>& L, std::vector<int>& piv, const la::Matrix<type>& A,      \
+                                           const la::RealTypeOf<type>& tol, const int& flags);                         \
+    template la::Matrix<type>& la::MatCholeskyUpdate(la::Matrix<type>& L, const la::Matrix<type>& x,                   \
+                                                     const int& flags);                                                \
+    template la::Matrix<type>& la::MatCholeskyDowndate(la::Matrix<type>& L, const la::Matrix<type>& x,                 \
+                                                       const int& flags);                                              \
+    template la::Matrix<type>& la::MatLDLTFactor(la::Matrix<type>& LD, std::vector<int>& ipiv,                         \
+                                                 const la::Matrix<type>& A, const int& flags);                         \
+    template la::Matrix<type>& la::MatLDLTSolve(la::Matrix<type>& X, const la::Matrix<type>& LD,                       \
+                                                const std::vector<int>& ipiv, const la::Matrix<type>& B,               \
+                                                const int& flags);                                                     \
+    template la::Matrix<type>& la::MatLDLTExpand(la::Matrix<type>& L, la::Matrix<type>& D,                             \
+                                                 const la::Matrix<type>& LD, const std::vector<int>& ipiv,             \
+                                                 const int& flags);                                                    \
+    template la::Matrix<type>& la::MatLDLT(la::Matrix<type>& L, la::Matrix<type>& D, const la::Matrix<type>& A,        \
+                                           const int& flags);
+
+#define INSTANTIATE_ALL_CHOLESKY_TEMPLATES                                                                             \
+    INSTANTIATE_CHOLESKY_TEMPLATE(float)                                                                               \
+    INSTANTIATE_CHOLESKY_TEMPLATE(double)                                                                              \
+    INSTANTIATE_CHOLESKY_TEMPLATE(std::complex<float>)                                                                 \
+    INSTANTIATE_CHOLESKY_TEMPLATE(std::complex<double>)
+
+INSTANTIATE_ALL_CHOLESKY_TEMPLATES
+
+#undef INSTANTIATE_CHOLESKY_TEMPLATE
+#undef INSTANTIATE_ALL_CHOLESKY_TEMPLATES
@@ -0,0 +1,274 @@
+#ifndef _LA_LAPACK_CHOLESKY_H_336D7EBE3A7B42ECA190BF69EE2D54B1_
+#define _LA_LAPACK_CHOLESKY_H_336D7EBE3A7B42ECA190BF69EE2D54B1_
+
+/************************/
+/* la_lapack_cholesky.h */
+/*    Version 1.0       */
+/*     2026/10/19       */
+/************************/
+
+#ifndef USE_LAPACK
+#error "USE_LAPACK is not defined"
+#endif
+
+#include <cassert>
+#include <vector>
+#include "la_blas_mult.h"
+#include "la_lapack_macro.h"
+#include "math/algebra/matrix.h"
+#include "math/algebra/matrix_operations.h"
+
+namespace la
+{
+    namespace CHOLESKY
+    {
+        enum Flags : int {
+            // A = U^H * U with U upper triangular instead of A = L * L^H
+            UPPER   = 1 << 0,
+            // complete pivoting (?pstrf), P^T * A * P = L * L^H, works for semidefinite matrices
+            PIVOTED = 1 << 1,
+        };
+    }
+
+    namespace LDLT
+    {
+        enum Flags : int {
+            // A is complex hermitian (?hetrf / ?hetrs) instead of complex symmetric, ignored for real types
+            HERMITIAN = 1 << 0,
+        };
+    }
+
+    // Compute the Cholesky factorization of a real symmetric or complex hermitian positive definite matrix A (?potrf)
+    // A = L * L^H (A = U^H * U with UPPER), only the lower (upper) triangle of A is referenced
+    // L is n x n, the other triangle is set to zero
+    template <typename T> Matrix<T>& MatCholesky(Matrix<T>& L, const Matrix<T>& A, const int& flags = 0);
+
+    // Solve A * X = B from the Cholesky factor (?potrs), flags must match the ones used for the factorization
+    // B and X are n x nrhs, X can be the same matrix as B
+    template <typename T>
+    Matrix<T>& MatCholeskySolve(Matrix<T>& X, const Matrix<T>& L, const Matrix<T>& B, const int& flags = 0);
+
+    // Compute the Cholesky factorization with complete pivoting of a positive semidefinite matrix A (?pstrf)
+    // P^T * A * P = L * L^H (U^H * U with UPPER), piv contains the 1 based column order, P(piv[k] - 1, k) = 1
+    // The factorization stops when the pivot is below tol (tol < 0 selects n * eps * max(diag(A))).
+    // Returns the computed rank, the trailing n - rank columns (rows) of L are set to zero.
+    template <typename T>
+    size_t MatCholeskyPivoted(Matrix<T>& L, std::vector<int>& piv, const Matrix<T>& A,
+                              const RealTypeOf<T>& tol = -1, const int& flags = 0);
+
+    // Rank-1 update of the Cholesky factor, L * L^H + x * x^H = L' * L'^H
+    // L is updated in place with O(n^2) operations, x is n x 1
+    template <typename T> Matrix<T>& MatCholeskyUpdate(Matrix<T>& L, const Matrix<T>& x, const int& flags = 0);
+
+    // Rank-1 downdate of the Cholesky factor, L * L^H - x * x^H = L' * L'^H
+    // throws if the downdated matrix is not positive definite, L is then left unchanged
+    template <typename T> Matrix<T>& MatCholeskyDowndate(Matrix<T>& L, const Matrix<T>& x, const int& flags = 0);
+
+    // Compute the Bunch-Kaufman factorization of a real symmetric, complex symmetric or complex hermitian (HERMITIAN)
+    // matrix A in the packed form of ?sytrf / ?hetrf, A does not need to be definite.
+    // A = L * D * L^T (L * D * L^H), only the lower triangle of A is referenced
+    // The packed factors can be reused to solve any number of systems with MatLDLTSolve.
+    template <typename T>
+    Matrix<T>& MatLDLTFactor(Matrix<T>& LD, std::vector<int>& ipiv, const Matrix<T>& A, const int& flags = 0);
+
+    // Solve A * X = B from the packed factors (?sytrs / ?hetrs)
+    // B and X are n x nrhs, X can be the same matrix as B
+    template <typename T>
+    Matrix<T>& MatLDLTSolve(Matrix<T>& X, const Matrix<T>& LD, const std::vector<int>& ipiv, const Matrix<T>& B,
+                            const int& flags = 0);
+
+    // Explicit factors of the Bunch-Kaufman factorization, A = L * D * L^T (L * D * L^H)
+    // D is block diagonal with 1 x 1 and 2 x 2 blocks, L is a row permutation of a unit lower triangular matrix
+    template <typename T>
+    Matrix<T>& MatLDLT(Matrix<T>& L, Matrix<T>& D, const Matrix<T>& A, const int& flags = 0);
+
+    // Explicit factors from the packed form computed by MatLDLTFactor
+    template <typename T>
+    Matrix<T>& MatLDLTExpand(Matrix<T>& L, Matrix<T>& D, const Matrix<T>& LD, const std::vector<int>& ipiv,
+                             const int& flags = 0);
+
+    template <typename T> class MatrixCholesky
+    {
+      public:
+        inline MatrixCholesky(const Matrix<T>& M)
+            : A_(M), L_(M.GetRowsNb(), M.GetColsNb()), C_(0, 0), rank_(M.GetRowsNb()), flags_(0)
+        {
+        }
+
+        inline const Matrix<T>& A() const { return A_; }
+
+        // lower triangular factor (upper triangular with UPPER)
+        inline const Matrix<T>& L() const { return L_; }
+
+        // 1 based column order of the pivoted factorization, empty otherwise
+        inline const std::vector<int>& piv() const { return piv_; }
+
+        inline size_t Rank() const { return rank_; }
+
+        inline int GetFlags() const { return flags_; }
+
+        inline void Compute(const int& flags = 0)
+        {
+            flags_ = flags;
+            C_     = Matrix<T>(0, 0);
+            if (flags_ & CHOLESKY::PIVOTED) rank_ = MatCholeskyPivoted(L_, piv_, A_, RealTypeOf<T>(-1), flags_);
+            else
+            {
+                piv_.clear();
+                rank_ = A_.GetRowsNb();
+                MatCholesky(L_, A_, flags_);
+            }
+        }
+
+        // L * L^H (U^H * U), permuted back with PIVOTED
+        inline const Matrix<T>& C()
+        {
+            if (C_.size() == 0)
+            {
+                const size_t n = L_.GetRowsNb();
+                Matrix<T> LLH{n, n};
+                MatMult(LLH, L_, L_, (flags_ & CHOLESKY::UPPER) ? MULT::A_HT : MULT::B_HT);
+                if (piv_.empty()) C_ = LLH;
+                else
+                {
+                    C_ = Matrix<T>(n, n);
+                    for (size_t j = 0; j < n; ++j)
+                        for (size_t i = 0; i < n; ++i)
+                            C_(static_cast<size_t>(piv_[i] - 1), static_cast<size_t>(piv_[j] - 1)) = LLH(i, j);
+                }
+            }
+            return C_;
+        }
+
+        // solve A * X = B, the pivoted factorization must have full rank
+        inline Matrix<T>& Solve(Matrix<T>& X, const Matrix<T>& B)
+        {
+            if (piv_.empty()) return MatCholeskySolve(X, L_, B, flags_);
+            if (rank_ < L_.GetRowsNb()) throw std::runtime_error("MatrixCholesky: rank deficient matrix");
+            // P^T * A * P * (P^T * X) = P^T * B
+            Matrix<T> Bp{B.GetRowsNb(), B.GetColsNb()};
+            for (size_t j = 0; j < B.GetColsNb(); ++j)
+                for (size_t i = 0; i < B.GetRowsNb(); ++i) Bp(i, j) = B(static_cast<size_t>(piv_[i] - 1), j);
+            MatCholeskySolve(Bp, L_, Bp, flags_);
+            for (size_t j = 0; j < B.GetColsNb(); ++j)
+                for (size_t i = 0; i < B.GetRowsNb(); ++i) X(static_cast<size_t>(piv_[i] - 1), j) = Bp(i, j);
+            return X;
+        }
+
+        inline Matrix<T> Solve(const Matrix<T>& B)
+        {
+            Matrix<T> X{B.GetRowsNb(), B.GetColsNb()};
+            return Solve(X, B);
+        }
+
+        // factor of A + x * x^H, A() still refers to the original matrix
+        inline const Matrix<T>& Update(const Matrix<T>& x)
+        {
+            assert(piv_.empty());
+            C_ = Matrix<T>(0, 0);
+            return MatCholeskyUpdate(L_, x, flags_);
+        }
+
+        // factor of A - x * x^H, A() still refers to the original matrix
+        inline const Matrix<T>& Downdate(const Matrix<T>& x)
+        {
+            assert(piv_.empty());
+            C_ = Matrix<T>(0, 0);
+            return MatCholeskyDowndate(L_, x, flags_);
+        }
+
+      private:
+        const Matrix<T>& A_;
+        Matrix<T> L_;
+        Matrix<T> C_;
+        std::vector<int> piv_;
+        size_t rank_;
+        int flags_;
+    };
+
+    template <typename T> class MatrixLDLT
+    {
+      public:
+        inline MatrixLDLT(const Matrix<T>& M)
+            : A_(M), L_(0, 0), D_(0, 0), C_(0, 0), LD_(M.GetRowsNb(), M.GetColsNb()), flags_(0)
+        {
+        }
+
+        inline const Matrix<T>& A() const { return A_; }
+
+        // packed factors and pivots of ?sytrf / ?hetrf
+        inline const Matrix<T>& LD() const { return LD_; }
+
+        inline const std::vector<int>& ipiv() const { return ipiv_; }
+
+        inline int GetFlags() const { return flags_; }
+
+        inline void Compute(const int& flags = 0)
+        {
+            flags_ = flags;
+            L_     = Matrix<T>(0, 0);
+            D_     = Matrix<T>(0, 0);
+            C_     = Matrix<T>(0, 0);
+            MatLDLTFactor(LD_, ipiv_, A_, flags_);
+        }
+
+        // explicit factors, computed on the first call
+        inline const Matrix<T>& L()
+        {
+            Expand();
+            return L_;
+        }
+
+        inline const Matrix<T>& D()
+        {
+            Expand();
+            return D_;
+        }
+
+        // L * D * L^T (L * D * L^H)
+        inline const Matrix<T>& C()
+        {
+            if (C_.size() == 0)
+            {
+                Expand();
+                const size_t n = LD_.GetRowsNb();
+                Matrix<T> LDt{n, n};
+                MatMult(LDt, L_, D_);
+                C_ = Matrix<T>(n, n);
+                MatMult(C_, LDt, L_, (flags_ & LDLT::HERMITIAN) ? MULT::B_HT : MULT::B_T);
+            }
+            return C_;
+        }
+
+        // solve A * X = B, see MatLDLTSolve
+        inline Matrix<T>& Solve(Matrix<T>& X, const Matrix<T>& B) { return MatLDLTSolve(X, LD_, ipiv_, B, flags_); }
+
+        inline Matrix<T> Solve(const Matrix<T>& B)
+        {
+            Matrix<T> X{B.GetRowsNb(), B.GetColsNb()};
+            return Solve(X, B);
+        }
+
+      private:
+        inline void Expand()
+        {
+            if (L_.size() == 0)
+            {
+                L_ = Matrix<T>(LD_.GetRowsNb(), LD_.GetColsNb());
+                D_ = Matrix<T>(LD_.GetRowsNb(), LD_.GetColsNb());
+                MatLDLTExpand(L_, D_, LD_, ipiv_, flags_);
+            }
+        }
+
+        const Matrix<T>& A_;
+        Matrix<T> L_;
+        Matrix<T> D_;
+        Matrix<T> C_;
+        Matrix<T> LD_;
+        std::vector<int> ipiv_;
+        int flags_;
+    };
+
+} // namespace la
+
+#endif
@@ -8,6 +8,7 @@
 #include <complex>
 #include <type_traits>
 #include <typeinfo>
+#include <utility>
 #include "la_lapack_eigen.h"
 #include "la_lapack_macro.h"
 #include "lapack_interface.h"
@@ -20,14 +21,15 @@
 namespace la
 {
     template <typename T>
-    Matrix<T>& MatEigen(Matrix<T>& E, Matrix<T>* pVL, Matrix<T>* pVR, const Matrix<T>& A, const int& flags)
+    Matrix<T>& MatEigen(Matrix<T>& E, Matrix<T>* pVL, Matrix<T>* pVR, Matrix<T>&& A, const int& flags)
     {
         (void)flags;
         assert(E.GetRowsNb() == A.GetRowsNb());
         assert(A.GetRowsNb() == A.GetColsNb());
         REALTYPE_DEFINE
         int n          = INT_C(A.GetRowsNb());
-        Matrix<T> Atmp = A;
+        // ?geev destroys the caller's buffer
+        Matrix<T>& Atmp = A;
         char jobvl     = 'N', jobvr;
         T *pVLTmp = nullptr, *pVRTmp = nullptr;
         if (pVL)
@@ -100,6 +102,12 @@ namespace la
         return E;
     }
 
+    template <typename T>
+    Matrix<T>& MatEigen(Matrix<T>& E, Matrix<T>* pVL, Matrix<T>* pVR, const Matrix<T>& A, const int& flags)
+    {
+        return MatEigen(E, pVL, pVR, Matrix<T>(A), flags);
+    }
+
 } // namespace la
 
 #undef DOUBLE_P_R
@@ -109,7 +117,9 @@ namespace la
 
 #define INSTANTIATE_EIGEN_TEMPLATE(type)                                                                               \
     template la::Matrix<type>& la::MatEigen<type>(la::Matrix<type>&, la::Matrix<type>*, la::Matrix<type>*,             \
-                                                  const la::Matrix<type>&, const int&);
+                                                  const la::Matrix<type>&, const int&);                                \
+    template la::Matrix<type>& la::MatEigen<type>(la::Matrix<type>&, la::Matrix<type>*, la::Matrix<type>*,             \
+                                                  la::Matrix<type>&&, const int&);
 
 #define INSTANTIATE_ALL_EIGEN_TEMPLATES                                                                                \
     INSTANTIATE_EIGEN_TEMPLATE(float)                                                                                  \
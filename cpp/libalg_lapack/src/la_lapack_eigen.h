@@ -12,11 +12,15 @@
 #endif
 
 #include <complex>
-#include <limits>
+#include <stdexcept>
 #include <type_traits>
 #include <typeinfo>
+#include <utility>
+#include <vector>
 #include "la_blas_mult.h"
+#include "la_lapack_lu.h"
 #include "la_lapack_macro.h"
+#include "la_owned_matrix.h"
 #include "math/algebra/matrix.h"
 #include "math/algebra/matrix_operations.h"
 
@@ -34,6 +38,11 @@ namespace la
     template <typename T>
     Matrix<T>& MatEigen(Matrix<T>& E, Matrix<T>* pVL, Matrix<T>* pVR, const Matrix<T>& A, const int& flags = 0);
 
+    // In-place version, ?geev works directly on the buffer of A (pass std::move(A)) instead of a copy of it.
+    // The content of A is undefined on exit.
+    template <typename T>
+    Matrix<T>& MatEigen(Matrix<T>& E, Matrix<T>* pVL, Matrix<T>* pVR, Matrix<T>&& A, const int& flags = 0);
+
     template <typename T> Matrix<T>& MatEigen(Matrix<T>& E, Matrix<T>* pVR, const Matrix<T>& A, const int& flags = 0)
     {
         return MatEigen<T>(E, nullptr, pVR, A, flags);
@@ -44,27 +53,98 @@ namespace la
         return MatEigen<T>(E, nullptr, nullptr, A, flags);
     }
 
-    template <typename T> class MatrixEigen
+    // Read-only view of the eigenvectors in the packed ?geev layout, for real types a real eigenvalue has a real
+    // column and a complex pair (E(j, 1) > 0, E(j + 1, 1) < 0) stores the real and imaginary parts of the first vector
+    // in columns j and j + 1, the second vector being its conjugate. Elements are formed on access, nothing is copied.
+    template <typename T> class EigenPackedView
     {
-
         REALTYPE_DEFINE
       public:
-        inline MatrixEigen(const Matrix<T>& A)
-            : A_(A), VL_(0, 0), VR_(0, 0), AC_(0, 0), EC_(0, 0), VLC_(0, 0), VRC_(0, 0), AV_(0, 0), EV_(0, 0), flags_(0)
+        inline EigenPackedView(const Matrix<T>& V, const Matrix<T>& E) : V_(V), E_(E) {}
+
+        inline size_t GetRowsNb() const { return V_.GetRowsNb(); }
+
+        inline size_t GetColsNb() const { return V_.GetColsNb(); }
+
+        // packed real storage
+        inline const Matrix<T>& V() const { return V_; }
+
+        // column j holds the real part of a conjugate pair
+        inline bool IsPairFirst(const size_t& j) const
+        {
+            if constexpr (std::is_same<T, float>::value || std::is_same<T, double>::value)
+                return E_(j, 1) > T(0) && j + 1 < V_.GetColsNb();
+            else return false;
+        }
+
+        // column j holds the imaginary part of a conjugate pair
+        inline bool IsPairSecond(const size_t& j) const
+        {
+            if constexpr (std::is_same<T, float>::value || std::is_same<T, double>::value)
+                return j > 0 && E_(j, 1) < T(0) && E_(j - 1, 1) > T(0);
+            else return false;
+        }
+
+        inline std::complex<RealType> operator()(const size_t& i, const size_t& j) const
         {
             if constexpr (std::is_same<T, float>::value || std::is_same<T, double>::value)
             {
-                E_ = Matrix<T>(A.GetRowsNb(), 2);
+                if (IsPairFirst(j)) return std::complex<RealType>(V_(i, j), V_(i, j + 1));
+                if (IsPairSecond(j)) return std::complex<RealType>(V_(i, j - 1), -V_(i, j));
+                return std::complex<RealType>(V_(i, j), RealType(0));
             }
-            else if constexpr (std::is_same<T, std::complex<float>>::value ||
-                               std::is_same<T, std::complex<double>>::value)
+            else return V_(i, j);
+        }
+
+        // full complex eigenvectors, VC is resized if needed
+        inline Matrix<std::complex<RealType>>& Unpack(Matrix<std::complex<RealType>>& VC) const
+        {
+            const size_t m = V_.GetRowsNb(), n = V_.GetColsNb();
+            if (VC.GetRowsNb() != m || VC.GetColsNb() != n) VC = Matrix<std::complex<RealType>>(m, n);
+            for (size_t j = 0; j < n; ++j)
             {
-                E_ = Matrix<T>(A.GetRowsNb(), 1);
+                if (IsPairFirst(j))
+                {
+                    for (size_t i = 0; i < m; ++i)
+                    {
+                        VC(i, j)     = std::complex<RealType>(V_(i, j), V_(i, j + 1));
+                        VC(i, j + 1) = std::conj(VC(i, j));
+                    }
+                    ++j;
+                }
+                else
+                    for (size_t i = 0; i < m; ++i) VC(i, j) = V_(i, j);
             }
-            else { throw std::invalid_argument("MatrixEigen: invalid type"); }
+            return VC;
+        }
+
+      private:
+        const Matrix<T>& V_;
+        const Matrix<T>& E_;
+    };
+
+    template <typename T> class MatrixEigen
+    {
+
+        REALTYPE_DEFINE
+      public:
+        inline MatrixEigen(const Matrix<T>& A)
+            : A_(A), VL_(0, 0), VR_(0, 0), D_(0, 0), AVP_(0, 0), EVP_(0, 0), C_(0, 0), AC_(0, 0), EC_(0, 0),
+              VLC_(0, 0), VRC_(0, 0), AV_(0, 0), EV_(0, 0), flags_(0), owner_(false), real_(false)
+        {
+            Allocate();
         }
 
-        inline const Matrix<T>& A() const { return A_; }
+        // owning mode, the matrix is moved in without a copy (pass std::move(A) or a temporary).
+        // Compute runs ?geev in place and releases it, A() then only keeps the dimensions and AV() is not available.
+        inline MatrixEigen(Matrix<T>&& A)
+            : A_(std::move(A)), VL_(0, 0), VR_(0, 0), D_(0, 0), AVP_(0, 0), EVP_(0, 0), C_(0, 0), AC_(0, 0), EC_(0, 0),
+              VLC_(0, 0), VRC_(0, 0), AV_(0, 0), EV_(0, 0), flags_(0), owner_(true), real_(false)
+        {
+            Allocate();
+        }
+
+        inline const Matrix<T>& A() const { return *A_; }
 
         inline const Matrix<T>& E() const { return E_; }
 
@@ -85,31 +165,15 @@ namespace la
 
         inline const Matrix<T>& VL() const { return VL_; }
 
+        // packed left eigenvectors, see EigenPackedView
+        inline EigenPackedView<T> VLP() const { return EigenPackedView<T>(VL_, E_); }
+
+        // complex left eigenvectors, converted once after each Compute
         inline const Matrix<std::complex<RealType>>& VLC()
         {
             if constexpr (std::is_same<T, float>::value || std::is_same<T, double>::value)
             {
-                if (VLC_.size() == 0)
-                {
-                    VLC_ = Matrix<std::complex<RealType>>(VL_.GetRowsNb(), VL_.GetColsNb());
-                    for (size_t i = 0; i < VL_.GetRowsNb(); i++)
-                        for (size_t j = 0; j < VL_.GetColsNb(); j++)
-                        {
-                            if (j < VL_.GetColsNb() - 1 &&
-                                std::abs(VL_(i, j + 1)) > std::numeric_limits<RealType>::epsilon())
-                            {
-                                // Complex conjugate pair
-                                VLC_(i, j)     = std::complex<RealType>(VL_(i, j), VL_(i, j + 1));
-                                VLC_(i, j + 1) = std::complex<RealType>(VL_(i, j), -VL_(i, j + 1));
-                                j++; // Skip the next column since it represents the complex conjugate
-                            }
-                            else
-                            {
-                                // Real eigenvalue
-                                VLC_(i, j) = std::complex<RealType>(VL_(i, j), 0.0);
-                            }
-                        }
-                }
+                if (VLC_.size() == 0) VLP().Unpack(VLC_);
                 return VLC_;
             }
             // For complex matrices, VLC_ is equal to VL_
@@ -118,69 +182,120 @@ namespace la
 
         inline const Matrix<T>& VR() const { return VR_; }
 
+        // packed right eigenvectors, see EigenPackedView
+        inline EigenPackedView<T> VRP() const { return EigenPackedView<T>(VR_, E_); }
+
+        // complex right eigenvectors, converted once after each Compute
         inline const Matrix<std::complex<RealType>>& VRC()
         {
             if constexpr (std::is_same<T, float>::value || std::is_same<T, double>::value)
             {
-                if (VRC_.size() == 0)
-                {
-                    VRC_ = Matrix<std::complex<RealType>>(VR_.GetRowsNb(), VR_.GetColsNb());
-                    for (size_t i = 0; i < VR_.GetRowsNb(); i++)
-                    {
-                        for (size_t j = 0; j < VR_.GetColsNb(); j++)
-                        {
-                            if (j < VR_.GetColsNb() - 1 &&
-                                std::abs(VR_(i, j + 1)) > std::numeric_limits<RealType>::epsilon())
-                            {
-                                // Complex conjugate pair
-                                VRC_(i, j)     = std::complex<RealType>(VR_(i, j), VR_(i, j + 1));
-                                VRC_(i, j + 1) = std::complex<RealType>(VR_(i, j), -VR_(i, j + 1));
-                                j++; // Skip the next column since it represents the complex conjugate
-                            }
-                            else
-                            {
-                                // Real eigenvalue
-                                VRC_(i, j) = std::complex<RealType>(VR_(i, j), 0.0);
-                            }
-                        }
-                    }
-                }
+                if (VRC_.size() == 0) VRP().Unpack(VRC_);
                 return VRC_;
             }
             // For complex matrices, VRC_ is equal to VR_
             else return VR_;
         }
 
+        // all the eigenvalues are real, for real types E(), VL() and VR() are then the complete real result
+        inline bool IsRealSpectrum() const { return real_; }
+
+        // block diagonal form D with A * VR = VR * D and VL^H * A = D * VL^H, a conjugate pair a +/- ib of a real
+        // matrix gives the 2 x 2 block [a b; -b a], so D is real for real types (diagonal for complex types)
+        inline const Matrix<T>& D()
+        {
+            if (D_.size() == 0)
+            {
+                const size_t n = E_.GetRowsNb();
+                D_             = Matrix<T>(n, n);
+                for (size_t j = 0; j < n; ++j) D_(j, j) = E_(j, 0);
+                if constexpr (std::is_same<T, float>::value || std::is_same<T, double>::value)
+                    for (size_t j = 0; j + 1 < n; ++j)
+                        if (E_(j, 1) > T(0))
+                        {
+                            D_(j, j + 1) = E_(j, 1);
+                            D_(j + 1, j) = -E_(j, 1);
+                            ++j;
+                        }
+            }
+            return D_;
+        }
+
+        // A * VR (right) or VL^H * A (left) in the arithmetic of T, to be compared with EVP
+        inline const Matrix<T>& AVP(const bool& right = true)
+        {
+            if (A_->data().empty()) throw std::runtime_error("MatrixEigen: matrix released by Compute");
+            if (AVP_.GetRowsNb() != A_->GetRowsNb() || AVP_.GetColsNb() != A_->GetColsNb())
+                AVP_ = Matrix<T>(A_->GetRowsNb(), A_->GetColsNb());
+            if (right) MatMult(AVP_, *A_, VR_);
+            else MatMult(AVP_, VL_, *A_, MULT::A_HT);
+            return AVP_;
+        }
+
+        // VR * D (right) or D * VL^H (left) in O(n^2) from the packed eigenvectors, no complex matrix is formed
+        inline const Matrix<T>& EVP(const bool& right = true)
+        {
+            const size_t n = A_->GetRowsNb();
+            if (EVP_.GetRowsNb() != n || EVP_.GetColsNb() != n) EVP_ = Matrix<T>(n, n);
+            if (right) BlockMult(EVP_, VR_);
+            else
+            {
+                MatHermitian(EVP_, VL_);
+                BlockMultLeft(EVP_);
+            }
+            return EVP_;
+        }
+
+        // A reconstructed as VR * D * VR^-1 (requires COMPUTE_VR), real arithmetic only for real types.
+        // The LU factors of VR are computed once after each Compute.
+        inline const Matrix<T>& C()
+        {
+            if (C_.size() == 0)
+            {
+                if (VR_.size() == 0) throw std::runtime_error("MatrixEigen: right eigenvectors not computed");
+                const size_t n = VR_.GetRowsNb();
+                Matrix<T> VD_{n, n}, X_{n, n}, LU_{0, 0};
+                std::vector<int> ipiv_;
+                BlockMult(VD_, VR_);
+                // C^T = VR^-T * (VR * D)^T
+                MatLUFactor(LU_, ipiv_, VR_);
+                MatLUSolve(X_, LU_, ipiv_, MatTranspose(VD_), LU::SOLVE_T);
+                C_ = Matrix<T>(n, n);
+                MatTranspose(C_, X_);
+            }
+            return C_;
+        }
+
         inline const Matrix<std::complex<RealType>> AV(const bool& right = true)
         {
             if (AC_.size() == 0)
             {
+                if (A_->data().empty()) throw std::runtime_error("MatrixEigen: matrix released by Compute");
                 if constexpr (std::is_same<T, float>::value || std::is_same<T, double>::value)
                 {
 
-                    AC_ = Matrix<std::complex<RealType>>(A_.GetRowsNb(), A_.GetColsNb());
+                    AC_ = Matrix<std::complex<RealType>>(A_->GetRowsNb(), A_->GetColsNb());
                     // copy A_ into AC_
-                    for (size_t i = 0; i < A_.GetRowsNb(); i++)
-                        for (size_t j = 0; j < A_.GetColsNb(); j++) AC_(i, j) = A_(i, j);
+                    for (size_t i = 0; i < A_->GetRowsNb(); i++)
+                        for (size_t j = 0; j < A_->GetColsNb(); j++) AC_(i, j) = (*A_)(i, j);
                 }
-                else AC_ = A_;
+                else AC_ = *A_;
             }
-            if (AV_.size() == 0) AV_ = Matrix<std::complex<RealType>>(A_.GetRowsNb(), A_.GetColsNb());
+            if (AV_.size() == 0) AV_ = Matrix<std::complex<RealType>>(A_->GetRowsNb(), A_->GetColsNb());
             if (right) MatMult(AV_, AC_, VRC());
             else MatMult(AV_, MatHermitian(VLC()), AC_);
             return AV_;
         }
 
+        // VR * diag(E) (right) or diag(E) * VL^H (left), the eigenvectors are scaled in O(n^2), so that
+        // AV(right) - EV(right) is zero up to rounding
         inline const Matrix<std::complex<RealType>> EV(const bool& right = true)
         {
-
-            if (EV_.size() == 0) EV_ = Matrix<std::complex<RealType>>(A_.GetRowsNb(), A_.GetColsNb());
-            // create a diagonal matrix with eigenvalues
-            Matrix<std::complex<RealType>> D(A_.GetRowsNb(), A_.GetColsNb());
-            for (size_t i = 0; i < A_.GetRowsNb(); i++) D(i, i) = EC()(i, 0);
-            if (right) MatMult(EV_, D, VRC());
-            else MatMult(EV_, D, MatHermitian(VLC()));
-            return AV_;
+            if (EV_.size() == 0) EV_ = Matrix<std::complex<RealType>>(A_->GetRowsNb(), A_->GetColsNb());
+            const std::vector<std::complex<RealType>>& e_ = EC().data();
+            if (right) MatMultDiag(EV_, VRC(), e_);
+            else MatDiagMult(EV_, e_, MatHermitian(VLC()));
+            return EV_;
         }
 
         inline int GetFlags() const { return flags_; }
@@ -193,23 +308,110 @@ namespace la
             Matrix<T>*pVL = nullptr, *pVR = nullptr;
             if (flags_ & EIGEN::COMPUTE_VL)
             {
-                if (VL_.size() == 0) VL_ = Matrix<T>(A_.GetRowsNb(), A_.GetColsNb());
+                if (VL_.size() == 0) VL_ = Matrix<T>(A_->GetRowsNb(), A_->GetColsNb());
                 pVL = &VL_;
             }
             if (flags_ & EIGEN::COMPUTE_VR)
             {
-                if (VR_.size() == 0) VR_ = Matrix<T>(A_.GetRowsNb(), A_.GetColsNb());
+                if (VR_.size() == 0) VR_ = Matrix<T>(A_->GetRowsNb(), A_->GetColsNb());
                 pVR = &VR_;
             }
-            MatEigen<T>(E_, pVL, pVR, A_, flags_);
+            if (owner_)
+            {
+                if (A_.Own().data().empty()) throw std::runtime_error("MatrixEigen: matrix released by Compute");
+                Matrix<T> Awork = std::move(A_.Own());
+                MatEigen<T>(E_, pVL, pVR, std::move(Awork), flags_);
+            }
+            else MatEigen<T>(E_, pVL, pVR, *A_, flags_);
+            // the converted results of a previous Compute are stale
+            AC_   = Matrix<std::complex<RealType>>(0, 0);
+            EC_   = Matrix<std::complex<RealType>>(0, 0);
+            VLC_  = Matrix<std::complex<RealType>>(0, 0);
+            VRC_  = Matrix<std::complex<RealType>>(0, 0);
+            D_    = Matrix<T>(0, 0);
+            C_    = Matrix<T>(0, 0);
+            real_ = true;
+            for (size_t i = 0; i < E_.GetRowsNb(); i++)
+            {
+                if constexpr (std::is_same<T, float>::value || std::is_same<T, double>::value)
+                    real_ = real_ && E_(i, 1) == T(0);
+                else real_ = real_ && E_(i, 0).imag() == RealType(0);
+            }
             return E_;
         }
 
       private:
-        const Matrix<T>& A_;
+        // R = V * D, the 2 x 2 blocks only mix the two columns of a pair
+        inline void BlockMult(Matrix<T>& R, const Matrix<T>& V) const
+        {
+            const size_t m = V.GetRowsNb(), n = V.GetColsNb();
+            for (size_t j = 0; j < n; ++j)
+            {
+                const T a = E_(j, 0);
+                if constexpr (std::is_same<T, float>::value || std::is_same<T, double>::value)
+                {
+                    if (E_(j, 1) > T(0) && j + 1 < n)
+                    {
+                        const T b = E_(j, 1);
+                        for (size_t i = 0; i < m; ++i)
+                        {
+                            const T vr = V(i, j), vi = V(i, j + 1);
+                            R(i, j)     = a * vr - b * vi;
+                            R(i, j + 1) = b * vr + a * vi;
+                        }
+                        ++j;
+                        continue;
+                    }
+                }
+                for (size_t i = 0; i < m; ++i) R(i, j) = a * V(i, j);
+            }
+        }
+
+        // W = D * W in place, the 2 x 2 blocks only mix the two rows of a pair
+        inline void BlockMultLeft(Matrix<T>& W) const
+        {
+            const size_t m = W.GetRowsNb(), n = W.GetColsNb();
+            for (size_t j = 0; j < n; ++j)
+                for (size_t i = 0; i < m; ++i)
+                {
+                    const T a = E_(i, 0);
+                    if constexpr (std::is_same<T, float>::value || std::is_same<T, double>::value)
+                    {
+                        if (E_(i, 1) > T(0) && i + 1 < m)
+                        {
+                            const T b = E_(i, 1), wr = W(i, j), wi = W(i + 1, j);
+                            W(i, j)     = a * wr + b * wi;
+                            W(i + 1, j) = a * wi - b * wr;
+                            ++i;
+                            continue;
+                        }
+                    }
+                    W(i, j) *= a;
+                }
+        }
+
+        inline void Allocate()
+        {
+            if constexpr (std::is_same<T, float>::value || std::is_same<T, double>::value)
+            {
+                E_ = Matrix<T>(A_->GetRowsNb(), 2);
+            }
+            else if constexpr (std::is_same<T, std::complex<float>>::value ||
+                               std::is_same<T, std::complex<double>>::value)
+            {
+                E_ = Matrix<T>(A_->GetRowsNb(), 1);
+            }
+            else { throw std::invalid_argument("MatrixEigen: invalid type"); }
+        }
+
+        OwnedMatrix<T> A_;
         Matrix<T> E_;
         Matrix<T> VL_;
         Matrix<T> VR_;
+        Matrix<T> D_;
+        Matrix<T> AVP_;
+        Matrix<T> EVP_;
+        Matrix<T> C_;
         Matrix<std::complex<RealType>> AC_;
         Matrix<std::complex<RealType>> EC_;
         Matrix<std::complex<RealType>> VLC_;
@@ -218,6 +420,8 @@ namespace la
         Matrix<std::complex<RealType>> EV_;
 
         int flags_;
+        bool owner_;
+        bool real_;
     };
 
 } // namespace la
@@ -0,0 +1,194 @@
+/************************/
+/*la_lapack_eigen_gen.cpp*/
+/*    Version 1.0       */
+/*     2026/10/19       */
+/************************/
+
+#include <algorithm>
+#include <cassert>
+#include <complex>
+#include <type_traits>
+#include <utility>
+#include "la_lapack_eigen_gen.h"
+#include "la_lapack_macro.h"
+#include "lapack_interface.h"
+
+#define INT_C(x)      static_cast<int>(x)
+#define SIZE_T_C(x)   static_cast<size_t>(x)
+#define FLOAT_P_R(x)  reinterpret_cast<float*>(x)
+#define DOUBLE_P_R(x) reinterpret_cast<double*>(x)
+
+namespace la
+{
+    template <typename T>
+    Matrix<T>& MatGenEigen(Matrix<T>& alpha, Matrix<T>& beta, Matrix<T>* pVL, Matrix<T>* pVR, Matrix<T>&& A,
+                           Matrix<T>&& B, const int& flags, LapackWork<T>* pWork)
+    {
+        (void)flags;
+        assert(A.GetRowsNb() == A.GetColsNb());
+        assert(B.GetRowsNb() == A.GetRowsNb() && B.GetColsNb() == A.GetColsNb());
+        assert(alpha.GetRowsNb() == A.GetRowsNb());
+        assert(beta.GetRowsNb() == A.GetRowsNb() && beta.GetColsNb() == 1);
+        int n = INT_C(A.GetRowsNb());
+        char jobvl = pVL ? 'V' : 'N', jobvr = pVR ? 'V' : 'N';
+        // ?ggev references the eigenvector arrays with ld >= 1 even when they are not computed
+        T dummy[1];
+        T* vl = dummy;
+        T* vr = dummy;
+        if (pVL)
+        {
+            assert(pVL->GetRowsNb() == A.GetRowsNb() && pVL->GetColsNb() == A.GetColsNb());
+            vl = pVL->data().data();
+        }
+        if (pVR)
+        {
+            assert(pVR->GetRowsNb() == A.GetRowsNb() && pVR->GetColsNb() == A.GetColsNb());
+            vr = pVR->data().data();
+        }
+        int lda = std::max(n, 1), ldb = lda, ldvl = pVL ? lda : 1, ldvr = pVR ? lda : 1, lwork = -1, info = 0;
+        LapackWork<T> local_;
+        LapackWork<T>& w_ = pWork ? *pWork : local_;
+        T wkopt;
+        T *a = A.data().data(), *b = B.data().data(), *bt = beta.data().data();
+        if constexpr (std::is_same_v<T, float> || std::is_same_v<T, double>)
+        {
+            assert(alpha.GetColsNb() == 2);
+            T *ar = &alpha.data()[0], *ai = &alpha.data()[SIZE_T_C(n)];
+            for (int pass = 0; pass < 2; ++pass)
+            {
+                T* work = pass ? w_.work.data() : &wkopt;
+                if constexpr (std::is_same_v<T, float>)
+                    sggev_(&jobvl, &jobvr, &n, a, &lda, b, &ldb, ar, ai, bt, vl, &ldvl, vr, &ldvr, work, &lwork, &info);
+                else
+                    dggev_(&jobvl, &jobvr, &n, a, &lda, b, &ldb, ar, ai, bt, vl, &ldvl, vr, &ldvr, work, &lwork, &info);
+                if (info != 0 || pass) break;
+                lwork = std::max(INT_C(wkopt), 1);
+                if (w_.work.size() < SIZE_T_C(lwork)) w_.work.resize(SIZE_T_C(lwork));
+            }
+        }
+        else if constexpr (std::is_same_v<T, std::complex<float>> || std::is_same_v<T, std::complex<double>>)
+        {
+            assert(alpha.GetColsNb() == 1);
+            if (w_.rwork.size() < 8 * SIZE_T_C(n)) w_.rwork.resize(8 * SIZE_T_C(n));
+            T* al = alpha.data().data();
+            for (int pass = 0; pass < 2; ++pass)
+            {
+                T* work = pass ? w_.work.data() : &wkopt;
+                if constexpr (std::is_same_v<T, std::complex<float>>)
+                    cggev_(&jobvl, &jobvr, &n, FLOAT_P_R(a), &lda, FLOAT_P_R(b), &ldb, FLOAT_P_R(al), FLOAT_P_R(bt),
+                           FLOAT_P_R(vl), &ldvl, FLOAT_P_R(vr), &ldvr, FLOAT_P_R(work), &lwork, w_.rwork.data(), &info);
+                else
+                    zggev_(&jobvl, &jobvr, &n, DOUBLE_P_R(a), &lda, DOUBLE_P_R(b), &ldb, DOUBLE_P_R(al), DOUBLE_P_R(bt),
+                           DOUBLE_P_R(vl), &ldvl, DOUBLE_P_R(vr), &ldvr, DOUBLE_P_R(work), &lwork, w_.rwork.data(),
+                           &info);
+                if (info != 0 || pass) break;
+                lwork = std::max(INT_C(wkopt.real()), 1);
+                if (w_.work.size() < SIZE_T_C(lwork)) w_.work.resize(SIZE_T_C(lwork));
+            }
+        }
+        else { throw std::runtime_error("MatGenEigen: unsupported type"); }
+        if (info < 0) throw std::runtime_error("MatGenEigen: illegal value");
+        else if (info > 0) throw std::runtime_error("MatGenEigen: failed to converge");
+        return alpha;
+    }
+
+    template <typename T>
+    Matrix<T>& MatGenEigen(Matrix<T>& alpha, Matrix<T>& beta, Matrix<T>* pVL, Matrix<T>* pVR, const Matrix<T>& A,
+                           const Matrix<T>& B, const int& flags, LapackWork<T>* pWork)
+    {
+        return MatGenEigen(alpha, beta, pVL, pVR, Matrix<T>(A), Matrix<T>(B), flags, pWork);
+    }
+
+    template <typename T>
+    Matrix<RealTypeOf<T>>& MatGenEigenSym(Matrix<RealTypeOf<T>>& E, Matrix<T>* pV, Matrix<T>&& A, Matrix<T>&& B,
+                                          const int& flags, LapackWork<T>* pWork)
+    {
+        REALTYPE_DEFINE
+        assert(A.GetRowsNb() == A.GetColsNb());
+        assert(B.GetRowsNb() == A.GetRowsNb() && B.GetColsNb() == A.GetColsNb());
+        assert(E.GetRowsNb() == A.GetRowsNb());
+        char jobz = pV ? 'V' : 'N', uplo = (flags & GEN_EIGEN::LOWER) ? 'L' : 'U';
+        int itype = 1, n = INT_C(A.GetRowsNb()), lda = std::max(n, 1), ldb = lda, info = 0;
+        int lwork = -1, lrwork = -1, liwork = -1, iwkopt = 0;
+        RealType rwkopt = 0;
+        T wkopt;
+        LapackWork<T> local_;
+        LapackWork<T>& w_ = pWork ? *pWork : local_;
+        T *a = A.data().data(), *b = B.data().data();
+        RealType* e = E.data().data();
+        for (int pass = 0; pass < 2; ++pass)
+        {
+            T* work    = pass ? w_.work.data() : &wkopt;
+            int* iwork = pass ? w_.iwork.data() : &iwkopt;
+            if constexpr (std::is_same_v<T, float>)
+                ssygvd_(&itype, &jobz, &uplo, &n, a, &lda, b, &ldb, e, work, &lwork, iwork, &liwork, &info);
+            else if constexpr (std::is_same_v<T, double>)
+                dsygvd_(&itype, &jobz, &uplo, &n, a, &lda, b, &ldb, e, work, &lwork, iwork, &liwork, &info);
+            else if constexpr (std::is_same_v<T, std::complex<float>>)
+                chegvd_(&itype, &jobz, &uplo, &n, FLOAT_P_R(a), &lda, FLOAT_P_R(b), &ldb, e, FLOAT_P_R(work), &lwork,
+                        pass ? w_.rwork.data() : &rwkopt, &lrwork, iwork, &liwork, &info);
+            else if constexpr (std::is_same_v<T, std::complex<double>>)
+                zhegvd_(&itype, &jobz, &uplo, &n, DOUBLE_P_R(a), &lda, DOUBLE_P_R(b), &ldb, e, DOUBLE_P_R(work), &lwork,
+                        pass ? w_.rwork.data() : &rwkopt, &lrwork, iwork, &liwork, &info);
+            else throw std::runtime_error("MatGenEigenSym: unsupported type");
+            if (info != 0 || pass) break;
+            // grow the workspaces from the query
+            lwork  = std::max(INT_C(std::real(wkopt)), 1);
+            liwork = std::max(iwkopt, 1);
+            lrwork = std::max(INT_C(rwkopt), 1);
+            if (w_.work.size() < SIZE_T_C(lwork)) w_.work.resize(SIZE_T_C(lwork));
+            if (w_.iwork.size() < SIZE_T_C(liwork)) w_.iwork.resize(SIZE_T_C(liwork));
+            if (w_.rwork.size() < SIZE_T_C(lrwork)) w_.rwork.resize(SIZE_T_C(lrwork));
+        }
+        if (info < 0) throw std::runtime_error("MatGenEigenSym: illegal value");
+        else if (info > n) throw std::runtime_error("MatGenEigenSym: B is not positive definite");
+        else if (info > 0) throw std::runtime_error("MatGenEigenSym: failed to converge");
+        if (pV)
+        {
+            // the eigenvectors overwrite A
+            assert(pV->GetRowsNb() == A.GetRowsNb() && pV->GetColsNb() == A.GetColsNb());
+            std::copy(A.data().begin(), A.data().end(), pV->data().begin());
+        }
+        return E;
+    }
+
+    template <typename T>
+    Matrix<RealTypeOf<T>>& MatGenEigenSym(Matrix<RealTypeOf<T>>& E, Matrix<T>* pV, const Matrix<T>& A,
+                                          const Matrix<T>& B, const int& flags, LapackWork<T>* pWork)
+    {
+        return MatGenEigenSym(E, pV, Matrix<T>(A), Matrix<T>(B), flags, pWork);
+    }
+
+} // namespace la
+
+#undef DOUBLE_P_R
+#undef FLOAT_P_R
+#undef INT_C
+#undef SIZE_T_C
+
+#define INSTANTIATE_EIGEN_GEN_TEMPLATE(type)                                                                           \
+    template la::Matrix<type>& la::MatGenEigen<type>(la::Matrix<type>&, la::Matrix<type>&, la::Matrix<type>*,          \
+                                                     la::Matrix<type>*, la::Matrix<type>&&, la::Matrix<type>&&,        \
+                                                     const int&, la::LapackWork<type>*);                               \
+    template la::Matrix<type>& la::MatGenEigen<type>(la::Matrix<type>&, la::Matrix<type>&, la::Matrix<type>*,          \
+                                                     la::Matrix<type>*, const la::Matrix<type>&,                       \
+                                                     const la::Matrix<type>&, const int&, la::LapackWork<type>*);      \
+    template la::Matrix<la::RealTypeOf<type>>& la::MatGenEigenSym<type>(la::Matrix<la::RealTypeOf<type>>&,             \
+                                                                        la::Matrix<type>*, la::Matrix<type>&&,         \
+                                                                        la::Matrix<type>&&, const int&,                \
+                                                                        la::LapackWork<type>*);                        \
+    template la::Matrix<la::RealTypeOf<type>>& la::MatGenEigenSym<type>(la::Matrix<la::RealTypeOf<type>>&,             \
+                                                                        la::Matrix<type>*, const la::Matrix<type>&,    \
+                                                                        const la::Matrix<type>&, const int&,           \
+                                                                        la::LapackWork<type>*);
+
+#define INSTANTIATE_ALL_EIGEN_GEN_TEMPLATES                                                                            \
+    INSTANTIATE_EIGEN_GEN_TEMPLATE(float)                                                                              \
+    INSTANTIATE_EIGEN_GEN_TEMPLATE(double)                                                                             \
+    INSTANTIATE_EIGEN_GEN_TEMPLATE(std::complex<float>)                                                                \
+    INSTANTIATE_EIGEN_GEN_TEMPLATE(std::complex<double>)
+
+INSTANTIATE_ALL_EIGEN_GEN_TEMPLATES
+
+#undef INSTANTIATE_EIGEN_GEN_TEMPLATE
+#undef INSTANTIATE_ALL_EIGEN_GEN_TEMPLATES
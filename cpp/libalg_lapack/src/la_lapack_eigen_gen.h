@@ -0,0 +1,230 @@
+#ifndef _LA_LAPACK_EIGEN_GEN_H_8B4401984C5E46018E4D4DC9CE42995E_
+#define _LA_LAPACK_EIGEN_GEN_H_8B4401984C5E46018E4D4DC9CE42995E_
+
+/************************/
+/* la_lapack_eigen_gen.h*/
+/*    Version 1.0       */
+/*     2026/10/19       */
+/************************/
+
+#ifndef USE_LAPACK
+#error "USE_LAPACK is not defined"
+#endif
+
+#include <complex>
+#include <limits>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include "la_blas_mult.h"
+#include "la_lapack_macro.h"
+#include "math/algebra/matrix.h"
+#include "math/algebra/matrix_operations.h"
+
+namespace la
+{
+
+    namespace GEN_EIGEN
+    {
+        enum Flags : int {
+            COMPUTE_VL = 1 << 0,
+            COMPUTE_VR = 1 << 1,
+            // symmetric (hermitian) A and symmetric (hermitian) positive definite B, MatrixGenEigen uses ?sygvd
+            SYMMETRIC  = 1 << 2,
+            // use the lower triangles of A and B instead of the upper ones (SYMMETRIC only)
+            LOWER      = 1 << 3,
+        };
+    }
+
+    // Generalized eigenvalues lambda = alpha / beta of the pair (A, B), A * x = lambda * B * x (?ggev), B is not
+    // inverted and may be singular (beta is then zero for the infinite eigenvalues).
+    // alpha is n x 2 (real and imaginary parts) for real types and n x 1 for complex types, beta is n x 1.
+    // pVL and pVR, when not null, are n x n and receive the left and right eigenvectors, for real types a complex
+    // pair is stored as in MatEigen in two consecutive columns (real and imaginary part of the first one).
+    // The contents of A and B are undefined on exit, pWork keeps the workspaces between calls.
+    template <typename T>
+    Matrix<T>& MatGenEigen(Matrix<T>& alpha, Matrix<T>& beta, Matrix<T>* pVL, Matrix<T>* pVR, Matrix<T>&& A,
+                           Matrix<T>&& B, const int& flags = 0, LapackWork<T>* pWork = nullptr);
+
+    template <typename T>
+    Matrix<T>& MatGenEigen(Matrix<T>& alpha, Matrix<T>& beta, Matrix<T>* pVL, Matrix<T>* pVR, const Matrix<T>& A,
+                           const Matrix<T>& B, const int& flags = 0, LapackWork<T>* pWork = nullptr);
+
+    // Symmetric-definite pair, A real symmetric or complex hermitian and B positive definite (?sygvd / ?hegvd).
+    // Only the upper (or lower with LOWER flag) triangles are referenced, E is n x 1 with the real eigenvalues in
+    // ascending order and pV, when not null, is n x n with the eigenvectors normalized so that V^H * B * V = I.
+    // The contents of A and B are undefined on exit, pWork keeps the workspaces between calls.
+    template <typename T>
+    Matrix<RealTypeOf<T>>& MatGenEigenSym(Matrix<RealTypeOf<T>>& E, Matrix<T>* pV, Matrix<T>&& A, Matrix<T>&& B,
+                                          const int& flags = 0, LapackWork<T>* pWork = nullptr);
+
+    template <typename T>
+    Matrix<RealTypeOf<T>>& MatGenEigenSym(Matrix<RealTypeOf<T>>& E, Matrix<T>* pV, const Matrix<T>& A,
+                                          const Matrix<T>& B, const int& flags = 0, LapackWork<T>* pWork = nullptr);
+
+    template <typename T> class MatrixGenEigen
+    {
+
+        REALTYPE_DEFINE
+      public:
+        inline MatrixGenEigen(const Matrix<T>& A, const Matrix<T>& B)
+            : A_(A), B_(B), Aw_(0, 0), Bw_(0, 0), alpha_(0, 0), beta_(0, 0), E_(0, 0), Es_(0, 0), VL_(0, 0),
+              VR_(0, 0), EC_(0, 0), VLC_(0, 0), VRC_(0, 0), flags_(0)
+        {
+            if (A.GetRowsNb() != A.GetColsNb() || B.GetRowsNb() != B.GetColsNb() || A.GetRowsNb() != B.GetRowsNb())
+                throw std::invalid_argument("MatrixGenEigen: A and B must be square and of the same size");
+        }
+
+        inline const Matrix<T>& A() const { return A_; }
+
+        inline const Matrix<T>& B() const { return B_; }
+
+        // ?ggev output, beta is one with SYMMETRIC
+        inline const Matrix<T>& alpha() const { return alpha_; }
+
+        inline const Matrix<T>& beta() const { return beta_; }
+
+        // eigenvalues alpha / beta in the layout of MatrixEigen::E(), infinite for a zero beta
+        inline const Matrix<T>& E() const { return E_; }
+
+        inline const Matrix<std::complex<RealType>>& EC()
+        {
+            if constexpr (std::is_same<T, float>::value || std::is_same<T, double>::value)
+            {
+                if (EC_.size() == 0)
+                {
+                    EC_ = Matrix<std::complex<RealType>>(E_.GetRowsNb(), 1);
+                    for (size_t i = 0; i < E_.GetRowsNb(); i++) EC_(i, 0) = std::complex<RealType>(E_(i, 0), E_(i, 1));
+                }
+                return EC_;
+            }
+            else return E_;
+        }
+
+        inline const Matrix<T>& VL() const { return VL_; }
+
+        inline const Matrix<T>& VR() const { return VR_; }
+
+        inline const Matrix<std::complex<RealType>>& VLC()
+        {
+            if constexpr (std::is_same<T, float>::value || std::is_same<T, double>::value)
+            {
+                if (VLC_.size() == 0) Unpack(VLC_, VL_);
+                return VLC_;
+            }
+            else return VL_;
+        }
+
+        inline const Matrix<std::complex<RealType>>& VRC()
+        {
+            if constexpr (std::is_same<T, float>::value || std::is_same<T, double>::value)
+            {
+                if (VRC_.size() == 0) Unpack(VRC_, VR_);
+                return VRC_;
+            }
+            else return VR_;
+        }
+
+        inline int GetFlags() const { return flags_; }
+
+        inline void SetFlags(int flags) { flags_ = flags; }
+
+        // With SYMMETRIC the eigenvalues are real and in ascending order, VR() holds the B-orthonormal eigenvectors
+        // and VL() is not computed. The working copies of A and B, the outputs and the LAPACK workspaces are kept,
+        // so calling Compute again after changing the matrices (of the same size) does not allocate.
+        inline const Matrix<T>& Compute(const int& flags = 0)
+        {
+            flags_         = flags;
+            const size_t n = A_.GetRowsNb();
+            Aw_            = A_;
+            Bw_            = B_;
+            EC_            = Matrix<std::complex<RealType>>(0, 0);
+            VLC_           = Matrix<std::complex<RealType>>(0, 0);
+            VRC_           = Matrix<std::complex<RealType>>(0, 0);
+            Matrix<T>*pVL  = nullptr, *pVR = nullptr;
+            if ((flags_ & GEN_EIGEN::COMPUTE_VL) && !(flags_ & GEN_EIGEN::SYMMETRIC))
+            {
+                if (VL_.GetRowsNb() != n || VL_.GetColsNb() != n) VL_ = Matrix<T>(n, n);
+                pVL = &VL_;
+            }
+            if (flags_ & GEN_EIGEN::COMPUTE_VR)
+            {
+                if (VR_.GetRowsNb() != n || VR_.GetColsNb() != n) VR_ = Matrix<T>(n, n);
+                pVR = &VR_;
+            }
+            constexpr size_t nc = (std::is_same<T, float>::value || std::is_same<T, double>::value) ? 2 : 1;
+            if (alpha_.GetRowsNb() != n) alpha_ = Matrix<T>(n, nc);
+            if (beta_.GetRowsNb() != n) beta_ = Matrix<T>(n, 1);
+            if (E_.GetRowsNb() != n) E_ = Matrix<T>(n, nc);
+            if (flags_ & GEN_EIGEN::SYMMETRIC)
+            {
+                if (Es_.GetRowsNb() != n) Es_ = Matrix<RealType>(n, 1);
+                MatGenEigenSym<T>(Es_, pVR, std::move(Aw_), std::move(Bw_), flags_, &work_);
+                alpha_.Zeros();
+                for (size_t i = 0; i < n; i++)
+                {
+                    alpha_(i, 0) = static_cast<T>(Es_(i, 0));
+                    beta_(i, 0)  = static_cast<T>(1);
+                }
+            }
+            else MatGenEigen<T>(alpha_, beta_, pVL, pVR, std::move(Aw_), std::move(Bw_), flags_, &work_);
+            constexpr RealType inf = std::numeric_limits<RealType>::infinity();
+            for (size_t i = 0; i < n; i++)
+            {
+                const T b = beta_(i, 0);
+                if (b == static_cast<T>(0))
+                {
+                    // infinite eigenvalue, its imaginary part (real types) is only infinite for a complex pair
+                    E_(i, 0) = static_cast<T>(inf);
+                    if (nc == 2) E_(i, 1) = alpha_(i, 1) == static_cast<T>(0) ? static_cast<T>(0) : static_cast<T>(inf);
+                }
+                else
+                    for (size_t j = 0; j < nc; j++) E_(i, j) = alpha_(i, j) / b;
+            }
+            return E_;
+        }
+
+      private:
+        // complex eigenvectors from the real packed ones, a pair starts at a positive imaginary part of alpha
+        inline void Unpack(Matrix<std::complex<RealType>>& VC, const Matrix<T>& V) const
+        {
+            const size_t n = V.GetRowsNb(), m = V.GetColsNb();
+            VC             = Matrix<std::complex<RealType>>(n, m);
+            for (size_t j = 0; j < m; j++)
+            {
+                if (j + 1 < m && alpha_.GetColsNb() == 2 && alpha_(j, 1) > RealType(0))
+                {
+                    for (size_t i = 0; i < n; i++)
+                    {
+                        VC(i, j)     = std::complex<RealType>(V(i, j), V(i, j + 1));
+                        VC(i, j + 1) = std::complex<RealType>(V(i, j), -V(i, j + 1));
+                    }
+                    j++;
+                }
+                else
+                    for (size_t i = 0; i < n; i++) VC(i, j) = std::complex<RealType>(V(i, j), 0);
+            }
+        }
+
+        const Matrix<T>& A_;
+        const Matrix<T>& B_;
+        // working copies overwritten by LAPACK
+        Matrix<T> Aw_;
+        Matrix<T> Bw_;
+        Matrix<T> alpha_;
+        Matrix<T> beta_;
+        Matrix<T> E_;
+        Matrix<RealType> Es_;
+        Matrix<T> VL_;
+        Matrix<T> VR_;
+        Matrix<std::complex<RealType>> EC_;
+        Matrix<std::complex<RealType>> VLC_;
+        Matrix<std::complex<RealType>> VRC_;
+        LapackWork<T> work_;
+        int flags_;
+    };
+
+} // namespace la
+
+#endif
@@ -0,0 +1,200 @@
+/************************/
+/*la_lapack_eigen_sym.cpp*/
+/*    Version 1.0       */
+/*     2026/10/19       */
+/************************/
+
+#include <algorithm>
+#include <cassert>
+#include <complex>
+#include <type_traits>
+#include <typeinfo>
+#include "la_lapack_eigen_sym.h"
+#include "la_lapack_macro.h"
+#include "lapack_interface.h"
+
+#define INT_C(x)      static_cast<int>(x)
+#define SIZE_T_C(x)   static_cast<size_t>(x)
+#define FLOAT_P_R(x)  reinterpret_cast<float*>(x)
+#define DOUBLE_P_R(x) reinterpret_cast<double*>(x)
+
+namespace la
+{
+    namespace
+    {
+        // call ?syevr / ?heevr with range 'A', 'I' or 'V' and return the number of eigenvalues found
+        template <typename T>
+        size_t EigenSymRange(Matrix<RealTypeOf<T>>& E, Matrix<T>* pV, const Matrix<T>& A, char range,
+                             RealTypeOf<T> vl, RealTypeOf<T> vu, int il, int iu, const int& flags)
+        {
+            REALTYPE_DEFINE
+            assert(A.GetRowsNb() == A.GetColsNb());
+            char jobz = pV ? 'V' : 'N';
+            char uplo = (flags & EIGEN_SYM::LOWER) ? 'L' : 'U';
+            int n = INT_C(A.GetRowsNb()), lda = std::max(n, 1), ldz = std::max(n, 1), m = 0, info = 0;
+            int lwork = -1, lrwork = -1, liwork = -1, iwkopt = 0;
+            RealType abstol = 0, rwkopt = 0;
+            T wkopt;
+            Matrix<T> Atmp = A;
+            // the number of eigenvalues in a value range is not known in advance
+            const size_t nMax = (range == 'I') ? SIZE_T_C(iu - il + 1) : SIZE_T_C(n);
+            std::vector<RealType> w(SIZE_T_C(n));
+            std::vector<T> z(pV ? SIZE_T_C(n) * nMax : 1), work;
+            std::vector<RealType> rwork;
+            std::vector<int> isuppz(2 * std::max(nMax, SIZE_T_C(1))), iwork;
+            for (int pass = 0; pass < 2; ++pass)
+            {
+                if constexpr (std::is_same_v<T, float>)
+                    ssyevr_(&jobz, &range, &uplo, &n, Atmp.data().data(), &lda, &vl, &vu, &il, &iu, &abstol, &m,
+                            w.data(), z.data(), &ldz, isuppz.data(), pass ? work.data() : &wkopt, &lwork,
+                            pass ? iwork.data() : &iwkopt, &liwork, &info);
+                else if constexpr (std::is_same_v<T, double>)
+                    dsyevr_(&jobz, &range, &uplo, &n, Atmp.data().data(), &lda, &vl, &vu, &il, &iu, &abstol, &m,
+                            w.data(), z.data(), &ldz, isuppz.data(), pass ? work.data() : &wkopt, &lwork,
+                            pass ? iwork.data() : &iwkopt, &liwork, &info);
+                else if constexpr (std::is_same_v<T, std::complex<float>>)
+                    cheevr_(&jobz, &range, &uplo, &n, FLOAT_P_R(Atmp.data().data()), &lda, &vl, &vu, &il, &iu, &abstol,
+                            &m, w.data(), FLOAT_P_R(z.data()), &ldz, isuppz.data(),
+                            FLOAT_P_R(pass ? work.data() : &wkopt), &lwork, pass ? rwork.data() : &rwkopt, &lrwork,
+                            pass ? iwork.data() : &iwkopt, &liwork, &info);
+                else if constexpr (std::is_same_v<T, std::complex<double>>)
+                    zheevr_(&jobz, &range, &uplo, &n, DOUBLE_P_R(Atmp.data().data()), &lda, &vl, &vu, &il, &iu,
+                            &abstol, &m, w.data(), DOUBLE_P_R(z.data()), &ldz, isuppz.data(),
+                            DOUBLE_P_R(pass ? work.data() : &wkopt), &lwork, pass ? rwork.data() : &rwkopt, &lrwork,
+                            pass ? iwork.data() : &iwkopt, &liwork, &info);
+                else throw std::runtime_error("MatEigenSym: unsupported type");
+                if (info < 0) throw std::runtime_error("MatEigenSym: illegal value");
+                else if (info > 0) throw std::runtime_error("MatEigenSym: internal error");
+                if (pass == 0)
+                {
+                    // allocate the workspaces from the query
+                    lwork  = INT_C(std::real(wkopt));
+                    liwork = iwkopt;
+                    lrwork = INT_C(rwkopt);
+                    work.resize(SIZE_T_C(std::max(lwork, 1)));
+                    iwork.resize(SIZE_T_C(std::max(liwork, 1)));
+                    rwork.resize(SIZE_T_C(std::max(lrwork, 1)));
+                }
+            }
+            const size_t nFound = SIZE_T_C(m);
+            E.Resize(nFound, 1);
+            for (size_t i = 0; i < nFound; ++i) E(i, 0) = w[i];
+            if (pV)
+            {
+                pV->Resize(SIZE_T_C(n), nFound);
+                std::copy(z.begin(), z.begin() + static_cast<std::ptrdiff_t>(SIZE_T_C(n) * nFound),
+                          pV->data().begin());
+            }
+            return nFound;
+        }
+    } // namespace
+
+    template <typename T>
+    Matrix<RealTypeOf<T>>& MatEigenSym(Matrix<RealTypeOf<T>>& E, Matrix<T>* pV, const Matrix<T>& A, const int& flags)
+    {
+        REALTYPE_DEFINE
+        assert(A.GetRowsNb() == A.GetColsNb());
+        assert(E.GetRowsNb() == A.GetRowsNb());
+        char jobz = pV ? 'V' : 'N';
+        char uplo = (flags & EIGEN_SYM::LOWER) ? 'L' : 'U';
+        int n = INT_C(A.GetRowsNb()), lda = std::max(n, 1), info = 0;
+        int lwork = -1, lrwork = -1, liwork = -1, iwkopt = 0;
+        RealType rwkopt = 0;
+        T wkopt;
+        // the eigenvectors overwrite the input matrix, so A is copied directly in V when requested
+        Matrix<T> Atmp{0, 0};
+        T* a = nullptr;
+        if (pV)
+        {
+            assert(pV->GetRowsNb() == A.GetRowsNb());
+            assert(pV->GetColsNb() == A.GetColsNb());
+            *pV = A;
+            a   = pV->data().data();
+        }
+        else
+        {
+            Atmp = A;
+            a    = Atmp.data().data();
+        }
+        std::vector<RealType> w(SIZE_T_C(n)), rwork;
+        std::vector<T> work;
+        std::vector<int> iwork;
+        for (int pass = 0; pass < 2; ++pass)
+        {
+            if constexpr (std::is_same_v<T, float>)
+                ssyevd_(&jobz, &uplo, &n, a, &lda, w.data(), pass ? work.data() : &wkopt, &lwork,
+                        pass ? iwork.data() : &iwkopt, &liwork, &info);
+            else if constexpr (std::is_same_v<T, double>)
+                dsyevd_(&jobz, &uplo, &n, a, &lda, w.data(), pass ? work.data() : &wkopt, &lwork,
+                        pass ? iwork.data() : &iwkopt, &liwork, &info);
+            else if constexpr (std::is_same_v<T, std::complex<float>>)
+                cheevd_(&jobz, &uplo, &n, FLOAT_P_R(a), &lda, w.data(), FLOAT_P_R(pass ? work.data() : &wkopt), &lwork,
+                        pass ? rwork.data() : &rwkopt, &lrwork, pass ? iwork.data() : &iwkopt, &liwork, &info);
+            else if constexpr (std::is_same_v<T, std::complex<double>>)
+                zheevd_(&jobz, &uplo, &n, DOUBLE_P_R(a), &lda, w.data(), DOUBLE_P_R(pass ? work.data() : &wkopt),
+                        &lwork, pass ? rwork.data() : &rwkopt, &lrwork, pass ? iwork.data() : &iwkopt, &liwork, &info);
+            else throw std::runtime_error("MatEigenSym: unsupported type");
+            if (info < 0) throw std::runtime_error("MatEigenSym: illegal value");
+            else if (info > 0) throw std::runtime_error("MatEigenSym: failed to converge");
+            if (pass == 0)
+            {
+                lwork  = INT_C(std::real(wkopt));
+                liwork = iwkopt;
+                lrwork = INT_C(rwkopt);
+                work.resize(SIZE_T_C(std::max(lwork, 1)));
+                iwork.resize(SIZE_T_C(std::max(liwork, 1)));
+                rwork.resize(SIZE_T_C(std::max(lrwork, 1)));
+            }
+        }
+        for (size_t i = 0; i < SIZE_T_C(n); ++i) E(i, 0) = w[i];
+        return E;
+    }
+
+    template <typename T>
+    Matrix<RealTypeOf<T>>& MatEigenSymIndex(Matrix<RealTypeOf<T>>& E, Matrix<T>* pV, const Matrix<T>& A,
+                                            const size_t& il, const size_t& iu, const int& flags)
+    {
+        assert(il <= iu && iu < A.GetRowsNb());
+        // LAPACK indices are 1 based
+        EigenSymRange<T>(E, pV, A, 'I', 0, 0, INT_C(il) + 1, INT_C(iu) + 1, flags);
+        return E;
+    }
+
+    template <typename T>
+    Matrix<RealTypeOf<T>>& MatEigenSymValue(Matrix<RealTypeOf<T>>& E, Matrix<T>* pV, const Matrix<T>& A,
+                                            const RealTypeOf<T>& vl, const RealTypeOf<T>& vu, const int& flags)
+    {
+        assert(vl < vu);
+        EigenSymRange<T>(E, pV, A, 'V', vl, vu, 0, 0, flags);
+        return E;
+    }
+
+} // namespace la
+
+#undef DOUBLE_P_R
+#undef FLOAT_P_R
+#undef INT_C
+#undef SIZE_T_C
+
+// Explicit template instantiation
+#define INSTANTIATE_EIGEN_SYM_TEMPLATE(type)                                                                           \
+    template la::Matrix<la::RealTypeOf<type>>& la::MatEigenSym<type>(la::Matrix<la::RealTypeOf<type>>&,                \
+                                                                     la::Matrix<type>*, const la::Matrix<type>&,       \
+                                                                     const int&);                                      \
+    template la::Matrix<la::RealTypeOf<type>>& la::MatEigenSymIndex<type>(                                             \
+        la::Matrix<la::RealTypeOf<type>>&, la::Matrix<type>*, const la::Matrix<type>&, const size_t&, const size_t&,   \
+        const int&);                                                                                                   \
+    template la::Matrix<la::RealTypeOf<type>>& la::MatEigenSymValue<type>(                                             \
+        la::Matrix<la::RealTypeOf<type>>&, la::Matrix<type>*, const la::Matrix<type>&, const la::RealTypeOf<type>&,    \
+        const la::RealTypeOf<type>&, const int&);
+
+#define INSTANTIATE_ALL_EIGEN_SYM_TEMPLATES                                                                            \
+    INSTANTIATE_EIGEN_SYM_TEMPLATE(float)                                                                              \
+    INSTANTIATE_EIGEN_SYM_TEMPLATE(double)                                                                             \
+    INSTANTIATE_EIGEN_SYM_TEMPLATE(std::complex<float>)                                                                \
+    INSTANTIATE_EIGEN_SYM_TEMPLATE(std::complex<double>)
+
+INSTANTIATE_ALL_EIGEN_SYM_TEMPLATES
+
+#undef INSTANTIATE_EIGEN_SYM_TEMPLATE
+#undef INSTANTIATE_ALL_EIGEN_SYM_TEMPLATES
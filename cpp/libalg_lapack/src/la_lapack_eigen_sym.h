@@ -0,0 +1,150 @@
+#ifndef _LA_LAPACK_EIGEN_SYM_H_416FFBC89CD942F4B07C6B00279FA2F0_
+#define _LA_LAPACK_EIGEN_SYM_H_416FFBC89CD942F4B07C6B00279FA2F0_
+
+/************************/
+/* la_lapack_eigen_sym.h*/
+/*    Version 1.0       */
+/*     2026/10/19       */
+/************************/
+
+#ifndef USE_LAPACK
+#error "USE_LAPACK is not defined"
+#endif
+
+#include <cassert>
+#include <complex>
+#include <type_traits>
+#include <typeinfo>
+#include "la_blas_mult.h"
+#include "la_lapack_macro.h"
+#include "math/algebra/matrix.h"
+#include "math/algebra/matrix_operations.h"
+
+namespace la
+{
+
+    namespace EIGEN_SYM
+    {
+        enum Flags : int {
+            COMPUTE_V = 1 << 0,
+            // use the lower triangle of A instead of the upper one
+            LOWER     = 1 << 1,
+        };
+    }
+
+    // Eigenvalues and optionally eigenvectors of a real symmetric or complex hermitian matrix A (?syevd / ?heevd)
+    // only the upper (or lower with LOWER flag) triangle of A is referenced
+    // E is n x 1 and contains the real eigenvalues in ascending order
+    // pV, when not null, is n x n and contains the orthonormal eigenvectors in the same order
+    template <typename T>
+    Matrix<RealTypeOf<T>>& MatEigenSym(Matrix<RealTypeOf<T>>& E, Matrix<T>* pV, const Matrix<T>& A,
+                                       const int& flags = 0);
+
+    template <typename T>
+    Matrix<RealTypeOf<T>>& MatEigenSym(Matrix<RealTypeOf<T>>& E, const Matrix<T>& A, const int& flags = 0)
+    {
+        return MatEigenSym<T>(E, nullptr, A, flags);
+    }
+
+    // Eigenvalues with index in [il, iu] (0 based, ascending order) and optionally eigenvectors (?syevr / ?heevr)
+    // E is resized to (iu - il + 1) x 1 and pV to n x (iu - il + 1)
+    template <typename T>
+    Matrix<RealTypeOf<T>>& MatEigenSymIndex(Matrix<RealTypeOf<T>>& E, Matrix<T>* pV, const Matrix<T>& A,
+                                            const size_t& il, const size_t& iu, const int& flags = 0);
+
+    // Eigenvalues in the half open interval (vl, vu] and optionally eigenvectors (?syevr / ?heevr)
+    // E and pV are resized to the number of eigenvalues found
+    template <typename T>
+    Matrix<RealTypeOf<T>>& MatEigenSymValue(Matrix<RealTypeOf<T>>& E, Matrix<T>* pV, const Matrix<T>& A,
+                                            const RealTypeOf<T>& vl, const RealTypeOf<T>& vu, const int& flags = 0);
+
+    // k largest eigenvalues and optionally eigenvectors, still in ascending order
+    template <typename T>
+    Matrix<RealTypeOf<T>>& MatEigenSymLargest(Matrix<RealTypeOf<T>>& E, Matrix<T>* pV, const Matrix<T>& A,
+                                              const size_t& k, const int& flags = 0)
+    {
+        assert(k > 0 && k <= A.GetRowsNb());
+        return MatEigenSymIndex<T>(E, pV, A, A.GetRowsNb() - k, A.GetRowsNb() - 1, flags);
+    }
+
+    template <typename T> class MatrixEigenSym
+    {
+
+        REALTYPE_DEFINE
+      public:
+        inline MatrixEigenSym(const Matrix<T>& A) : A_(A), E_(A.GetRowsNb(), 1), V_(0, 0), C_(0, 0), flags_(0) {}
+
+        inline const Matrix<T>& A() const { return A_; }
+
+        // real eigenvalues in ascending order
+        inline const Matrix<RealType>& E() const { return E_; }
+
+        // eigenvectors, one column for each eigenvalue of E
+        inline const Matrix<T>& V() const { return V_; }
+
+        inline int GetFlags() const { return flags_; }
+
+        // full spectrum
+        inline const Matrix<RealType>& Compute(const int& flags = 0)
+        {
+            flags_ = flags;
+            C_     = Matrix<T>(0, 0);
+            E_.Resize(A_.GetRowsNb(), 1);
+            if (flags_ & EIGEN_SYM::COMPUTE_V) V_.Resize(A_.GetRowsNb(), A_.GetColsNb());
+            MatEigenSym<T>(E_, (flags_ & EIGEN_SYM::COMPUTE_V) ? &V_ : nullptr, A_, flags_);
+            return E_;
+        }
+
+        // eigenvalues with index in [il, iu]
+        inline const Matrix<RealType>& ComputeIndex(const size_t& il, const size_t& iu, const int& flags = 0)
+        {
+            flags_ = flags;
+            C_     = Matrix<T>(0, 0);
+            MatEigenSymIndex<T>(E_, (flags_ & EIGEN_SYM::COMPUTE_V) ? &V_ : nullptr, A_, il, iu, flags_);
+            return E_;
+        }
+
+        // eigenvalues in (vl, vu]
+        inline const Matrix<RealType>& ComputeValue(const RealType& vl, const RealType& vu, const int& flags = 0)
+        {
+            flags_ = flags;
+            C_     = Matrix<T>(0, 0);
+            MatEigenSymValue<T>(E_, (flags_ & EIGEN_SYM::COMPUTE_V) ? &V_ : nullptr, A_, vl, vu, flags_);
+            return E_;
+        }
+
+        // k largest eigenvalues
+        inline const Matrix<RealType>& ComputeLargest(const size_t& k, const int& flags = 0)
+        {
+            flags_ = flags;
+            C_     = Matrix<T>(0, 0);
+            MatEigenSymLargest<T>(E_, (flags_ & EIGEN_SYM::COMPUTE_V) ? &V_ : nullptr, A_, k, flags_);
+            return E_;
+        }
+
+        // V * diag(E) * V' reconstructed from the computed eigenpairs, equal to A for the full spectrum
+        inline const Matrix<T>& C()
+        {
+            if (C_.size() == 0)
+            {
+                assert(V_.GetColsNb() == E_.GetRowsNb());
+                Matrix<T> VE_{V_};
+                for (size_t j = 0; j < VE_.GetColsNb(); ++j)
+                    for (size_t i = 0; i < VE_.GetRowsNb(); ++i) VE_(i, j) *= E_(j, 0);
+                C_ = Matrix<T>(A_.GetRowsNb(), A_.GetColsNb());
+                MatMult(C_, VE_, V_, MULT::B_HT);
+            }
+            return C_;
+        }
+
+      private:
+        const Matrix<T>& A_;
+        Matrix<RealType> E_;
+        Matrix<T> V_;
+        Matrix<T> C_;
+        int flags_;
+    };
+
+} // namespace la
+
+#endif
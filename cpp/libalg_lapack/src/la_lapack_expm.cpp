@@ -0,0 +1,249 @@
+/************************/
+/*  la_lapack_expm.cpp  */
+/*    Version 1.0       */
+/*     2026/10/19       */
+/************************/
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <complex>
+#include <limits>
+#include <stdexcept>
+#include <type_traits>
+#include <vector>
+#include "la_blas_mult.h"
+#include "la_lapack_expm.h"
+#include "la_lapack_lu.h"
+#include "la_lapack_macro.h"
+#include "la_lapack_norm.h"
+
+#define T_C(x)      static_cast<T>(x)
+#define SIZE_T_C(x) static_cast<size_t>(x)
+
+namespace la
+{
+    namespace
+    {
+        // coefficients of the numerator of the [m/m] Pade approximant of exp(x)
+        constexpr double ExpPade3[]  = {120., 60., 12., 1.};
+        constexpr double ExpPade5[]  = {30240., 15120., 3360., 420., 30., 1.};
+        constexpr double ExpPade7[]  = {17297280., 8648640., 1995840., 277200., 25200., 1512., 56., 1.};
+        constexpr double ExpPade9[]  = {17643225600., 8821612800., 2075673600., 302702400., 30270240.,
+                                        2162160.,     110880.,     3960.,       90.,        1.};
+        constexpr double ExpPade13[] = {64764752532480000., 32382376266240000., 7771770303897600.,
+                                        1187353796428800.,  129060195264000.,   10559470521600.,
+                                        670442572800.,      33522128640.,       1323241920.,
+                                        40840800.,          960960.,            16380.,
+                                        182.,               1.};
+
+        // largest 1-norm for which the degree m approximant is accurate to the unit roundoff
+        constexpr double ExpThetaD[] = {1.495585217958292e-2, 2.539398330063230e-1, 9.504178996162932e-1,
+                                        2.097847961257068e0, 5.371920351148152e0};
+        constexpr double ExpThetaS[] = {4.258730016922831e-1, 1.880152677804762e0, 3.925724783138660e0};
+
+        // Taylor degree m and bound theta_m of the truncated series in double precision (Al-Mohy and Higham 2011)
+        constexpr size_t ExpTaylorM[]     = {1,  2,  3,  4,  5,  6,  7,  8,  9,  10, 11, 12, 13, 14, 15, 16, 17, 18,
+                                             19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 35, 40, 45, 50, 55};
+        constexpr double ExpTaylorTheta[] = {2.29e-16, 2.58e-8, 1.39e-5, 3.40e-4, 2.40e-3, 9.07e-3, 2.38e-2,
+                                             5.00e-2,  8.96e-2, 1.44e-1, 2.14e-1, 3.00e-1, 4.00e-1, 5.14e-1,
+                                             6.41e-1,  7.81e-1, 9.31e-1, 1.09,    1.26,    1.44,    1.62,
+                                             1.82,     2.01,    2.22,    2.43,    2.64,    2.86,    3.08,
+                                             3.31,     3.54,    4.7,     6.0,     7.2,     8.5,     9.9};
+
+        // R = c0 * I + sum_i c[i] * P[i]
+        template <typename T>
+        void ExpComb(Matrix<T>& R, const std::vector<const Matrix<T>*>& P, const std::vector<double>& c,
+                     const double& c0)
+        {
+            R.Zeros();
+            for (size_t i = 0; i < P.size(); ++i) MatAxpy(R, T_C(c[i]), *P[i]);
+            for (size_t i = 0; i < R.GetRowsNb(); ++i) R(i, i) += T_C(c0);
+        }
+
+        // E = (V - U)^-1 * (V + U), V is overwritten
+        template <typename T> void ExpPadeSolve(Matrix<T>& E, const Matrix<T>& U, Matrix<T>& V)
+        {
+            std::vector<T>& e       = E.data();
+            std::vector<T>& v       = V.data();
+            const std::vector<T>& u = U.data();
+            for (size_t i = 0; i < v.size(); ++i)
+            {
+                e[i] = v[i] + u[i];
+                v[i] = v[i] - u[i];
+            }
+            Matrix<T> LU{0, 0};
+            std::vector<int> ipiv;
+            MatLUFactor(LU, ipiv, std::move(V));
+            MatLUSolve(E, LU, ipiv, E);
+        }
+
+        // maximum absolute row sum of a n x k block
+        template <typename T> RealTypeOf<T> ExpNormInf(const Matrix<T>& Z)
+        {
+            std::vector<RealTypeOf<T>> rows(Z.GetRowsNb(), RealTypeOf<T>(0));
+            for (size_t j = 0; j < Z.GetColsNb(); ++j)
+                for (size_t i = 0; i < Z.GetRowsNb(); ++i) rows[i] += std::abs(Z(i, j));
+            return rows.empty() ? RealTypeOf<T>(0) : *std::max_element(rows.begin(), rows.end());
+        }
+    } // namespace
+
+    template <typename T> Matrix<T>& MatExp(Matrix<T>& E, const Matrix<T>& A)
+    {
+        REALTYPE_DEFINE
+        assert(A.GetRowsNb() == A.GetColsNb());
+        assert(E.GetRowsNb() == A.GetRowsNb() && E.GetColsNb() == A.GetColsNb());
+        const size_t n = A.GetRowsNb();
+        if (n == 0) return E;
+        const RealType nrm = MatNorm(A, NORM::ONE);
+        if (!std::isfinite(nrm)) throw std::runtime_error("MatExp: non finite matrix");
+        constexpr bool bSingle = std::is_same_v<RealType, float>;
+        Matrix<T> U{n, n}, V{n, n}, W{n, n}, A2{n, n};
+        // low degrees without scaling
+        const double* theta = bSingle ? ExpThetaS : ExpThetaD;
+        const double* pade[] = {ExpPade3, ExpPade5, ExpPade7, ExpPade9};
+        const size_t nLow    = bSingle ? 2 : 4;
+        for (size_t d = 0; d < nLow; ++d)
+        {
+            if (nrm > theta[d]) continue;
+            const double* b = pade[d];
+            MatMult(A2, A, A, 0);
+            // A^2, A^4, A^6 and A^8 as needed
+            std::vector<Matrix<T>> pw;
+            pw.reserve(d);
+            std::vector<const Matrix<T>*> P{&A2};
+            for (size_t k = 1; k < d + 1; ++k)
+            {
+                pw.emplace_back(n, n);
+                MatMult(pw.back(), *P.back(), A2, 0);
+                P.push_back(&pw.back());
+            }
+            std::vector<double> cu, cv;
+            for (size_t k = 0; k < P.size(); ++k)
+            {
+                cu.push_back(b[2 * k + 3]);
+                cv.push_back(b[2 * k + 2]);
+            }
+            ExpComb(W, P, cu, b[1]);
+            MatMult(U, A, W, 0);
+            ExpComb(V, P, cv, b[0]);
+            ExpPadeSolve(E, U, V);
+            return E;
+        }
+        // scaling so that the norm of A / 2^s is below the bound of the highest degree
+        const double thMax = bSingle ? ExpThetaS[2] : ExpThetaD[4];
+        const int s        = std::max(0, static_cast<int>(std::ceil(std::log2(nrm / thMax))));
+        Matrix<T> As{A};
+        MatScal(As, T_C(std::ldexp(RealType(1), -s)));
+        MatMult(A2, As, As, 0);
+        Matrix<T> A4{n, n}, A6{n, n};
+        MatMult(A4, A2, A2, 0);
+        MatMult(A6, A4, A2, 0);
+        if constexpr (bSingle)
+        {
+            const double* b = ExpPade7;
+            ExpComb(W, {&A2, &A4, &A6}, {b[3], b[5], b[7]}, b[1]);
+            MatMult(U, As, W, 0);
+            ExpComb(V, {&A2, &A4, &A6}, {b[2], b[4], b[6]}, b[0]);
+        }
+        else
+        {
+            const double* b = ExpPade13;
+            // U = A * (A6 * (b13 A6 + b11 A4 + b9 A2) + b7 A6 + b5 A4 + b3 A2 + b1 I)
+            ExpComb(W, {&A2, &A4, &A6}, {b[9], b[11], b[13]}, 0.);
+            ExpComb(V, {&A2, &A4, &A6}, {b[3], b[5], b[7]}, b[1]);
+            Gemm('N', 'N', n, n, n, T_C(1), A6.data().data(), n, W.data().data(), n, T_C(1), V.data().data(), n);
+            MatMult(U, As, V, 0);
+            // V = A6 * (b12 A6 + b10 A4 + b8 A2) + b6 A6 + b4 A4 + b2 A2 + b0 I
+            ExpComb(W, {&A2, &A4, &A6}, {b[8], b[10], b[12]}, 0.);
+            ExpComb(V, {&A2, &A4, &A6}, {b[2], b[4], b[6]}, b[0]);
+            Gemm('N', 'N', n, n, n, T_C(1), A6.data().data(), n, W.data().data(), n, T_C(1), V.data().data(), n);
+        }
+        ExpPadeSolve(E, U, V);
+        // undo the scaling by repeated squaring
+        for (int i = 0; i < s; ++i)
+        {
+            MatMult(W, E, E, 0);
+            E.data().swap(W.data());
+        }
+        return E;
+    }
+
+    template <typename T> Matrix<T>& MatExpMultiply(Matrix<T>& Y, const Matrix<T>& A, const Matrix<T>& B, const T& t)
+    {
+        REALTYPE_DEFINE
+        assert(A.GetRowsNb() == A.GetColsNb());
+        assert(B.GetRowsNb() == A.GetRowsNb());
+        assert(Y.GetRowsNb() == B.GetRowsNb() && Y.GetColsNb() == B.GetColsNb());
+        const size_t n = A.GetRowsNb(), k = B.GetColsNb();
+        if (&Y != &B) Y.data() = B.data();
+        if (n == 0 || k == 0) return Y;
+        // exp(t * A) = exp(t * mu) * exp(t * (A - mu * I)) with mu the mean of the eigenvalues
+        T mu = 0;
+        for (size_t i = 0; i < n; ++i) mu += A(i, i);
+        mu /= T_C(static_cast<RealType>(n));
+        Matrix<T> As{A};
+        for (size_t i = 0; i < n; ++i) As(i, i) -= mu;
+        const RealType nrm = std::abs(t) * MatNorm(As, NORM::ONE);
+        if (!std::isfinite(nrm)) throw std::runtime_error("MatExpMultiply: non finite matrix");
+        // degree m and steps s minimizing the number m * s of products, the 1-norm bounds the series terms
+        size_t m = 0, s = 1;
+        if (nrm > RealType(0))
+        {
+            size_t cost = std::numeric_limits<size_t>::max();
+            for (size_t i = 0; i < sizeof(ExpTaylorM) / sizeof(ExpTaylorM[0]); ++i)
+            {
+                const size_t si = std::max(SIZE_T_C(1), SIZE_T_C(std::ceil(nrm / ExpTaylorTheta[i])));
+                if (ExpTaylorM[i] * si < cost)
+                {
+                    cost = ExpTaylorM[i] * si;
+                    m    = ExpTaylorM[i];
+                    s    = si;
+                }
+            }
+        }
+        const RealType tol = std::numeric_limits<RealType>::epsilon() / 2;
+        const T eta        = std::exp(t * mu / T_C(static_cast<RealType>(s)));
+        Matrix<T> Z{Y}, W{n, k};
+        for (size_t i = 0; i < s; ++i)
+        {
+            RealType c1 = ExpNormInf(Z);
+            for (size_t j = 1; j <= m; ++j)
+            {
+                // next term of the series t^j / (s^j * j!) * As^j * Z
+                const T a = t / T_C(static_cast<RealType>(s * j));
+                Gemm('N', 'N', n, k, n, a, As.data().data(), n, Z.data().data(), n, T_C(0), W.data().data(), n);
+                Z.data().swap(W.data());
+                const RealType c2 = ExpNormInf(Z);
+                MatAxpy(Y, T_C(1), Z);
+                // two consecutive terms below the roundoff
+                if (c1 + c2 <= tol * ExpNormInf(Y)) break;
+                c1 = c2;
+            }
+            MatScal(Y, eta);
+            Z.data() = Y.data();
+        }
+        return Y;
+    }
+
+} // namespace la
+
+#undef SIZE_T_C
+#undef T_C
+
+// Explicit template instantiation
+#define INSTANTIATE_EXPM_TEMPLATE(type)                                                                                \
+    template la::Matrix<type>& la::MatExp<type>(la::Matrix<type>& E, const la::Matrix<type>& A);                       \
+    template la::Matrix<type>& la::MatExpMultiply<type>(la::Matrix<type>& Y, const la::Matrix<type>& A,                \
+                                                        const la::Matrix<type>& B, const type& t);
+
+#define INSTANTIATE_ALL_EXPM_TEMPLATES                                                                                 \
+    INSTANTIATE_EXPM_TEMPLATE(float)                                                                                   \
+    INSTANTIATE_EXPM_TEMPLATE(double)                                                                                  \
+    INSTANTIATE_EXPM_TEMPLATE(std::complex<float>)                                                                     \
+    INSTANTIATE_EXPM_TEMPLATE(std::complex<double>)
+
+INSTANTIATE_ALL_EXPM_TEMPLATES
+
+#undef INSTANTIATE_EXPM_TEMPLATE
+#undef INSTANTIATE_ALL_EXPM_TEMPLATES
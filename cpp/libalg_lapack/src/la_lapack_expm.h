@@ -0,0 +1,40 @@
+#ifndef _LA_LAPACK_EXPM_H_320A265DF64D438A995C7EF9CC01E8B9_
+#define _LA_LAPACK_EXPM_H_320A265DF64D438A995C7EF9CC01E8B9_
+
+/************************/
+/*   la_lapack_expm.h   */
+/*    Version 1.0       */
+/*     2026/10/19       */
+/************************/
+
+#ifndef USE_LAPACK
+#error "USE_LAPACK is not defined"
+#endif
+
+#include "la_blas_mult.h"
+#include "la_lapack_macro.h"
+#include "math/algebra/matrix.h"
+#include "math/algebra/matrix_operations.h"
+
+namespace la
+{
+    // Matrix exponential E = exp(A) of the square matrix A by scaling and squaring with a diagonal Pade approximant
+    // (Higham 2005), degree 3 to 13 (3 to 7 in single precision) selected from the 1-norm of A.
+    // Each evaluation costs a few MatMult, one LU solve and one MatMult per squaring.
+    template <typename T> Matrix<T>& MatExp(Matrix<T>& E, const Matrix<T>& A);
+
+    // Y = exp(t * A) * B for the n x k block B without forming exp(t * A), truncated Taylor series of the shifted
+    // matrix with s steps (Al-Mohy and Higham 2011), each step only needs products of A with a n x k block.
+    // The degree and the number of steps are bounded from the 1-norm of A, Y and B are n x k and can be the same.
+    template <typename T>
+    Matrix<T>& MatExpMultiply(Matrix<T>& Y, const Matrix<T>& A, const Matrix<T>& B, const T& t = T(1));
+
+    template <typename T> inline Matrix<T> MatExp(const Matrix<T>& A)
+    {
+        Matrix<T> E_{A.GetRowsNb(), A.GetColsNb()};
+        return MatExp(E_, A);
+    }
+
+} // namespace la
+
+#endif
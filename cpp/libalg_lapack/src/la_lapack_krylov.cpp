@@ -0,0 +1,445 @@
+/************************/
+/* la_lapack_krylov.cpp */
+/*    Version 1.0       */
+/*     2026/10/19       */
+/************************/
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <complex>
+#include <limits>
+#include <memory>
+#include <numeric>
+#include <random>
+#include <type_traits>
+#include <typeinfo>
+#include "la_blas_mult.h"
+#include "la_lapack_eigen.h"
+#include "la_lapack_eigen_sym.h"
+#include "la_lapack_krylov.h"
+#include "la_lapack_lu.h"
+#include "la_lapack_macro.h"
+#include "la_lapack_qr.h"
+#include "la_thread_pool.h"
+
+#define SIZE_T_C(x) static_cast<size_t>(x)
+
+namespace la
+{
+    namespace
+    {
+        // number of row blocks for the vector operations, small problems are not split
+        inline size_t KrylovBlocksNb(const size_t n)
+        {
+            return std::max(SIZE_T_C(1), std::min(ParallelBlocksNb(), n / 4096));
+        }
+
+        // h = V(:, 0:k)^H * w, each row block computes a partial product, reduced afterwards
+        template <typename T>
+        void KrylovProject(std::vector<T>& h, const Matrix<T>& V, const size_t k, const T* w, std::vector<T>& partial)
+        {
+            const size_t n = V.GetRowsNb(), nBlocks = KrylovBlocksNb(n);
+            partial.assign(nBlocks * k, T(0));
+            ParallelFor(
+                0, n,
+                [&](const size_t first, const size_t last, const size_t b) {
+                    Gemm('C', 'N', k, 1, last - first, T(1), V.data().data() + first, n, w + first, n, T(0),
+                         partial.data() + b * k, k);
+                },
+                nBlocks);
+            h.assign(k, T(0));
+            for (size_t b = 0; b < nBlocks; ++b)
+                for (size_t i = 0; i < k; ++i) h[i] += partial[b * k + i];
+        }
+
+        // w = w - V(:, 0:k) * h
+        template <typename T> void KrylovSubtract(T* w, const Matrix<T>& V, const size_t k, const std::vector<T>& h)
+        {
+            const size_t n = V.GetRowsNb();
+            ParallelFor(
+                0, n,
+                [&](const size_t first, const size_t last, const size_t) {
+                    Gemm('N', 'N', last - first, 1, k, T(-1), V.data().data() + first, n, h.data(), k, T(1),
+                         w + first, n);
+                },
+                KrylovBlocksNb(n));
+        }
+
+        template <typename T> RealTypeOf<T> KrylovNorm(const T* w, const size_t n)
+        {
+            const size_t nBlocks = KrylovBlocksNb(n);
+            std::vector<RealTypeOf<T>> partial(nBlocks, 0);
+            ParallelFor(
+                0, n,
+                [&](const size_t first, const size_t last, const size_t b) {
+                    RealTypeOf<T> s_ = 0;
+                    for (size_t i = first; i < last; ++i) s_ += std::norm(w[i]);
+                    partial[b] = s_;
+                },
+                nBlocks);
+            return std::sqrt(std::accumulate(partial.begin(), partial.end(), RealTypeOf<T>(0)));
+        }
+
+        // orthogonalize w against V(:, 0:k) with two passes of classical Gram-Schmidt, h receives the coefficients
+        template <typename T>
+        void KrylovOrthogonalize(T* w, std::vector<T>& h, const Matrix<T>& V, const size_t k, std::vector<T>& partial)
+        {
+            std::vector<T> h2_;
+            KrylovProject(h, V, k, w, partial);
+            KrylovSubtract(w, V, k, h);
+            KrylovProject(h2_, V, k, w, partial);
+            KrylovSubtract(w, V, k, h2_);
+            for (size_t i = 0; i < k; ++i) h[i] += h2_[i];
+        }
+
+        template <typename T> inline T KrylovConj(const T& z)
+        {
+            if constexpr (std::is_same_v<T, float> || std::is_same_v<T, double>) return z;
+            else return std::conj(z);
+        }
+
+        template <typename T> void KrylovRandom(T* w, const size_t n, std::mt19937& gen)
+        {
+            std::normal_distribution<RealTypeOf<T>> dist(0, 1);
+            for (size_t i = 0; i < n; ++i)
+            {
+                if constexpr (std::is_same_v<T, float> || std::is_same_v<T, double>) w[i] = dist(gen);
+                else
+                {
+                    const RealTypeOf<T> re = dist(gen);
+                    w[i]                   = T(re, dist(gen));
+                }
+            }
+        }
+
+        // set column j of V to w / ||w||, w is replaced by a random direction orthogonal to V(:, 0:j) when it
+        // vanishes (invariant subspace found), returns the norm of w
+        template <typename T>
+        RealTypeOf<T> KrylovNextVector(Matrix<T>& V, const size_t j, Matrix<T>& w, std::vector<T>& partial,
+                                       std::mt19937& gen, const RealTypeOf<T>& small)
+        {
+            const size_t n         = V.GetRowsNb();
+            RealTypeOf<T> beta     = KrylovNorm(w.data().data(), n);
+            const RealTypeOf<T> b_ = beta;
+            if (beta <= small)
+            {
+                std::vector<T> h_;
+                KrylovRandom(w.data().data(), n, gen);
+                KrylovOrthogonalize(w.data().data(), h_, V, j, partial);
+                beta = KrylovNorm(w.data().data(), n);
+            }
+            for (size_t i = 0; i < n; ++i) V(i, j) = w(i, 0) / beta;
+            return (b_ <= small) ? RealTypeOf<T>(0) : b_;
+        }
+
+        // Ritz values and vectors of the projected matrix H
+        template <typename T>
+        void KrylovRitz(std::vector<std::complex<RealTypeOf<T>>>& ritz, Matrix<std::complex<RealTypeOf<T>>>& Y,
+                        const Matrix<T>& H, const bool bSym)
+        {
+            using C        = std::complex<RealTypeOf<T>>;
+            const size_t m = H.GetRowsNb();
+            if (bSym)
+            {
+                Matrix<T> Hs{m, m}, Z{m, m};
+                Matrix<RealTypeOf<T>> E{m, 1};
+                for (size_t j = 0; j < m; ++j)
+                    for (size_t i = 0; i < m; ++i) Hs(i, j) = (H(i, j) + KrylovConj(H(j, i))) / T(2);
+                MatEigenSym<T>(E, &Z, Hs);
+                for (size_t i = 0; i < m; ++i) ritz[i] = C(E(i, 0));
+                for (size_t j = 0; j < m; ++j)
+                    for (size_t i = 0; i < m; ++i) Y(i, j) = C(Z(i, j));
+            }
+            else
+            {
+                Matrix<C> Hc{m, m}, E{m, 1};
+                for (size_t j = 0; j < m; ++j)
+                    for (size_t i = 0; i < m; ++i) Hc(i, j) = C(H(i, j));
+                MatEigen<C>(E, nullptr, &Y, Hc);
+                for (size_t i = 0; i < m; ++i) ritz[i] = E(i, 0);
+            }
+        }
+
+        // indices of the Ritz values from the most to the least wanted
+        template <typename C> void KrylovSort(std::vector<size_t>& order, const std::vector<C>& ritz, const int& which)
+        {
+            auto key_ = [&which](const C& z) {
+                switch (which)
+                {
+                case KRYLOV::LARGEST_MAGNITUDE: return std::abs(z);
+                case KRYLOV::SMALLEST_MAGNITUDE: return -std::abs(z);
+                case KRYLOV::LARGEST_REAL: return std::real(z);
+                case KRYLOV::SMALLEST_REAL: return -std::real(z);
+                case KRYLOV::LARGEST_IMAG: return std::abs(std::imag(z));
+                case KRYLOV::SMALLEST_IMAG: return -std::abs(std::imag(z));
+                default: throw std::runtime_error("MatEigenKrylov: unsupported which");
+                }
+            };
+            std::iota(order.begin(), order.end(), SIZE_T_C(0));
+            std::stable_sort(order.begin(), order.end(),
+                             [&](const size_t i, const size_t j) { return key_(ritz[i]) > key_(ritz[j]); });
+        }
+
+        // X = V * Y for a complex Y, split by rows of V
+        template <typename T>
+        void KrylovRitzVectors(Matrix<std::complex<RealTypeOf<T>>>& X, const Matrix<T>& V,
+                               const Matrix<std::complex<RealTypeOf<T>>>& Y)
+        {
+            const size_t n = V.GetRowsNb(), m = V.GetColsNb(), k = Y.GetColsNb();
+            if constexpr (std::is_same_v<T, float> || std::is_same_v<T, double>)
+            {
+                Matrix<T> Yr{m, k}, Yi{m, k}, Xr{n, k}, Xi{n, k};
+                for (size_t i = 0; i < Y.size(); ++i)
+                {
+                    Yr.data()[i] = std::real(Y.data()[i]);
+                    Yi.data()[i] = std::imag(Y.data()[i]);
+                }
+                ParallelFor(0, n, [&](const size_t first, const size_t last, const size_t) {
+                    Gemm('N', 'N', last - first, k, m, T(1), V.data().data() + first, n, Yr.data().data(), m, T(0),
+                         Xr.data().data() + first, n);
+                    Gemm('N', 'N', last - first, k, m, T(1), V.data().data() + first, n, Yi.data().data(), m, T(0),
+                         Xi.data().data() + first, n);
+                });
+                for (size_t i = 0; i < X.size(); ++i) X.data()[i] = std::complex<T>(Xr.data()[i], Xi.data()[i]);
+            }
+            else
+            {
+                ParallelFor(0, n, [&](const size_t first, const size_t last, const size_t) {
+                    Gemm('N', 'N', last - first, k, m, T(1), V.data().data() + first, n, Y.data().data(), m, T(0),
+                         X.data().data() + first, n);
+                });
+            }
+        }
+
+        // restarted Arnoldi iteration, H is hermitian when bSym is true (Lanczos).
+        // theta receives the nev wanted Ritz values and pX the corresponding Ritz vectors
+        template <typename T>
+        size_t KrylovSolve(std::vector<std::complex<RealTypeOf<T>>>& theta, Matrix<std::complex<RealTypeOf<T>>>* pX,
+                           const MatVecOp<T>& op, const size_t n, const size_t nev, const int which, size_t ncv,
+                           const size_t maxIter, RealTypeOf<T> tol, const unsigned int seed, const bool bSym)
+        {
+            REALTYPE_DEFINE
+            using C             = std::complex<RealType>;
+            constexpr bool bRe_ = std::is_same_v<T, float> || std::is_same_v<T, double>;
+            assert(nev > 0 && nev < n);
+            if (ncv == 0) ncv = std::min(n, std::max(2 * nev + 1, SIZE_T_C(20)));
+            const size_t m = ncv;
+            assert(m > nev + 1 && m <= n);
+            const RealType eps   = std::numeric_limits<RealType>::epsilon();
+            const RealType eps23 = std::pow(eps, RealType(2) / RealType(3));
+            if (tol <= 0) tol = eps23;
+
+            Matrix<T> V{n, m}, H{m, m}, x{n, 1}, w{n, 1};
+            Matrix<C> Y{m, m};
+            std::vector<T> h, partial;
+            std::vector<C> ritz(m);
+            std::vector<size_t> order(m);
+            std::mt19937 gen(seed);
+            KrylovRandom(w.data().data(), n, gen);
+            KrylovNextVector(V, 0, w, partial, gen, RealType(0));
+            size_t k = 0, nconv = 0;
+            RealType beta = 0;
+            for (size_t iter = 0;; ++iter)
+            {
+                // extend the factorization A * V(:, 0:m) = V(:, 0:m) * H + w * e_m^T from k to m columns,
+                // H is upper Hessenberg except for the row k after a restart
+                for (size_t j = k; j < m; ++j)
+                {
+                    for (size_t i = 0; i < n; ++i) x(i, 0) = V(i, j);
+                    op(w, x);
+                    KrylovOrthogonalize(w.data().data(), h, V, j + 1, partial);
+                    RealType hnorm = 0;
+                    for (size_t i = 0; i <= j; ++i)
+                    {
+                        H(i, j) = h[i];
+                        hnorm   = std::max(hnorm, std::abs(h[i]));
+                    }
+                    if (j + 1 < m) H(j + 1, j) = T(KrylovNextVector(V, j + 1, w, partial, gen, eps * hnorm));
+                    else beta = KrylovNorm(w.data().data(), n);
+                }
+                KrylovRitz<T>(ritz, Y, H, bSym);
+                KrylovSort(order, ritz, which);
+                nconv = 0;
+                for (size_t i = 0; i < nev; ++i)
+                {
+                    const RealType res = beta * std::abs(Y(m - 1, order[i]));
+                    if (res <= tol * std::max(eps23, std::abs(ritz[order[i]]))) ++nconv;
+                }
+                if (nconv >= nev || iter >= maxIter) break;
+                // restart with the Krylov-Schur form of the implicit restart (exact shifts): the factorization is
+                // truncated to an orthonormal basis of the wanted Ritz vectors, adding up to (m - nev) / 2 of the
+                // converged ones to speed up the convergence of the remaining ones
+                const size_t kWanted = nev + std::min(nconv, (m - nev) / 2);
+                Matrix<T> W{m, m};
+                k = 0;
+                for (size_t s = 0; s < kWanted && k + 1 < m; ++s)
+                {
+                    const size_t c = order[s];
+                    if constexpr (bRe_)
+                    {
+                        if (std::abs(std::imag(ritz[c])) > 100 * eps * std::abs(ritz[c]))
+                        {
+                            // a complex pair of a real H contributes the real and imaginary parts of one vector
+                            const RealType small_ = 100 * eps * std::abs(ritz[c]);
+                            if (s > 0 && std::abs(ritz[order[s - 1]] - std::conj(ritz[c])) <= small_) continue;
+                            if (k + 2 >= m) break;
+                            for (size_t i = 0; i < m; ++i)
+                            {
+                                W(i, k)     = std::real(Y(i, c));
+                                W(i, k + 1) = std::imag(Y(i, c));
+                            }
+                            k += 2;
+                            continue;
+                        }
+                        for (size_t i = 0; i < m; ++i) W(i, k) = std::real(Y(i, c));
+                    }
+                    else
+                    {
+                        for (size_t i = 0; i < m; ++i) W(i, k) = Y(i, c);
+                    }
+                    ++k;
+                }
+                W.Resize(m, k);
+                Matrix<T> Qw{m, m}, Rw{m, k}, HQ{m, k}, Hk{k, k};
+                MatQR(Qw, Rw, W);
+                // H = Qw(:, 0:k)^H * H * Qw(:, 0:k) and V(:, 0:k) = V * Qw(:, 0:k)
+                Gemm('N', 'N', m, k, m, T(1), H.data().data(), m, Qw.data().data(), m, T(0), HQ.data().data(), m);
+                Gemm('C', 'N', k, k, m, T(1), Qw.data().data(), m, HQ.data().data(), m, T(0), Hk.data().data(), k);
+                Matrix<T> VQ{n, k};
+                ParallelFor(0, n, [&](const size_t first, const size_t last, const size_t) {
+                    Gemm('N', 'N', last - first, k, m, T(1), V.data().data() + first, n, Qw.data().data(), m, T(0),
+                         VQ.data().data() + first, n);
+                });
+                std::copy(VQ.data().begin(), VQ.data().end(), V.data().begin());
+                H.Zeros();
+                RealType hnorm = 0;
+                for (size_t j = 0; j < k; ++j)
+                    for (size_t i = 0; i < k; ++i)
+                    {
+                        H(i, j) = Hk(i, j);
+                        hnorm   = std::max(hnorm, std::abs(Hk(i, j)));
+                    }
+                // A * V(:, 0:k) = V(:, 0:k) * H(0:k, 0:k) + w * Qw(m - 1, 0:k), w becomes the next basis vector
+                const T bk = T(KrylovNextVector(V, k, w, partial, gen, eps * hnorm));
+                for (size_t j = 0; j < k; ++j) H(k, j) = bk * Qw(m - 1, j);
+            }
+            theta.resize(nev);
+            Matrix<C> Ysel{m, nev};
+            for (size_t j = 0; j < nev; ++j)
+            {
+                theta[j] = ritz[order[j]];
+                for (size_t i = 0; i < m; ++i) Ysel(i, j) = Y(i, order[j]);
+            }
+            if (pX) KrylovRitzVectors(*pX, V, Ysel);
+            return nconv;
+        }
+    } // namespace
+
+    template <typename T>
+    size_t MatEigenLanczos(Matrix<RealTypeOf<T>>& E, Matrix<T>* pV, const MatVecOp<T>& op, const size_t& n,
+                           const size_t& nev, const int& which, const size_t& ncv, const size_t& maxIter,
+                           const RealTypeOf<T>& tol, const unsigned int& seed)
+    {
+        using C = std::complex<RealTypeOf<T>>;
+        std::vector<C> theta;
+        Matrix<C> X{pV ? n : 0, pV ? nev : 0};
+        const size_t nconv = KrylovSolve<T>(theta, pV ? &X : nullptr, op, n, nev, which, ncv, maxIter, tol, seed, true);
+        E.Resize(nev, 1);
+        for (size_t i = 0; i < nev; ++i) E(i, 0) = std::real(theta[i]);
+        if (pV)
+        {
+            pV->Resize(n, nev);
+            for (size_t i = 0; i < X.size(); ++i)
+            {
+                if constexpr (std::is_same_v<T, float> || std::is_same_v<T, double>)
+                    pV->data()[i] = std::real(X.data()[i]);
+                else pV->data()[i] = X.data()[i];
+            }
+        }
+        return nconv;
+    }
+
+    template <typename T>
+    size_t MatEigenArnoldi(Matrix<std::complex<RealTypeOf<T>>>& E, Matrix<std::complex<RealTypeOf<T>>>* pV,
+                           const MatVecOp<T>& op, const size_t& n, const size_t& nev, const int& which,
+                           const size_t& ncv, const size_t& maxIter, const RealTypeOf<T>& tol,
+                           const unsigned int& seed)
+    {
+        std::vector<std::complex<RealTypeOf<T>>> theta;
+        if (pV) pV->Resize(n, nev);
+        const size_t nconv = KrylovSolve<T>(theta, pV, op, n, nev, which, ncv, maxIter, tol, seed, false);
+        E.Resize(nev, 1);
+        for (size_t i = 0; i < nev; ++i) E(i, 0) = theta[i];
+        return nconv;
+    }
+
+    template <typename T> MatVecOp<T> MatShiftInvertOp(const Matrix<T>& A, const T& sigma)
+    {
+        assert(A.GetRowsNb() == A.GetColsNb());
+        auto pLU_ = std::make_shared<std::pair<Matrix<T>, std::vector<int>>>();
+        Matrix<T> As{A};
+        for (size_t i = 0; i < As.GetRowsNb(); ++i) As(i, i) -= sigma;
+        MatLUFactor(pLU_->first, pLU_->second, As);
+        return [pLU_](Matrix<T>& y, const Matrix<T>& x) { MatLUSolve(y, pLU_->first, pLU_->second, x); };
+    }
+
+    template <typename T>
+    size_t MatEigenLanczosShiftInvert(Matrix<RealTypeOf<T>>& E, Matrix<T>* pV, const Matrix<T>& A,
+                                      const RealTypeOf<T>& sigma, const size_t& nev, const size_t& ncv,
+                                      const size_t& maxIter, const RealTypeOf<T>& tol)
+    {
+        // the eigenvalues closest to sigma are the largest of (A - sigma * I)^-1
+        const size_t nconv = MatEigenLanczos<T>(E, pV, MatShiftInvertOp(A, T(sigma)), A.GetRowsNb(), nev,
+                                                KRYLOV::LARGEST_MAGNITUDE, ncv, maxIter, tol);
+        for (size_t i = 0; i < nev; ++i) E(i, 0) = sigma + 1 / E(i, 0);
+        return nconv;
+    }
+
+    template <typename T>
+    size_t MatEigenArnoldiShiftInvert(Matrix<std::complex<RealTypeOf<T>>>& E, Matrix<std::complex<RealTypeOf<T>>>* pV,
+                                      const Matrix<T>& A, const T& sigma, const size_t& nev, const size_t& ncv,
+                                      const size_t& maxIter, const RealTypeOf<T>& tol)
+    {
+        using C            = std::complex<RealTypeOf<T>>;
+        const size_t nconv = MatEigenArnoldi<T>(E, pV, MatShiftInvertOp(A, sigma), A.GetRowsNb(), nev,
+                                                KRYLOV::LARGEST_MAGNITUDE, ncv, maxIter, tol);
+        for (size_t i = 0; i < nev; ++i) E(i, 0) = C(sigma) + C(1) / E(i, 0);
+        return nconv;
+    }
+
+} // namespace la
+
+#undef SIZE_T_C
+
+// Explicit template instantiation
+#define INSTANTIATE_KRYLOV_TEMPLATE(type)                                                                              \
+    template size_t la::MatEigenLanczos<type>(la::Matrix<la::RealTypeOf<type>>&, la::Matrix<type>*,                   \
+                                              const la::MatVecOp<type>&, const size_t&, const size_t&, const int&,     \
+                                              const size_t&, const size_t&, const la::RealTypeOf<type>&,               \
+                                              const unsigned int&);                                                    \
+    template size_t la::MatEigenArnoldi<type>(la::Matrix<std::complex<la::RealTypeOf<type>>>&,                         \
+                                              la::Matrix<std::complex<la::RealTypeOf<type>>>*,                         \
+                                              const la::MatVecOp<type>&, const size_t&, const size_t&, const int&,     \
+                                              const size_t&, const size_t&, const la::RealTypeOf<type>&,               \
+                                              const unsigned int&);                                                    \
+    template la::MatVecOp<type> la::MatShiftInvertOp<type>(const la::Matrix<type>&, const type&);                      \
+    template size_t la::MatEigenLanczosShiftInvert<type>(la::Matrix<la::RealTypeOf<type>>&, la::Matrix<type>*,         \
+                                                         const la::Matrix<type>&, const la::RealTypeOf<type>&,         \
+                                                         const size_t&, const size_t&, const size_t&,                  \
+                                                         const la::RealTypeOf<type>&);                                 \
+    template size_t la::MatEigenArnoldiShiftInvert<type>(la::Matrix<std::complex<la::RealTypeOf<type>>>&,             \
+                                                         la::Matrix<std::complex<la::RealTypeOf<type>>>*,              \
+                                                         const la::Matrix<type>&, const type&, const size_t&,          \
+                                                         const size_t&, const size_t&, const la::RealTypeOf<type>&);
+
+#define INSTANTIATE_ALL_KRYLOV_TEMPLATES                                                                               \
+    INSTANTIATE_KRYLOV_TEMPLATE(float)                                                                                 \
+    INSTANTIATE_KRYLOV_TEMPLATE(double)                                                                                \
+    INSTANTIATE_KRYLOV_TEMPLATE(std::complex<float>)                                                                   \
+    INSTANTIATE_KRYLOV_TEMPLATE(std::complex<double>)
+
+INSTANTIATE_ALL_KRYLOV_TEMPLATES
+
+#undef INSTANTIATE_KRYLOV_TEMPLATE
+#undef INSTANTIATE_ALL_KRYLOV_TEMPLATES
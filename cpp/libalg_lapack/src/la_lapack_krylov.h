@@ -0,0 +1,102 @@
+#ifndef _LA_LAPACK_KRYLOV_H_1979354BA3594B739075F3CB5B080961_
+#define _LA_LAPACK_KRYLOV_H_1979354BA3594B739075F3CB5B080961_
+
+/************************/
+/*  la_lapack_krylov.h  */
+/*    Version 1.0       */
+/*     2026/10/19       */
+/************************/
+
+#ifndef USE_LAPACK
+#error "USE_LAPACK is not defined"
+#endif
+
+#include <cassert>
+#include <complex>
+#include <functional>
+#include "la_blas_mult.h"
+#include "la_lapack_macro.h"
+#include "math/algebra/matrix.h"
+#include "math/algebra/matrix_operations.h"
+
+namespace la
+{
+    namespace KRYLOV
+    {
+        // part of the spectrum to compute
+        enum Which : int {
+            LARGEST_MAGNITUDE  = 0,
+            SMALLEST_MAGNITUDE = 1,
+            // largest algebraic for the symmetric solver
+            LARGEST_REAL       = 2,
+            SMALLEST_REAL      = 3,
+            // imaginary part in magnitude, only meaningful for the general solver
+            LARGEST_IMAG       = 4,
+            SMALLEST_IMAG      = 5,
+        };
+    }
+
+    // operator applied by the Krylov solvers, y = Op(x) with x and y n x 1.
+    // It can wrap a dense product, a sparse product or any matrix-free operator.
+    template <typename T> using MatVecOp = std::function<void(Matrix<T>& y, const Matrix<T>& x)>;
+
+    // Implicitly restarted Lanczos method for a real symmetric or complex hermitian operator of size n.
+    // Computes nev eigenvalues selected by which with a Krylov basis of ncv vectors (0 selects
+    // min(n, max(2 * nev + 1, 20))), restarting at most maxIter times.
+    // A Ritz pair is converged when its residual is below tol * |theta| (tol 0 selects eps^(2/3)).
+    // E is resized to nev x 1 and pV, when not null, to n x nev, sorted from the most wanted.
+    // The basis is orthogonalized with two passes of classical Gram-Schmidt split in row blocks on la::ThreadPool().
+    // The restart keeps the wanted Ritz vectors (Krylov-Schur form of the implicit restart with exact shifts).
+    // Returns the number of converged eigenvalues, the remaining ones being the current estimates.
+    template <typename T>
+    size_t MatEigenLanczos(Matrix<RealTypeOf<T>>& E, Matrix<T>* pV, const MatVecOp<T>& op, const size_t& n,
+                           const size_t& nev, const int& which = KRYLOV::LARGEST_MAGNITUDE, const size_t& ncv = 0,
+                           const size_t& maxIter = 300, const RealTypeOf<T>& tol = 0, const unsigned int& seed = 0);
+
+    template <typename T>
+    size_t MatEigenLanczos(Matrix<RealTypeOf<T>>& E, Matrix<T>* pV, const Matrix<T>& A, const size_t& nev,
+                           const int& which = KRYLOV::LARGEST_MAGNITUDE, const size_t& ncv = 0,
+                           const size_t& maxIter = 300, const RealTypeOf<T>& tol = 0)
+    {
+        assert(A.GetRowsNb() == A.GetColsNb());
+        const MatVecOp<T> op_ = [&A](Matrix<T>& y, const Matrix<T>& x) { MatMultVec(y, A, x); };
+        return MatEigenLanczos<T>(E, pV, op_, A.GetRowsNb(), nev, which, ncv, maxIter, tol);
+    }
+
+    // Implicitly restarted Arnoldi method for a general operator of size n, same parameters as MatEigenLanczos.
+    // Real operators use double shifts so that the basis stays real, eigenvalues and eigenvectors are complex.
+    template <typename T>
+    size_t MatEigenArnoldi(Matrix<std::complex<RealTypeOf<T>>>& E, Matrix<std::complex<RealTypeOf<T>>>* pV,
+                           const MatVecOp<T>& op, const size_t& n, const size_t& nev,
+                           const int& which = KRYLOV::LARGEST_MAGNITUDE, const size_t& ncv = 0,
+                           const size_t& maxIter = 300, const RealTypeOf<T>& tol = 0, const unsigned int& seed = 0);
+
+    template <typename T>
+    size_t MatEigenArnoldi(Matrix<std::complex<RealTypeOf<T>>>& E, Matrix<std::complex<RealTypeOf<T>>>* pV,
+                           const Matrix<T>& A, const size_t& nev, const int& which = KRYLOV::LARGEST_MAGNITUDE,
+                           const size_t& ncv = 0, const size_t& maxIter = 300, const RealTypeOf<T>& tol = 0)
+    {
+        assert(A.GetRowsNb() == A.GetColsNb());
+        const MatVecOp<T> op_ = [&A](Matrix<T>& y, const Matrix<T>& x) { MatMultVec(y, A, x); };
+        return MatEigenArnoldi<T>(E, pV, op_, A.GetRowsNb(), nev, which, ncv, maxIter, tol);
+    }
+
+    // operator x -> (A - sigma * I)^-1 * x for the shift-invert mode.
+    // A - sigma * I is factorized once with MatLUFactor, every application is a MatLUSolve.
+    template <typename T> MatVecOp<T> MatShiftInvertOp(const Matrix<T>& A, const T& sigma);
+
+    // nev eigenvalues of the symmetric (hermitian) matrix A closest to sigma with the shift-invert Lanczos method
+    template <typename T>
+    size_t MatEigenLanczosShiftInvert(Matrix<RealTypeOf<T>>& E, Matrix<T>* pV, const Matrix<T>& A,
+                                      const RealTypeOf<T>& sigma, const size_t& nev, const size_t& ncv = 0,
+                                      const size_t& maxIter = 300, const RealTypeOf<T>& tol = 0);
+
+    // nev eigenvalues of the general matrix A closest to sigma with the shift-invert Arnoldi method
+    template <typename T>
+    size_t MatEigenArnoldiShiftInvert(Matrix<std::complex<RealTypeOf<T>>>& E, Matrix<std::complex<RealTypeOf<T>>>* pV,
+                                      const Matrix<T>& A, const T& sigma, const size_t& nev, const size_t& ncv = 0,
+                                      const size_t& maxIter = 300, const RealTypeOf<T>& tol = 0);
+
+} // namespace la
+
+#endif
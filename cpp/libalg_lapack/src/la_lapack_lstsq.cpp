@@ -0,0 +1,132 @@
+/************************/
+/* la_lapack_lstsq.cpp  */
+/*    Version 1.0       */
+/*     2026/10/19       */
+/************************/
+
+#include <algorithm>
+#include <cassert>
+#include <complex>
+#include <limits>
+#include <type_traits>
+#include <typeinfo>
+#include "la_blas_mult.h"
+#include "la_lapack_lstsq.h"
+#include "la_lapack_macro.h"
+#include "lapack_interface.h"
+
+#define INT_C(x)      static_cast<int>(x)
+#define SIZE_T_C(x)   static_cast<size_t>(x)
+#define FLOAT_P_R(x)  reinterpret_cast<float*>(x)
+#define DOUBLE_P_R(x) reinterpret_cast<double*>(x)
+
+namespace la
+{
+    template <typename T>
+    size_t MatLeastSquares(Matrix<T>& X, const Matrix<T>& A, const Matrix<T>& B, const int& DRIVER,
+                           const RealTypeOf<T>& rcond)
+    {
+        REALTYPE_DEFINE
+        assert(B.GetRowsNb() == A.GetRowsNb());
+        assert(X.GetRowsNb() == A.GetColsNb());
+        assert(X.GetColsNb() == B.GetColsNb());
+        int m = INT_C(A.GetRowsNb()), n = INT_C(A.GetColsNb()), nrhs = INT_C(B.GetColsNb());
+        int lda = std::max(m, 1), ldb = std::max({m, n, 1}), lwork = -1, rank = std::min(m, n), info = 0;
+        char trans   = 'N';
+        RealType rc_ = rcond < 0 ? std::numeric_limits<RealType>::epsilon() : rcond;
+        Matrix<T> Atmp{A};
+        // B is overwritten by the solution, it needs max(m, n) rows
+        Matrix<T> Btmp{SIZE_T_C(ldb), B.GetColsNb()};
+        for (size_t j = 0; j < B.GetColsNb(); ++j)
+            for (size_t i = 0; i < B.GetRowsNb(); ++i) Btmp(i, j) = B(i, j);
+        std::vector<T> work(1);
+        std::vector<RealType> s(SIZE_T_C(std::max(std::min(m, n), 1))), rwork(1);
+        std::vector<int> iwork(1), jpvt(SIZE_T_C(std::max(n, 1)), 0);
+        T* a = Atmp.data().data();
+        T* b = Btmp.data().data();
+        for (int pass = 0; pass < 2; ++pass)
+        {
+            T* w = work.data();
+            switch (DRIVER)
+            {
+            case LSTSQ::GELS:
+                if constexpr (std::is_same_v<T, float>)
+                    sgels_(&trans, &m, &n, &nrhs, a, &lda, b, &ldb, w, &lwork, &info);
+                else if constexpr (std::is_same_v<T, double>)
+                    dgels_(&trans, &m, &n, &nrhs, a, &lda, b, &ldb, w, &lwork, &info);
+                else if constexpr (std::is_same_v<T, std::complex<float>>)
+                    cgels_(&trans, &m, &n, &nrhs, FLOAT_P_R(a), &lda, FLOAT_P_R(b), &ldb, FLOAT_P_R(w), &lwork,
+                           &info);
+                else if constexpr (std::is_same_v<T, std::complex<double>>)
+                    zgels_(&trans, &m, &n, &nrhs, DOUBLE_P_R(a), &lda, DOUBLE_P_R(b), &ldb, DOUBLE_P_R(w), &lwork,
+                           &info);
+                else throw std::runtime_error("MatLeastSquares: unsupported type");
+                if (info > 0) throw std::runtime_error("MatLeastSquares: matrix is not full rank");
+                break;
+            case LSTSQ::GELSD:
+                if constexpr (std::is_same_v<T, float>)
+                    sgelsd_(&m, &n, &nrhs, a, &lda, b, &ldb, s.data(), &rc_, &rank, w, &lwork, iwork.data(), &info);
+                else if constexpr (std::is_same_v<T, double>)
+                    dgelsd_(&m, &n, &nrhs, a, &lda, b, &ldb, s.data(), &rc_, &rank, w, &lwork, iwork.data(), &info);
+                else if constexpr (std::is_same_v<T, std::complex<float>>)
+                    cgelsd_(&m, &n, &nrhs, FLOAT_P_R(a), &lda, FLOAT_P_R(b), &ldb, s.data(), &rc_, &rank,
+                            FLOAT_P_R(w), &lwork, rwork.data(), iwork.data(), &info);
+                else if constexpr (std::is_same_v<T, std::complex<double>>)
+                    zgelsd_(&m, &n, &nrhs, DOUBLE_P_R(a), &lda, DOUBLE_P_R(b), &ldb, s.data(), &rc_, &rank,
+                            DOUBLE_P_R(w), &lwork, rwork.data(), iwork.data(), &info);
+                else throw std::runtime_error("MatLeastSquares: unsupported type");
+                if (info > 0) throw std::runtime_error("MatLeastSquares: SVD failed to converge");
+                break;
+            case LSTSQ::GELSY:
+                if constexpr (std::is_same_v<T, float>)
+                    sgelsy_(&m, &n, &nrhs, a, &lda, b, &ldb, jpvt.data(), &rc_, &rank, w, &lwork, &info);
+                else if constexpr (std::is_same_v<T, double>)
+                    dgelsy_(&m, &n, &nrhs, a, &lda, b, &ldb, jpvt.data(), &rc_, &rank, w, &lwork, &info);
+                else if constexpr (std::is_same_v<T, std::complex<float>>)
+                    cgelsy_(&m, &n, &nrhs, FLOAT_P_R(a), &lda, FLOAT_P_R(b), &ldb, jpvt.data(), &rc_, &rank,
+                            FLOAT_P_R(w), &lwork, rwork.data(), &info);
+                else if constexpr (std::is_same_v<T, std::complex<double>>)
+                    zgelsy_(&m, &n, &nrhs, DOUBLE_P_R(a), &lda, DOUBLE_P_R(b), &ldb, jpvt.data(), &rc_, &rank,
+                            DOUBLE_P_R(w), &lwork, rwork.data(), &info);
+                else throw std::runtime_error("MatLeastSquares: unsupported type");
+                break;
+            default: throw std::runtime_error("MatLeastSquares: unsupported driver");
+            }
+            if (info < 0) throw std::runtime_error("MatLeastSquares: illegal value");
+            if (pass == 0)
+            {
+                lwork = std::max(INT_C(std::real(work[0])), 1);
+                work.resize(SIZE_T_C(lwork));
+                // gelsd also returns the integer and real workspace sizes, complex gelsy needs 2 * n reals
+                iwork.resize(SIZE_T_C(std::max(iwork[0], 1)));
+                if (DRIVER == LSTSQ::GELSD) rwork.resize(SIZE_T_C(std::max(INT_C(rwork[0]), 1)));
+                else rwork.resize(SIZE_T_C(2 * std::max(n, 1)));
+            }
+        }
+        for (size_t j = 0; j < X.GetColsNb(); ++j)
+            for (size_t i = 0; i < X.GetRowsNb(); ++i) X(i, j) = Btmp(i, j);
+        return SIZE_T_C(rank);
+    }
+
+} // namespace la
+
+#undef DOUBLE_P_R
+#undef FLOAT_P_R
+#undef INT_C
+#undef SIZE_T_C
+
+// Explicit template instantiation
+#define INSTANTIATE_LSTSQ_TEMPLATE(type)                                                                               \
+    template size_t la::MatLeastSquares(la::Matrix<type>& X, const la::Matrix<type>& A, const la::Matrix<type>& B,     \
+                                        const int& DRIVER, const la::RealTypeOf<type>& rcond);
+
+#define INSTANTIATE_ALL_LSTSQ_TEMPLATES                                                                                \
+    INSTANTIATE_LSTSQ_TEMPLATE(float)                                                                                  \
+    INSTANTIATE_LSTSQ_TEMPLATE(double)                                                                                 \
+    INSTANTIATE_LSTSQ_TEMPLATE(std::complex<float>)                                                                    \
+    INSTANTIATE_LSTSQ_TEMPLATE(std::complex<double>)
+
+INSTANTIATE_ALL_LSTSQ_TEMPLATES
+
+#undef INSTANTIATE_LSTSQ_TEMPLATE
+#undef INSTANTIATE_ALL_LSTSQ_TEMPLATES
@@ -0,0 +1,70 @@
+#ifndef _LA_LAPACK_LSTSQ_H_D3EC9D23EAFA4FED872F9C80373A00A4_
+#define _LA_LAPACK_LSTSQ_H_D3EC9D23EAFA4FED872F9C80373A00A4_
+
+/************************/
+/*  la_lapack_lstsq.h   */
+/*    Version 1.0       */
+/*     2026/10/19       */
+/************************/
+
+#ifndef USE_LAPACK
+#error "USE_LAPACK is not defined"
+#endif
+
+#include "la_blas_mult.h"
+#include "la_lapack_macro.h"
+#include "la_lapack_qr.h"
+#include "la_lapack_qr_update.h"
+#include "math/algebra/matrix.h"
+#include "math/algebra/matrix_operations.h"
+
+namespace la
+{
+    namespace LSTSQ
+    {
+        enum Flags : int {
+            // QR or LQ factorization, A must have full rank
+            GELS  = 1,
+            // divide and conquer SVD
+            GELSD = 2,
+            // complete orthogonal factorization with column pivoting
+            GELSY = 3,
+        };
+    }
+
+    // Least squares solution of min ||A * X - B|| (m >= n) or minimum norm solution of A * X = B (m < n)
+    // A is m x n, B is m x nrhs and X is n x nrhs, every column of B is solved with the same factorization.
+    // With GELSD and GELSY the singular values (resp. the diagonal of R) below rcond times the largest one are treated
+    // as zero (rcond < 0 selects the machine precision), giving the minimum norm solution for a rank deficient A.
+    // Returns the effective rank of A (min(m, n) with GELS).
+    template <typename T>
+    size_t MatLeastSquares(Matrix<T>& X, const Matrix<T>& A, const Matrix<T>& B, const int& DRIVER = LSTSQ::GELSD,
+                           const RealTypeOf<T>& rcond = -1);
+
+    template <typename T>
+    Matrix<T> MatLeastSquares(const Matrix<T>& A, const Matrix<T>& B, const int& DRIVER = LSTSQ::GELSD,
+                              const RealTypeOf<T>& rcond = -1)
+    {
+        Matrix<T> X{A.GetColsNb(), B.GetColsNb()};
+        MatLeastSquares(X, A, B, DRIVER, rcond);
+        return X;
+    }
+
+    // Least squares solution reusing the packed QR factorization cached by qr, computed on the first call.
+    // Repeated solves with the same design matrix only cost the application of Q^H and the triangular solve.
+    template <typename T> size_t MatLeastSquares(Matrix<T>& X, MatrixQR<T>& qr, const Matrix<T>& B)
+    {
+        qr.Solve(X, B);
+        return qr.A().GetColsNb();
+    }
+
+    // Least squares solution from the factors maintained by qr, after rows or columns have been added or removed
+    template <typename T> size_t MatLeastSquares(Matrix<T>& X, const MatrixQRUpdate<T>& qr, const Matrix<T>& B)
+    {
+        qr.Solve(X, B);
+        return qr.GetColsNb();
+    }
+
+} // namespace la
+
+#endif
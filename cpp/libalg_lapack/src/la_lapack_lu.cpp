@@ -4,10 +4,12 @@
 /*     2023/06/13       */
 /************************/
 
+#include <algorithm>
 #include <cassert>
 #include <complex>
 #include <type_traits>
 #include <typeinfo>
+#include <utility>
 #include "la_blas_mult.h"
 #include "la_lapack_lu.h"
 #include "lapack_interface.h"
@@ -21,13 +23,14 @@
 namespace la
 {
     template <typename T>
-    Matrix<T>& MatLU(Matrix<T>& L, Matrix<T>& U, Matrix<T>& P, const Matrix<T>& A, const int& flags)
+    Matrix<T>& MatLU(Matrix<T>& L, Matrix<T>& U, Matrix<T>& P, Matrix<T>&& A, const int& flags)
     {
         assert(P.GetColsNb() == L.GetRowsNb());
         assert(P.GetColsNb() == P.GetRowsNb());
         assert(L.GetColsNb() == U.GetRowsNb());
         (void)flags;
-        Matrix<T> Atmp = A;
+        // factorize the caller's buffer in place
+        Matrix<T>& Atmp = A;
         int m = INT_C(A.GetRowsNb()), n = INT_C(A.GetColsNb()), lda = m, ipv = std::min(m, n), info = 0;
         std::vector<int> ipiv(SIZE_T_C(ipv));
         if constexpr (std::is_same_v<T, float>) sgetrf_(&m, &n, Atmp.data().data(), &lda, ipiv.data(), &info);
@@ -39,12 +42,24 @@ namespace la
         else throw std::runtime_error("MatLU: unsupported type");
         if (info < 0) throw std::runtime_error("MatLU: illegal value");
         else if (info > 0) throw std::runtime_error("MatLU: singular matrix");
+        return MatLUExpand(L, U, P, Atmp, ipiv);
+    }
+
+    template <typename T>
+    Matrix<T>& MatLU(Matrix<T>& L, Matrix<T>& U, Matrix<T>& P, const Matrix<T>& A, const int& flags)
+    {
+        return MatLU(L, U, P, Matrix<T>(A), flags);
+    }
+
+    template <typename T>
+    Matrix<T>& MatLUExpand(Matrix<T>& L, Matrix<T>& U, Matrix<T>& P, const Matrix<T>& LU, const std::vector<int>& ipiv)
+    {
         // copy L (lower triangular or lower trapezoidal matrix)
         for (size_t i = 0; i < SIZE_T_C(L.GetRowsNb()); ++i)
         {
             for (size_t j = 0; j < SIZE_T_C(L.GetColsNb()); ++j)
             {
-                if (i > j) L(i, j) = Atmp(i, j);
+                if (i > j) L(i, j) = LU(i, j);
                 else L(i, j) = i == j ? T_C(1) : T_C(0);
             }
         }
@@ -53,12 +68,12 @@ namespace la
         {
             for (size_t j = 0; j < SIZE_T_C(U.GetColsNb()); ++j)
             {
-                if (i <= j) U(i, j) = Atmp(i, j);
+                if (i <= j) U(i, j) = LU(i, j);
                 else U(i, j) = T_C(0);
             }
         }
         // Copy P (permutation matrix)
-        for (size_t i = 0; i < SIZE_T_C(ipv); ++i)
+        for (size_t i = 0; i < ipiv.size(); ++i)
         {
             if (i == SIZE_T_C(ipiv[i] - 1)) { P(i, i) = T_C(1); }
             else
@@ -70,6 +85,60 @@ namespace la
         return L;
     }
 
+    template <typename T>
+    Matrix<T>& MatLUFactor(Matrix<T>& LU, std::vector<int>& ipiv, Matrix<T>&& A, const int& flags)
+    {
+        (void)flags;
+        // take over the caller's buffer, the factorization is done in place
+        LU    = std::move(A);
+        int m = INT_C(LU.GetRowsNb()), n = INT_C(LU.GetColsNb()), lda = std::max(m, 1), info = 0;
+        ipiv.resize(SIZE_T_C(std::min(m, n)));
+        if constexpr (std::is_same_v<T, float>) sgetrf_(&m, &n, LU.data().data(), &lda, ipiv.data(), &info);
+        else if constexpr (std::is_same_v<T, double>) dgetrf_(&m, &n, LU.data().data(), &lda, ipiv.data(), &info);
+        else if constexpr (std::is_same_v<T, std::complex<float>>)
+            cgetrf_(&m, &n, FLOAT_P_R(LU.data().data()), &lda, ipiv.data(), &info);
+        else if constexpr (std::is_same_v<T, std::complex<double>>)
+            zgetrf_(&m, &n, DOUBLE_P_R(LU.data().data()), &lda, ipiv.data(), &info);
+        else throw std::runtime_error("MatLUFactor: unsupported type");
+        if (info < 0) throw std::runtime_error("MatLUFactor: illegal value");
+        else if (info > 0) throw std::runtime_error("MatLUFactor: singular matrix");
+        return LU;
+    }
+
+    template <typename T>
+    Matrix<T>& MatLUFactor(Matrix<T>& LU, std::vector<int>& ipiv, const Matrix<T>& A, const int& flags)
+    {
+        return MatLUFactor(LU, ipiv, Matrix<T>(A), flags);
+    }
+
+    template <typename T>
+    Matrix<T>& MatLUSolve(Matrix<T>& X, const Matrix<T>& LU, const std::vector<int>& ipiv, const Matrix<T>& B,
+                          const int& flags)
+    {
+        assert(LU.GetRowsNb() == LU.GetColsNb());
+        assert(B.GetRowsNb() == LU.GetRowsNb());
+        assert(X.GetRowsNb() == B.GetRowsNb());
+        assert(X.GetColsNb() == B.GetColsNb());
+        assert(ipiv.size() == LU.GetRowsNb());
+        char trans = (flags & LU::SOLVE_HT) ? 'C' : ((flags & LU::SOLVE_T) ? 'T' : 'N');
+        int n = INT_C(LU.GetRowsNb()), nrhs = INT_C(B.GetColsNb()), lda = std::max(n, 1), ldb = std::max(n, 1),
+            info = 0;
+        if (&X != &B) X = B;
+        // getrs does not modify the factors and the pivots
+        T* a    = const_cast<T*>(LU.data().data());
+        int* pv = const_cast<int*>(ipiv.data());
+        if constexpr (std::is_same_v<T, float>) sgetrs_(&trans, &n, &nrhs, a, &lda, pv, X.data().data(), &ldb, &info);
+        else if constexpr (std::is_same_v<T, double>)
+            dgetrs_(&trans, &n, &nrhs, a, &lda, pv, X.data().data(), &ldb, &info);
+        else if constexpr (std::is_same_v<T, std::complex<float>>)
+            cgetrs_(&trans, &n, &nrhs, FLOAT_P_R(a), &lda, pv, FLOAT_P_R(X.data().data()), &ldb, &info);
+        else if constexpr (std::is_same_v<T, std::complex<double>>)
+            zgetrs_(&trans, &n, &nrhs, DOUBLE_P_R(a), &lda, pv, DOUBLE_P_R(X.data().data()), &ldb, &info);
+        else throw std::runtime_error("MatLUSolve: unsupported type");
+        if (info < 0) throw std::runtime_error("MatLUSolve: illegal value");
+        return X;
+    }
+
 } // namespace la
 
 #undef DOUBLE_P_R
@@ -81,7 +150,18 @@ namespace la
 // Explicit template instantiation
 #define INSTANTIATE_LU_TEMPLATE(type)                                                                                  \
     template la::Matrix<type>& la::MatLU(la::Matrix<type>& L, la::Matrix<type>& U, la::Matrix<type>& P,                \
-                                         const la::Matrix<type>& A, const int& flags);
+                                         const la::Matrix<type>& A, const int& flags);                                 \
+    template la::Matrix<type>& la::MatLU(la::Matrix<type>& L, la::Matrix<type>& U, la::Matrix<type>& P,                \
+                                         la::Matrix<type>&& A, const int& flags);                                      \
+    template la::Matrix<type>& la::MatLUExpand(la::Matrix<type>& L, la::Matrix<type>& U, la::Matrix<type>& P,          \
+                                               const la::Matrix<type>& LU, const std::vector<int>& ipiv);              \
+    template la::Matrix<type>& la::MatLUFactor(la::Matrix<type>& LU, std::vector<int>& ipiv,                           \
+                                               const la::Matrix<type>& A, const int& flags);                           \
+    template la::Matrix<type>& la::MatLUFactor(la::Matrix<type>& LU, std::vector<int>& ipiv, la::Matrix<type>&& A,     \
+                                               const int& flags);                                                      \
+    template la::Matrix<type>& la::MatLUSolve(la::Matrix<type>& X, const la::Matrix<type>& LU,                         \
+                                              const std::vector<int>& ipiv, const la::Matrix<type>& B,                 \
+                                              const int& flags);
 
 #define INSTANTIATE_ALL_LU_TEMPLATES                                                                                   \
     INSTANTIATE_LU_TEMPLATE(float)                                                                                     \
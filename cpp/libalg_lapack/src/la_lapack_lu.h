@@ -11,7 +11,11 @@
 #error "USE_LAPACK is not defined"
 #endif
 
+#include <stdexcept>
+#include <utility>
+#include <vector>
 #include "la_blas_mult.h"
+#include "la_owned_matrix.h"
 #include "math/algebra/matrix.h"
 #include "math/algebra/matrix_operations.h"
 
@@ -20,8 +24,10 @@ namespace la
     namespace LU
     {
         enum Flags : int {
-            // any flag for future use
-            // FLAG1 = 1 << 0,
+            // solve with the transpose of A
+            SOLVE_T  = 1 << 0,
+            // solve with the conjugate transpose of A
+            SOLVE_HT = 1 << 1,
         };
     }
 
@@ -31,25 +37,50 @@ namespace la
     template <typename T>
     Matrix<T>& MatLU(Matrix<T>& L, Matrix<T>& U, Matrix<T>& P, const Matrix<T>& A, const int& flags = 0);
 
+    // In-place version, the factorization overwrites A instead of a copy of it (pass std::move(A)).
+    // The content of A is undefined on exit.
+    template <typename T>
+    Matrix<T>& MatLU(Matrix<T>& L, Matrix<T>& U, Matrix<T>& P, Matrix<T>&& A, const int& flags = 0);
+
+    // Explicit factors L, U and P from the packed form computed by MatLUFactor
+    template <typename T>
+    Matrix<T>& MatLUExpand(Matrix<T>& L, Matrix<T>& U, Matrix<T>& P, const Matrix<T>& LU, const std::vector<int>& ipiv);
+
+    // Compute the LU factorization of a M-by-N matrix A in the packed form of ?getrf.
+    // L (unit diagonal not stored) and U share LU, ipiv contains the 1 based row interchanges.
+    // The packed factors of a square matrix can be reused to solve any number of systems with MatLUSolve.
+    template <typename T>
+    Matrix<T>& MatLUFactor(Matrix<T>& LU, std::vector<int>& ipiv, const Matrix<T>& A, const int& flags = 0);
+
+    // In-place version, LU takes over the buffer of A (pass std::move(A)) and no copy is made
+    template <typename T>
+    Matrix<T>& MatLUFactor(Matrix<T>& LU, std::vector<int>& ipiv, Matrix<T>&& A, const int& flags = 0);
+
+    // Solve A * X = B (A^T * X = B with SOLVE_T, A^H * X = B with SOLVE_HT) from the packed factors (?getrs)
+    // B and X are n x nrhs, X can be the same matrix as B
+    template <typename T>
+    Matrix<T>& MatLUSolve(Matrix<T>& X, const Matrix<T>& LU, const std::vector<int>& ipiv, const Matrix<T>& B,
+                          const int& flags = 0);
+
     template <typename T> class MatrixLU
     {
       public:
         inline MatrixLU(const Matrix<T>& M)
-            : A_(M), L_(0, 0), U_(0, 0), P_(M.GetColsNb(), M.GetColsNb()), C_(0, 0), flags_(0)
+            : A_(M), L_(0, 0), U_(0, 0), P_(M.GetColsNb(), M.GetColsNb()), C_(0, 0), LU_(0, 0), flags_(0), owner_(false)
         {
-            if (M.GetRowsNb() < M.GetColsNb())
-            {
-                L_ = Matrix<T>(M.GetRowsNb(), M.GetRowsNb());
-                U_ = Matrix<T>(M.GetRowsNb(), M.GetColsNb());
-            }
-            else
-            {
-                L_ = Matrix<T>(M.GetRowsNb(), M.GetColsNb());
-                U_ = Matrix<T>(M.GetColsNb(), M.GetColsNb());
-            }
+            Allocate();
         }
 
-        inline const Matrix<T>& A() const { return A_; }
+        // owning mode, the matrix is moved in without a copy (pass std::move(M) or a temporary).
+        // Compute factorizes it in place into the packed factors, A() then only keeps the dimensions.
+        inline MatrixLU(Matrix<T>&& M)
+            : A_(std::move(M)), L_(0, 0), U_(0, 0), P_(A_->GetColsNb(), A_->GetColsNb()), C_(0, 0), LU_(0, 0),
+              flags_(0), owner_(true)
+        {
+            Allocate();
+        }
+
+        inline const Matrix<T>& A() const { return *A_; }
 
         inline const Matrix<T>& P() const { return P_; }
 
@@ -57,10 +88,20 @@ namespace la
 
         inline const Matrix<T>& U() const { return U_; }
 
+        // the packed factors are kept so that LU, ipiv and Solve do not factorize A again
         inline void Compute(const int& flags = 0)
         {
             flags_ = flags;
-            MatLU(L_, U_, P_, A_, flags_);
+            C_     = Matrix<T>(0, 0);
+            // MatLUExpand only sets the ones of the permutation
+            P_     = Matrix<T>(P_.GetRowsNb(), P_.GetColsNb());
+            if (owner_)
+            {
+                if (A_.Own().data().empty()) throw std::runtime_error("MatrixLU: matrix already factorized in place");
+                MatLUFactor(LU_, ipiv_, std::move(A_.Own()), flags_);
+            }
+            else MatLUFactor(LU_, ipiv_, *A_, flags_);
+            MatLUExpand(L_, U_, P_, LU_, ipiv_);
         }
 
         inline const Matrix<T>& C()
@@ -73,13 +114,56 @@ namespace la
             return C_;
         }
 
+        // packed factors used by Solve, kept by Compute or computed on the first call and reused afterwards
+        inline const Matrix<T>& LU()
+        {
+            if (LU_.size() == 0) MatLUFactor(LU_, ipiv_, *A_, flags_);
+            return LU_;
+        }
+
+        inline const std::vector<int>& ipiv()
+        {
+            LU();
+            return ipiv_;
+        }
+
+        // solve A * X = B, see MatLUSolve
+        inline Matrix<T>& Solve(Matrix<T>& X, const Matrix<T>& B, const int& flags = 0)
+        {
+            LU();
+            return MatLUSolve(X, LU_, ipiv_, B, flags);
+        }
+
+        inline Matrix<T> Solve(const Matrix<T>& B, const int& flags = 0)
+        {
+            Matrix<T> X{B.GetRowsNb(), B.GetColsNb()};
+            return Solve(X, B, flags);
+        }
+
       private:
-        const Matrix<T>& A_;
+        inline void Allocate()
+        {
+            if (A_->GetRowsNb() < A_->GetColsNb())
+            {
+                L_ = Matrix<T>(A_->GetRowsNb(), A_->GetRowsNb());
+                U_ = Matrix<T>(A_->GetRowsNb(), A_->GetColsNb());
+            }
+            else
+            {
+                L_ = Matrix<T>(A_->GetRowsNb(), A_->GetColsNb());
+                U_ = Matrix<T>(A_->GetColsNb(), A_->GetColsNb());
+            }
+        }
+
+        OwnedMatrix<T> A_;
         Matrix<T> L_;
         Matrix<T> U_;
         Matrix<T> P_;
         Matrix<T> C_;
+        Matrix<T> LU_;
+        std::vector<int> ipiv_;
         int flags_;
+        bool owner_;
     };
 } // namespace la
 
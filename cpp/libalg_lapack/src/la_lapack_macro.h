@@ -7,9 +7,32 @@
 /*     2023/06/13       */
 /************************/
 
+#include <complex>
+#include <type_traits>
+#include <vector>
+
 #define REALTYPE_DEFINE                                                                                                \
     using RealType = typename std::conditional<                                                                        \
         std::is_same<T, std::complex<double>>::value, double,                                                          \
         typename std::conditional<std::is_same<T, std::complex<float>>::value, float, T>::type>::type;
 
+namespace la
+{
+    // same as REALTYPE_DEFINE, usable in declarations
+    template <typename T>
+    using RealTypeOf = typename std::conditional<
+        std::is_same<T, std::complex<double>>::value, double,
+        typename std::conditional<std::is_same<T, std::complex<float>>::value, float, T>::type>::type;
+
+    // LAPACK workspaces kept by the caller between calls, the buffers only grow so repeated calls of the same size
+    // do not allocate
+    template <typename T> struct LapackWork
+    {
+        std::vector<T> work;
+        std::vector<RealTypeOf<T>> rwork;
+        std::vector<int> iwork;
+        std::vector<int> bwork;
+    };
+} // namespace la
+
 #endif
@@ -14,8 +14,7 @@
 #include "la_lapack_misc.h"
 #include "la_lapack_qr.h"
 
-#define T_C(x)  static_cast<T>(x)
-#define T_RT(x) static_cast<std::complex<RealType>>(x)
+#define T_C(x) static_cast<T>(x)
 
 namespace la
 {
@@ -38,16 +37,31 @@ namespace la
 
     template <typename T> T MatDet(const Matrix<T>& A)
     {
-        REALTYPE_DEFINE
         assert(A.GetRowsNb() == A.GetColsNb());
-        std::complex<RealType> res_ = T_RT(1);
-        la::Matrix<std::complex<RealType>> eigenvalues_{A.GetRowsNb(), 1};
         la::MatrixEigen<T> Eigen{A};
         Eigen.Compute();
-        for (size_t i = 0; i < A.GetRowsNb(); ++i) res_ *= Eigen.EC()(i, 0);
-        if constexpr (std::is_same<T, float>::value || std::is_same<T, double>::value) return res_.real();
+        const Matrix<T>& E_ = Eigen.E();
+        if constexpr (std::is_same<T, float>::value || std::is_same<T, double>::value)
+        {
+            // a conjugate pair contributes |lambda|^2, no complex product is needed
+            T res_ = T_C(1);
+            for (size_t i = 0; i < A.GetRowsNb(); ++i)
+            {
+                if (E_(i, 1) > T_C(0) && i + 1 < A.GetRowsNb())
+                {
+                    res_ *= E_(i, 0) * E_(i, 0) + E_(i, 1) * E_(i, 1);
+                    ++i;
+                }
+                else res_ *= E_(i, 0);
+            }
+            return res_;
+        }
         else if constexpr (std::is_same<T, std::complex<float>>::value || std::is_same<T, std::complex<double>>::value)
+        {
+            T res_ = T_C(1);
+            for (size_t i = 0; i < A.GetRowsNb(); ++i) res_ *= E_(i, 0);
             return res_;
+        }
         else throw std::runtime_error("MatDet: unsupported type");
     }
 
@@ -67,5 +81,4 @@ INSTANTIATE_ALL_MISC_TEMPLATES
 
 #undef INSTANTIATE_MISC_TEMPLATE
 #undef INSTANTIATE_ALL_MISC_TEMPLATES
-#undef T_RT
 #undef T_C
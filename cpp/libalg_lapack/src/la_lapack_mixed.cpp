@@ -0,0 +1,161 @@
+/************************/
+/*  la_lapack_mixed.cpp */
+/*    Version 1.0       */
+/*     2026/10/19       */
+/************************/
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <complex>
+#include <limits>
+#include <stdexcept>
+#include <type_traits>
+#include <vector>
+#include "la_blas_mult.h"
+#include "la_lapack_cholesky.h"
+#include "la_lapack_lu.h"
+#include "la_lapack_macro.h"
+#include "la_lapack_mixed.h"
+
+namespace la
+{
+    namespace
+    {
+        // single precision counterpart of T
+        template <typename T>
+        using LowTypeOf = typename std::conditional<std::is_same<T, std::complex<double>>::value, std::complex<float>,
+                                                    float>::type;
+
+        template <typename S, typename T> void MixedConvert(Matrix<S>& dst, const Matrix<T>& src)
+        {
+            std::vector<S>& d       = dst.data();
+            const std::vector<T>& s = src.data();
+            for (size_t i = 0; i < s.size(); ++i) d[i] = static_cast<S>(s[i]);
+        }
+
+        template <typename T> RealTypeOf<T> MixedNormInf(const Matrix<T>& A)
+        {
+            std::vector<RealTypeOf<T>> rows(A.GetRowsNb(), RealTypeOf<T>(0));
+            for (size_t j = 0; j < A.GetColsNb(); ++j)
+                for (size_t i = 0; i < A.GetRowsNb(); ++i) rows[i] += std::abs(A(i, j));
+            return rows.empty() ? RealTypeOf<T>(0) : *std::max_element(rows.begin(), rows.end());
+        }
+
+        template <typename T> RealTypeOf<T> MixedColMax(const Matrix<T>& X, const size_t j)
+        {
+            RealTypeOf<T> mx = 0;
+            for (size_t i = 0; i < X.GetRowsNb(); ++i)
+            {
+                const RealTypeOf<T> a = static_cast<RealTypeOf<T>>(std::abs(X(i, j)));
+                // std::max would skip a NaN
+                if (std::isnan(a)) return a;
+                mx = std::max(mx, a);
+            }
+            return mx;
+        }
+    } // namespace
+
+    template <typename T>
+    int MatSolveMixed(Matrix<T>& X, const Matrix<T>& A, const Matrix<T>& B, const int& flags, const size_t& maxIter)
+    {
+        static_assert(std::is_same_v<T, double> || std::is_same_v<T, std::complex<double>>,
+                      "MatSolveMixed: double precision types only");
+        using L_ = LowTypeOf<T>;
+        REALTYPE_DEFINE
+        const size_t n = A.GetRowsNb(), nrhs = B.GetColsNb();
+        assert(A.GetColsNb() == n);
+        assert(B.GetRowsNb() == n);
+        assert(X.GetRowsNb() == n && X.GetColsNb() == nrhs);
+        const bool bChol   = flags & MIXED::CHOLESKY;
+        const RealType nrm = MixedNormInf(A);
+        const RealType cte = nrm * std::numeric_limits<RealType>::epsilon() * std::sqrt(static_cast<RealType>(n));
+        size_t iter        = 0;
+        // the entries of A must be representable in single precision
+        bool bLow          = nrm <= static_cast<RealType>(std::numeric_limits<float>::max());
+        Matrix<L_> F{0, 0};
+        std::vector<int> ipiv;
+        if (bLow)
+        {
+            Matrix<L_> Al{n, n};
+            MixedConvert(Al, A);
+            try
+            {
+                if (bChol)
+                {
+                    F = Matrix<L_>(n, n);
+                    MatCholesky(F, Al);
+                }
+                else MatLUFactor(F, ipiv, std::move(Al));
+            }
+            catch (const std::runtime_error&)
+            {
+                bLow = false;
+            }
+        }
+        if (bLow)
+        {
+            Matrix<L_> Rl{n, nrhs};
+            Matrix<T> R{n, nrhs}, AX{n, nrhs};
+            // X_0 from the single precision factors
+            MixedConvert(Rl, B);
+            if (bChol) MatCholeskySolve(Rl, F, Rl);
+            else MatLUSolve(Rl, F, ipiv, Rl);
+            MixedConvert(X, Rl);
+            for (;;)
+            {
+                // R = B - A * X in double precision
+                if (nrhs == 1) MatMultVec(AX, A, X);
+                else MatMult(AX, A, X);
+                bool bConv = true, bFinite = true;
+                for (size_t i = 0; i < R.size(); ++i) R.data()[i] = B.data()[i] - AX.data()[i];
+                for (size_t j = 0; j < nrhs && bFinite; ++j)
+                {
+                    const RealType rn = MixedColMax(R, j), xn = MixedColMax(X, j);
+                    bFinite           = std::isfinite(rn) && std::isfinite(xn);
+                    bConv             = bConv && rn <= xn * cte;
+                }
+                // a non finite residual cannot be refined, solve in double precision directly (as dsgesv)
+                if (!bFinite) break;
+                if (bConv) return static_cast<int>(iter);
+                if (iter == maxIter) break;
+                // X += A^-1 * R with the single precision factors
+                MixedConvert(Rl, R);
+                if (bChol) MatCholeskySolve(Rl, F, Rl);
+                else MatLUSolve(Rl, F, ipiv, Rl);
+                for (size_t i = 0; i < X.size(); ++i) X.data()[i] += static_cast<T>(Rl.data()[i]);
+                ++iter;
+            }
+        }
+        // double precision fallback
+        if (bChol)
+        {
+            Matrix<T> L{n, n};
+            MatCholesky(L, A);
+            MatCholeskySolve(X, L, B);
+        }
+        else
+        {
+            Matrix<T> LU{0, 0};
+            std::vector<int> piv;
+            MatLUFactor(LU, piv, A);
+            MatLUSolve(X, LU, piv, B);
+        }
+        return -static_cast<int>(iter) - 1;
+    }
+
+} // namespace la
+
+// Explicit template instantiation
+#define INSTANTIATE_MIXED_TEMPLATE(type)                                                                               \
+    template int la::MatSolveMixed(la::Matrix<type>& X, const la::Matrix<type>& A, const la::Matrix<type>& B,          \
+                                   const int& flags, const size_t& maxIter);
+
+#define INSTANTIATE_ALL_MIXED_TEMPLATES                                                                                \
+    INSTANTIATE_MIXED_TEMPLATE(double)                                                                                 \
+    INSTANTIATE_MIXED_TEMPLATE(std::complex<double>)
+
+INSTANTIATE_ALL_MIXED_TEMPLATES
+
+#undef INSTANTIATE_MIXED_TEMPLATE
+#undef INSTANTIATE_ALL_MIXED_TEMPLATES
@@ -0,0 +1,49 @@
+#ifndef _LA_LAPACK_MIXED_H_0EC8A1AB67C34DB7AD34E21E6BA8BFE2_
+#define _LA_LAPACK_MIXED_H_0EC8A1AB67C34DB7AD34E21E6BA8BFE2_
+
+/************************/
+/*  la_lapack_mixed.h   */
+/*    Version 1.0       */
+/*     2026/10/19       */
+/************************/
+
+#ifndef USE_LAPACK
+#error "USE_LAPACK is not defined"
+#endif
+
+#include "la_blas_mult.h"
+#include "math/algebra/matrix.h"
+#include "math/algebra/matrix_operations.h"
+
+namespace la
+{
+    namespace MIXED
+    {
+        enum Flags : int {
+            // A is symmetric (hermitian) positive definite, Cholesky factorization instead of LU
+            CHOLESKY = 1 << 0,
+        };
+    }
+
+    // Solve A * X = B for double or complex<double> matrices with a single precision factorization refined in
+    // double precision, as ?sgesv / ?cgesv (?sposv / ?cposv with CHOLESKY).
+    // The residual B - A * X is computed in double precision and the correction solved with the single precision
+    // factors until ||r||_inf <= ||x||_inf * ||A||_inf * eps * sqrt(n) for every column.
+    // When the single precision factorization fails or the refinement does not converge in maxIter steps the system
+    // is solved with a double precision factorization.
+    // Returns the number of refinement steps, -(steps + 1) when the double precision fallback was used.
+    template <typename T>
+    int MatSolveMixed(Matrix<T>& X, const Matrix<T>& A, const Matrix<T>& B, const int& flags = 0,
+                      const size_t& maxIter = 30);
+
+    template <typename T>
+    Matrix<T> MatSolveMixed(const Matrix<T>& A, const Matrix<T>& B, const int& flags = 0, const size_t& maxIter = 30)
+    {
+        Matrix<T> X{A.GetColsNb(), B.GetColsNb()};
+        MatSolveMixed(X, A, B, flags, maxIter);
+        return X;
+    }
+
+} // namespace la
+
+#endif
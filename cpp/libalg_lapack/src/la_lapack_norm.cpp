@@ -0,0 +1,235 @@
+/************************/
+/*  la_lapack_norm.cpp  */
+/*    Version 1.0       */
+/*     2026/10/19       */
+/************************/
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <complex>
+#include <limits>
+#include <type_traits>
+#include <vector>
+#include "la_blas_mult.h"
+#include "la_lapack_lu.h"
+#include "la_lapack_macro.h"
+#include "la_lapack_norm.h"
+#include "lapack_interface.h"
+
+#define T_C(x)        static_cast<T>(x)
+#define INT_C(x)      static_cast<int>(x)
+#define SIZE_T_C(x)   static_cast<size_t>(x)
+#define FLOAT_P_R(x)  reinterpret_cast<float*>(x)
+#define DOUBLE_P_R(x) reinterpret_cast<double*>(x)
+
+namespace la
+{
+    namespace
+    {
+        template <typename T> RealTypeOf<T> NormVec(const Matrix<T>& x)
+        {
+            RealTypeOf<T> s_ = 0;
+            for (const T& v : x.data()) s_ += std::norm(v);
+            return std::sqrt(s_);
+        }
+
+        template <typename T> void NormScale(Matrix<T>& x, const RealTypeOf<T>& s)
+        {
+            for (T& v : x.data()) v /= T_C(s);
+        }
+
+        // power iteration on S^H * S (as MATLAB normest), mult(y, x) sets y = S * x and multH(x, y) x = S^H * y.
+        // x holds the starting vector (n x 1), the workspace y is m x 1.
+        template <typename T, typename F, typename FH>
+        RealTypeOf<T> NormPower(Matrix<T>& x, Matrix<T>& y, F&& mult, FH&& multH, const RealTypeOf<T>& tol,
+                                const size_t& maxIter)
+        {
+            REALTYPE_DEFINE
+            RealType e = NormVec(x);
+            if (e == RealType(0)) return 0;
+            NormScale(x, e);
+            RealType e0 = 0;
+            for (size_t it = 0; it < maxIter && std::abs(e - e0) > tol * e; ++it)
+            {
+                e0 = e;
+                mult(y, x);
+                RealType ny = NormVec(y);
+                if (ny == RealType(0))
+                {
+                    // x is in the null space, restart from a vector which is not
+                    for (size_t i = 0; i < y.GetRowsNb(); ++i) y(i, 0) = (i % 2) ? T_C(1) : T_C(-1);
+                    ny = NormVec(y);
+                }
+                multH(x, y);
+                const RealType nx = NormVec(x);
+                if (nx == RealType(0)) return 0;
+                e = nx / ny;
+                NormScale(x, nx);
+            }
+            return e;
+        }
+    } // namespace
+
+    template <typename T> RealTypeOf<T> MatNorm(const Matrix<T>& A, const int& norm)
+    {
+        REALTYPE_DEFINE
+        char cnorm;
+        switch (norm)
+        {
+        case NORM::ONE: cnorm = '1'; break;
+        case NORM::INF: cnorm = 'I'; break;
+        case NORM::FROBENIUS: cnorm = 'F'; break;
+        case NORM::MAX: cnorm = 'M'; break;
+        default: throw std::runtime_error("MatNorm: unsupported norm");
+        }
+        int m = INT_C(A.GetRowsNb()), n = INT_C(A.GetColsNb()), lda = std::max(m, 1);
+        if (m == 0 || n == 0) return 0;
+        T* a = const_cast<T*>(A.data().data());
+        // only referenced by the infinity norm
+        std::vector<RealType> work(SIZE_T_C(m));
+        if constexpr (std::is_same_v<T, float>) return slange_(&cnorm, &m, &n, a, &lda, work.data());
+        else if constexpr (std::is_same_v<T, double>) return dlange_(&cnorm, &m, &n, a, &lda, work.data());
+        else if constexpr (std::is_same_v<T, std::complex<float>>)
+            return clange_(&cnorm, &m, &n, FLOAT_P_R(a), &lda, work.data());
+        else if constexpr (std::is_same_v<T, std::complex<double>>)
+            return zlange_(&cnorm, &m, &n, DOUBLE_P_R(a), &lda, work.data());
+        else throw std::runtime_error("MatNorm: unsupported type");
+    }
+
+    template <typename T>
+    RealTypeOf<T> MatCondEst(const Matrix<T>& LU, const std::vector<int>& ipiv, const RealTypeOf<T>& anorm,
+                             const int& norm)
+    {
+        REALTYPE_DEFINE
+        assert(LU.GetRowsNb() == LU.GetColsNb());
+        assert(ipiv.size() == LU.GetRowsNb());
+        (void)ipiv;
+        if (norm != NORM::ONE && norm != NORM::INF) throw std::runtime_error("MatCondEst: unsupported norm");
+        char cnorm = (norm == NORM::ONE) ? '1' : 'I';
+        int n = INT_C(LU.GetRowsNb()), lda = std::max(n, 1), info = 0;
+        if (n == 0) return 0;
+        RealType an = anorm, rcond = 0;
+        T* a        = const_cast<T*>(LU.data().data());
+        if constexpr (std::is_same_v<T, float> || std::is_same_v<T, double>)
+        {
+            std::vector<T> work(4 * SIZE_T_C(n));
+            std::vector<int> iwork(SIZE_T_C(n));
+            if constexpr (std::is_same_v<T, float>)
+                sgecon_(&cnorm, &n, a, &lda, &an, &rcond, work.data(), iwork.data(), &info);
+            else dgecon_(&cnorm, &n, a, &lda, &an, &rcond, work.data(), iwork.data(), &info);
+        }
+        else if constexpr (std::is_same_v<T, std::complex<float>> || std::is_same_v<T, std::complex<double>>)
+        {
+            std::vector<T> work(2 * SIZE_T_C(n));
+            std::vector<RealType> rwork(2 * SIZE_T_C(n));
+            if constexpr (std::is_same_v<T, std::complex<float>>)
+                cgecon_(&cnorm, &n, FLOAT_P_R(a), &lda, &an, &rcond, FLOAT_P_R(work.data()), rwork.data(), &info);
+            else zgecon_(&cnorm, &n, DOUBLE_P_R(a), &lda, &an, &rcond, DOUBLE_P_R(work.data()), rwork.data(), &info);
+        }
+        else throw std::runtime_error("MatCondEst: unsupported type");
+        if (info < 0) throw std::runtime_error("MatCondEst: illegal value");
+        return rcond > RealType(0) ? RealType(1) / rcond : std::numeric_limits<RealType>::infinity();
+    }
+
+    template <typename T> RealTypeOf<T> MatCondEst(const Matrix<T>& L, const RealTypeOf<T>& anorm, const int& flags)
+    {
+        REALTYPE_DEFINE
+        assert(L.GetRowsNb() == L.GetColsNb());
+        char uplo = (flags & CHOLESKY::UPPER) ? 'U' : 'L';
+        int n = INT_C(L.GetRowsNb()), lda = std::max(n, 1), info = 0;
+        if (n == 0) return 0;
+        RealType an = anorm, rcond = 0;
+        T* a        = const_cast<T*>(L.data().data());
+        if constexpr (std::is_same_v<T, float> || std::is_same_v<T, double>)
+        {
+            std::vector<T> work(3 * SIZE_T_C(n));
+            std::vector<int> iwork(SIZE_T_C(n));
+            if constexpr (std::is_same_v<T, float>)
+                spocon_(&uplo, &n, a, &lda, &an, &rcond, work.data(), iwork.data(), &info);
+            else dpocon_(&uplo, &n, a, &lda, &an, &rcond, work.data(), iwork.data(), &info);
+        }
+        else if constexpr (std::is_same_v<T, std::complex<float>> || std::is_same_v<T, std::complex<double>>)
+        {
+            std::vector<T> work(2 * SIZE_T_C(n));
+            std::vector<RealType> rwork(SIZE_T_C(n));
+            if constexpr (std::is_same_v<T, std::complex<float>>)
+                cpocon_(&uplo, &n, FLOAT_P_R(a), &lda, &an, &rcond, FLOAT_P_R(work.data()), rwork.data(), &info);
+            else zpocon_(&uplo, &n, DOUBLE_P_R(a), &lda, &an, &rcond, DOUBLE_P_R(work.data()), rwork.data(), &info);
+        }
+        else throw std::runtime_error("MatCondEst: unsupported type");
+        if (info < 0) throw std::runtime_error("MatCondEst: illegal value");
+        return rcond > RealType(0) ? RealType(1) / rcond : std::numeric_limits<RealType>::infinity();
+    }
+
+    template <typename T> RealTypeOf<T> MatNorm2Est(const Matrix<T>& A, const RealTypeOf<T>& tol, const size_t& maxIter)
+    {
+        const size_t m = A.GetRowsNb(), n = A.GetColsNb();
+        if (m == 0 || n == 0) return 0;
+        // start from the absolute column sums
+        Matrix<T> x{n, 1}, y{m, 1};
+        for (size_t j = 0; j < n; ++j)
+            for (size_t i = 0; i < m; ++i) x(j, 0) += T_C(std::abs(A(i, j)));
+        const T* a = A.data().data();
+        return NormPower(
+            x, y,
+            [&](Matrix<T>& y_, const Matrix<T>& x_) {
+                Gemm('N', 'N', m, 1, n, T_C(1), a, m, x_.data().data(), n, T_C(0), y_.data().data(), m);
+            },
+            [&](Matrix<T>& x_, const Matrix<T>& y_) {
+                Gemm('C', 'N', n, 1, m, T_C(1), a, m, y_.data().data(), m, T_C(0), x_.data().data(), n);
+            },
+            tol, maxIter);
+    }
+
+    template <typename T>
+    RealTypeOf<T> MatCond2Est(const Matrix<T>& A, const Matrix<T>& LU, const std::vector<int>& ipiv,
+                              const RealTypeOf<T>& tol, const size_t& maxIter)
+    {
+        REALTYPE_DEFINE
+        assert(A.GetRowsNb() == A.GetColsNb());
+        assert(LU.GetRowsNb() == A.GetRowsNb() && LU.GetColsNb() == A.GetColsNb());
+        const size_t n = A.GetRowsNb();
+        if (n == 0) return 0;
+        for (size_t i = 0; i < n; ++i)
+            if (LU(i, i) == T_C(0)) return std::numeric_limits<RealType>::infinity();
+        // ||A^-1||_2 from the power iteration on A^-H * A^-1
+        Matrix<T> x{n, 1}, y{n, 1};
+        for (size_t i = 0; i < n; ++i) x(i, 0) = T_C(1);
+        const RealType ninv = NormPower(
+            x, y, [&](Matrix<T>& y_, const Matrix<T>& x_) { MatLUSolve(y_, LU, ipiv, x_); },
+            [&](Matrix<T>& x_, const Matrix<T>& y_) { MatLUSolve(x_, LU, ipiv, y_, LU::SOLVE_HT); }, tol, maxIter);
+        return MatNorm2Est(A, tol, maxIter) * ninv;
+    }
+
+} // namespace la
+
+#undef DOUBLE_P_R
+#undef FLOAT_P_R
+#undef INT_C
+#undef SIZE_T_C
+#undef T_C
+
+// Explicit template instantiation
+#define INSTANTIATE_NORM_TEMPLATE(type)                                                                                \
+    template la::RealTypeOf<type> la::MatNorm<type>(const la::Matrix<type>& A, const int& norm);                       \
+    template la::RealTypeOf<type> la::MatCondEst<type>(const la::Matrix<type>& LU, const std::vector<int>& ipiv,       \
+                                                       const la::RealTypeOf<type>& anorm, const int& norm);            \
+    template la::RealTypeOf<type> la::MatCondEst<type>(const la::Matrix<type>& L, const la::RealTypeOf<type>& anorm,   \
+                                                       const int& flags);                                              \
+    template la::RealTypeOf<type> la::MatNorm2Est<type>(const la::Matrix<type>& A, const la::RealTypeOf<type>& tol,    \
+                                                        const size_t& maxIter);                                        \
+    template la::RealTypeOf<type> la::MatCond2Est<type>(const la::Matrix<type>& A, const la::Matrix<type>& LU,         \
+                                                        const std::vector<int>& ipiv, const la::RealTypeOf<type>& tol, \
+                                                        const size_t& maxIter);
+
+#define INSTANTIATE_ALL_NORM_TEMPLATES                                                                                 \
+    INSTANTIATE_NORM_TEMPLATE(float)                                                                                   \
+    INSTANTIATE_NORM_TEMPLATE(double)                                                                                  \
+    INSTANTIATE_NORM_TEMPLATE(std::complex<float>)                                                                     \
+    INSTANTIATE_NORM_TEMPLATE(std::complex<double>)
+
+INSTANTIATE_ALL_NORM_TEMPLATES
+
+#undef INSTANTIATE_NORM_TEMPLATE
+#undef INSTANTIATE_ALL_NORM_TEMPLATES
@@ -0,0 +1,83 @@
+#ifndef _LA_LAPACK_NORM_H_9C539E79562843D99D34F476BA5430C4_
+#define _LA_LAPACK_NORM_H_9C539E79562843D99D34F476BA5430C4_
+
+/************************/
+/*   la_lapack_norm.h   */
+/*    Version 1.0       */
+/*     2026/10/19       */
+/************************/
+
+#ifndef USE_LAPACK
+#error "USE_LAPACK is not defined"
+#endif
+
+#include <stdexcept>
+#include <vector>
+#include "la_blas_mult.h"
+#include "la_lapack_cholesky.h"
+#include "la_lapack_lu.h"
+#include "la_lapack_macro.h"
+#include "math/algebra/matrix.h"
+#include "math/algebra/matrix_operations.h"
+
+namespace la
+{
+    namespace NORM
+    {
+        enum Flags : int {
+            // maximum absolute column sum
+            ONE       = 1,
+            // maximum absolute row sum
+            INF       = 2,
+            // square root of the sum of squares
+            FROBENIUS = 3,
+            // largest absolute value, not a consistent matrix norm
+            MAX       = 4,
+        };
+    }
+
+    // matrix norm (?lange), norm is one of NORM::Flags
+    template <typename T> RealTypeOf<T> MatNorm(const Matrix<T>& A, const int& norm = NORM::ONE);
+
+    // Condition number estimate ||A|| * ||A^-1|| in the 1-norm (NORM::INF for the infinity norm) from the packed LU
+    // factors of MatLUFactor (?gecon), anorm is the norm of the original matrix A.
+    // The cost is O(n^2) on top of the factorization, returns infinity for an exactly singular matrix.
+    template <typename T>
+    RealTypeOf<T> MatCondEst(const Matrix<T>& LU, const std::vector<int>& ipiv, const RealTypeOf<T>& anorm,
+                             const int& norm = NORM::ONE);
+
+    // Condition number estimate in the 1-norm from the factor of MatCholesky (?pocon), flags must match the ones used
+    // for the factorization (CHOLESKY::UPPER), anorm is the 1-norm of the original matrix A.
+    template <typename T>
+    RealTypeOf<T> MatCondEst(const Matrix<T>& L, const RealTypeOf<T>& anorm, const int& flags = 0);
+
+    // Estimate of the 2-norm (largest singular value) of A by power iteration on A^H * A, O(m * n) per iteration.
+    // The iteration stops when the relative change is below tol or after maxIter iterations.
+    template <typename T>
+    RealTypeOf<T> MatNorm2Est(const Matrix<T>& A, const RealTypeOf<T>& tol = RealTypeOf<T>(1e-6),
+                              const size_t& maxIter = 100);
+
+    // Estimate of the 2-norm condition number of the square matrix A, ||A^-1||_2 is estimated by inverse power
+    // iteration with the packed LU factors of A (two triangular solves per iteration).
+    template <typename T>
+    RealTypeOf<T> MatCond2Est(const Matrix<T>& A, const Matrix<T>& LU, const std::vector<int>& ipiv,
+                              const RealTypeOf<T>& tol = RealTypeOf<T>(1e-6), const size_t& maxIter = 100);
+
+    // condition number estimate from a computed MatrixLU, the norm of A() is computed so the matrix must not have
+    // been released by an owning MatrixLU
+    template <typename T> inline RealTypeOf<T> MatCondEst(MatrixLU<T>& lu, const int& norm = NORM::ONE)
+    {
+        if (lu.A().data().empty()) throw std::runtime_error("MatCondEst: matrix released by Compute");
+        return MatCondEst(lu.LU(), lu.ipiv(), MatNorm(lu.A(), norm), norm);
+    }
+
+    // condition number estimate from a computed (not pivoted) MatrixCholesky
+    template <typename T> inline RealTypeOf<T> MatCondEst(const MatrixCholesky<T>& chol)
+    {
+        if (!chol.piv().empty()) throw std::runtime_error("MatCondEst: pivoted Cholesky factorization");
+        return MatCondEst(chol.L(), MatNorm(chol.A(), NORM::ONE), chol.GetFlags());
+    }
+
+} // namespace la
+
+#endif
@@ -4,10 +4,12 @@
 /*     2023/06/01       */
 /************************/
 
+#include <algorithm>
 #include <cassert>
 #include <complex>
 #include <type_traits>
 #include <typeinfo>
+#include <utility>
 #include "la_blas_mult.h"
 #include "la_lapack_qr.h"
 #include "lapack_interface.h"
@@ -19,106 +21,154 @@
 
 namespace la
 {
-    template <typename T> Matrix<T>& MatQR(Matrix<T>& Q, Matrix<T>& R, const Matrix<T>& A, const int& flags)
+    template <typename T> Matrix<T>& MatQR(Matrix<T>& Q, Matrix<T>& R, Matrix<T>&& A, const int& flags)
     {
         assert(Q.GetRowsNb() == A.GetRowsNb());
         assert(Q.GetColsNb() == A.GetRowsNb());
         assert(R.GetRowsNb() == A.GetRowsNb());
         assert(R.GetColsNb() == A.GetColsNb());
-        (void)flags;
-        int dimsquare = INT_C(std::max(A.GetRowsNb(), A.GetColsNb()));
-        int m_orig = INT_C(A.GetRowsNb()), n_orig = INT_C(A.GetColsNb());
-        int m = dimsquare, n = dimsquare;
-        Matrix<T> Atmp{SIZE_T_C(m), SIZE_T_C(n)};
-        // copy A in the expanded Atmp matrix
-        for (size_t i = 0; i < SIZE_T_C(m_orig); ++i)
-            for (size_t j = 0; j < SIZE_T_C(n_orig); ++j) Atmp(i, j) = A(i, j);
-        int lda   = m;
-        int lwork = -1, info = 0;
-        std::vector<T> work(1), tau(SIZE_T_C(std::min(m, n)));
-        if constexpr (std::is_same_v<T, float>)
-        {
-            sgeqrf_(&m, &n, Atmp.data().data(), &lda, tau.data(), work.data(), &lwork, &info);
-            lwork = INT_C(work[0]);
-            work.resize(SIZE_T_C(lwork));
-            sgeqrf_(&m, &n, Atmp.data().data(), &lda, tau.data(), work.data(), &lwork, &info);
-        }
-        else if constexpr (std::is_same_v<T, double>)
+        // the Householder vectors overwrite the buffer of A, Q is then generated in its own storage
+        Matrix<T> QR;
+        std::vector<T> tau;
+        MatQRFactor(QR, tau, std::move(A), flags);
+        return MatQRExpand(Q, R, QR, tau);
+    }
+
+    template <typename T> Matrix<T>& MatQR(Matrix<T>& Q, Matrix<T>& R, const Matrix<T>& A, const int& flags)
+    {
+        return MatQR(Q, R, Matrix<T>(A), flags);
+    }
+
+    template <typename T>
+    Matrix<T>& MatQRExpand(Matrix<T>& Q, Matrix<T>& R, const Matrix<T>& QR, const std::vector<T>& tau)
+    {
+        assert(Q.GetRowsNb() == QR.GetRowsNb());
+        assert(Q.GetColsNb() == QR.GetRowsNb());
+        assert(R.GetRowsNb() == QR.GetRowsNb());
+        assert(R.GetColsNb() == QR.GetColsNb());
+        assert(tau.size() == std::min(QR.GetRowsNb(), QR.GetColsNb()));
+        int m = INT_C(QR.GetRowsNb()), k = INT_C(tau.size()), lda = std::max(m, 1), lwork = -1, info = 0;
+        // the elements on and above the diagonal contain the min(M,N)-by-N upper trapezoidal matrix R
+        for (size_t j = 0; j < R.GetColsNb(); ++j)
+            for (size_t i = 0; i < R.GetRowsNb(); ++i) R(i, j) = i <= j ? QR(i, j) : T(0);
+        // the first k columns hold the Householder vectors, ?orgqr / ?ungqr generate the M-by-M matrix Q from them
+        std::copy_n(QR.data().begin(), SIZE_T_C(m) * SIZE_T_C(k), Q.data().begin());
+        std::vector<T> work(1);
+        T* t = const_cast<T*>(tau.data());
+        for (int pass = 0; pass < 2; ++pass)
         {
-            dgeqrf_(&m, &n, Atmp.data().data(), &lda, tau.data(), work.data(), &lwork, &info);
-            lwork = INT_C(work[0]);
-            work.resize(SIZE_T_C(lwork));
-            dgeqrf_(&m, &n, Atmp.data().data(), &lda, tau.data(), work.data(), &lwork, &info);
+            if constexpr (std::is_same_v<T, float>)
+                sorgqr_(&m, &m, &k, Q.data().data(), &lda, t, work.data(), &lwork, &info);
+            else if constexpr (std::is_same_v<T, double>)
+                dorgqr_(&m, &m, &k, Q.data().data(), &lda, t, work.data(), &lwork, &info);
+            else if constexpr (std::is_same_v<T, std::complex<float>>)
+                cungqr_(&m, &m, &k, FLOAT_P_R(Q.data().data()), &lda, FLOAT_P_R(t), FLOAT_P_R(work.data()), &lwork,
+                        &info);
+            else if constexpr (std::is_same_v<T, std::complex<double>>)
+                zungqr_(&m, &m, &k, DOUBLE_P_R(Q.data().data()), &lda, DOUBLE_P_R(t), DOUBLE_P_R(work.data()),
+                        &lwork, &info);
+            else throw std::runtime_error("MatQRExpand: type not supported");
+            if (info < 0) throw std::runtime_error("MatQRExpand: illegal value");
+            if (pass == 0)
+            {
+                lwork = std::max(INT_C(std::real(work[0])), 1);
+                work.resize(SIZE_T_C(lwork));
+            }
         }
-        else if constexpr (std::is_same_v<T, std::complex<float>>)
+        return Q;
+    }
+
+    template <typename T>
+    Matrix<T>& MatQRFactor(Matrix<T>& QR, std::vector<T>& tau, Matrix<T>&& A, const int& flags)
+    {
+        (void)flags;
+        // take over the caller's buffer, the factorization is done in place
+        QR    = std::move(A);
+        int m = INT_C(QR.GetRowsNb()), n = INT_C(QR.GetColsNb()), lda = std::max(m, 1), lwork = -1, info = 0;
+        std::vector<T> work(1);
+        tau.resize(SIZE_T_C(std::min(m, n)));
+        for (int pass = 0; pass < 2; ++pass)
         {
-            cgeqrf_(&m, &n, FLOAT_P_R(Atmp.data().data()), &lda, FLOAT_P_R(tau.data()), FLOAT_P_R(work.data()), &lwork,
-                    &info);
-            lwork = INT_C(work[0].real());
-            work.resize(SIZE_T_C(lwork));
-            cgeqrf_(&m, &n, FLOAT_P_R(Atmp.data().data()), &lda, FLOAT_P_R(tau.data()), FLOAT_P_R(work.data()), &lwork,
-                    &info);
+            if constexpr (std::is_same_v<T, float>)
+                sgeqrf_(&m, &n, QR.data().data(), &lda, tau.data(), work.data(), &lwork, &info);
+            else if constexpr (std::is_same_v<T, double>)
+                dgeqrf_(&m, &n, QR.data().data(), &lda, tau.data(), work.data(), &lwork, &info);
+            else if constexpr (std::is_same_v<T, std::complex<float>>)
+                cgeqrf_(&m, &n, FLOAT_P_R(QR.data().data()), &lda, FLOAT_P_R(tau.data()), FLOAT_P_R(work.data()),
+                        &lwork, &info);
+            else if constexpr (std::is_same_v<T, std::complex<double>>)
+                zgeqrf_(&m, &n, DOUBLE_P_R(QR.data().data()), &lda, DOUBLE_P_R(tau.data()), DOUBLE_P_R(work.data()),
+                        &lwork, &info);
+            else throw std::runtime_error("MatQRFactor: type not supported");
+            if (info < 0) throw std::runtime_error("MatQRFactor: illegal value");
+            if (pass == 0)
+            {
+                lwork = std::max(INT_C(std::real(work[0])), 1);
+                work.resize(SIZE_T_C(lwork));
+            }
         }
-        else if constexpr (std::is_same_v<T, std::complex<double>>)
+        return QR;
+    }
+
+    template <typename T>
+    Matrix<T>& MatQRFactor(Matrix<T>& QR, std::vector<T>& tau, const Matrix<T>& A, const int& flags)
+    {
+        return MatQRFactor(QR, tau, Matrix<T>(A), flags);
+    }
+
+    template <typename T>
+    Matrix<T>& MatQRSolve(Matrix<T>& X, const Matrix<T>& QR, const std::vector<T>& tau, const Matrix<T>& B,
+                          const int& flags)
+    {
+        assert(QR.GetRowsNb() >= QR.GetColsNb());
+        assert(B.GetRowsNb() == QR.GetRowsNb());
+        assert(X.GetRowsNb() == QR.GetColsNb());
+        assert(X.GetColsNb() == B.GetColsNb());
+        assert(tau.size() == QR.GetColsNb());
+        (void)flags;
+        constexpr bool bRe = std::is_same_v<T, float> || std::is_same_v<T, double>;
+        char side = 'L', trans = bRe ? 'T' : 'C', uplo = 'U', notrans = 'N', diag = 'N';
+        int m = INT_C(QR.GetRowsNb()), n = INT_C(QR.GetColsNb()), nrhs = INT_C(B.GetColsNb()), lda = std::max(m, 1),
+            ldb = std::max(m, 1), lwork = -1, info = 0;
+        // C = Q^H * B, the first n rows are overwritten by the solution of R * X = C(0:n, :)
+        Matrix<T> C{B};
+        std::vector<T> work(1);
+        // ormqr and trtrs do not modify the factors
+        T* a = const_cast<T*>(QR.data().data());
+        T* t = const_cast<T*>(tau.data());
+        for (int pass = 0; pass < 2; ++pass)
         {
-            zgeqrf_(&m, &n, DOUBLE_P_R(Atmp.data().data()), &lda, DOUBLE_P_R(tau.data()), DOUBLE_P_R(work.data()),
-                    &lwork, &info);
-            lwork = INT_C(work[0].real());
-            work.resize(SIZE_T_C(lwork));
-            zgeqrf_(&m, &n, DOUBLE_P_R(Atmp.data().data()), &lda, DOUBLE_P_R(tau.data()), DOUBLE_P_R(work.data()),
-                    &lwork, &info);
+            if constexpr (std::is_same_v<T, float>)
+                sormqr_(&side, &trans, &m, &nrhs, &n, a, &lda, t, C.data().data(), &ldb, work.data(), &lwork, &info);
+            else if constexpr (std::is_same_v<T, double>)
+                dormqr_(&side, &trans, &m, &nrhs, &n, a, &lda, t, C.data().data(), &ldb, work.data(), &lwork, &info);
+            else if constexpr (std::is_same_v<T, std::complex<float>>)
+                cunmqr_(&side, &trans, &m, &nrhs, &n, FLOAT_P_R(a), &lda, FLOAT_P_R(t), FLOAT_P_R(C.data().data()),
+                        &ldb, FLOAT_P_R(work.data()), &lwork, &info);
+            else if constexpr (std::is_same_v<T, std::complex<double>>)
+                zunmqr_(&side, &trans, &m, &nrhs, &n, DOUBLE_P_R(a), &lda, DOUBLE_P_R(t), DOUBLE_P_R(C.data().data()),
+                        &ldb, DOUBLE_P_R(work.data()), &lwork, &info);
+            else throw std::runtime_error("MatQRSolve: type not supported");
+            if (info < 0) throw std::runtime_error("MatQRSolve: illegal value");
+            if (pass == 0)
+            {
+                lwork = std::max(INT_C(std::real(work[0])), 1);
+                work.resize(SIZE_T_C(lwork));
+            }
         }
-        else { throw std::runtime_error("MatQR: type not supported"); }
-        if (info < 0) throw std::runtime_error("MatQR: illegal value");
-        else if (info > 0) throw std::runtime_error("MatQR: matrix is not full rank");
-        // R are in the bottom right corner of Atmp as the matrix atmp is the transpose of a
-        // column major matrix
-        // the elements on and below the diagonal of the array
-        //  contain the min(M,N)-by-N upper trapezoidal matrix R (R is upper triangular if m >= n);
-        for (size_t i = 0; i < R.GetRowsNb(); ++i)
-            for (size_t j = i; j < R.GetColsNb(); ++j) R(i, j) = Atmp(i, j);
         if constexpr (std::is_same_v<T, float>)
-        {
-            lwork = -1;
-            sorgqr_(&m, &n, &n, Atmp.data().data(), &lda, tau.data(), work.data(), &lwork, &info);
-            lwork = INT_C(work[0]);
-            work.resize(SIZE_T_C(lwork));
-            sorgqr_(&m, &n, &n, Atmp.data().data(), &lda, tau.data(), work.data(), &lwork, &info);
-        }
+            strtrs_(&uplo, &notrans, &diag, &n, &nrhs, a, &lda, C.data().data(), &ldb, &info);
         else if constexpr (std::is_same_v<T, double>)
-        {
-            lwork = -1;
-            dorgqr_(&m, &n, &n, Atmp.data().data(), &lda, tau.data(), work.data(), &lwork, &info);
-            lwork = INT_C(work[0]);
-            work.resize(SIZE_T_C(lwork));
-            dorgqr_(&m, &n, &n, Atmp.data().data(), &lda, tau.data(), work.data(), &lwork, &info);
-        }
+            dtrtrs_(&uplo, &notrans, &diag, &n, &nrhs, a, &lda, C.data().data(), &ldb, &info);
         else if constexpr (std::is_same_v<T, std::complex<float>>)
-        {
-            lwork = -1;
-            cungqr_(&m, &n, &n, FLOAT_P_R(Atmp.data().data()), &lda, FLOAT_P_R(tau.data()), FLOAT_P_R(work.data()),
-                    &lwork, &info);
-            lwork = INT_C(work[0].real());
-            work.resize(SIZE_T_C(lwork));
-            cungqr_(&m, &n, &n, FLOAT_P_R(Atmp.data().data()), &lda, FLOAT_P_R(tau.data()), FLOAT_P_R(work.data()),
-                    &lwork, &info);
-        }
+            ctrtrs_(&uplo, &notrans, &diag, &n, &nrhs, FLOAT_P_R(a), &lda, FLOAT_P_R(C.data().data()), &ldb, &info);
         else if constexpr (std::is_same_v<T, std::complex<double>>)
-        {
-            lwork = -1;
-            zungqr_(&m, &n, &n, DOUBLE_P_R(Atmp.data().data()), &lda, DOUBLE_P_R(tau.data()), DOUBLE_P_R(work.data()),
-                    &lwork, &info);
-            lwork = INT_C(work[0].real());
-            work.resize(SIZE_T_C(lwork));
-            zungqr_(&m, &n, &n, DOUBLE_P_R(Atmp.data().data()), &lda, DOUBLE_P_R(tau.data()), DOUBLE_P_R(work.data()),
-                    &lwork, &info);
-        }
-        else { throw std::runtime_error("MatQR: type not supported"); }
-        if (info < 0) throw std::runtime_error("MatQR: illegal value");
-        else if (info > 0) throw std::runtime_error("MatQR: matrix is not full rank");
-        for (size_t i = 0; i < Q.GetRowsNb(); ++i)
-            for (size_t j = 0; j < Q.GetRowsNb(); ++j) Q(i, j) = Atmp(i, j);
-        return Q;
+            ztrtrs_(&uplo, &notrans, &diag, &n, &nrhs, DOUBLE_P_R(a), &lda, DOUBLE_P_R(C.data().data()), &ldb, &info);
+        if (info < 0) throw std::runtime_error("MatQRSolve: illegal value");
+        else if (info > 0) throw std::runtime_error("MatQRSolve: matrix is not full rank");
+        for (size_t j = 0; j < SIZE_T_C(nrhs); ++j)
+            for (size_t i = 0; i < SIZE_T_C(n); ++i) X(i, j) = C(i, j);
+        return X;
     }
 } // namespace la
 
@@ -130,7 +180,18 @@ namespace la
 // Explicit template instantiation
 #define INSTANTIATE_QR_TEMPLATE(type)                                                                                  \
     template la::Matrix<type>& la::MatQR(la::Matrix<type>& Q, la::Matrix<type>& R, const la::Matrix<type>& A,          \
-                                         const int& flags);
+                                         const int& flags);                                                            \
+    template la::Matrix<type>& la::MatQR(la::Matrix<type>& Q, la::Matrix<type>& R, la::Matrix<type>&& A,               \
+                                         const int& flags);                                                            \
+    template la::Matrix<type>& la::MatQRExpand(la::Matrix<type>& Q, la::Matrix<type>& R, const la::Matrix<type>& QR,   \
+                                               const std::vector<type>& tau);                                          \
+    template la::Matrix<type>& la::MatQRFactor(la::Matrix<type>& QR, std::vector<type>& tau,                           \
+                                               const la::Matrix<type>& A, const int& flags);                           \
+    template la::Matrix<type>& la::MatQRFactor(la::Matrix<type>& QR, std::vector<type>& tau, la::Matrix<type>&& A,     \
+                                               const int& flags);                                                      \
+    template la::Matrix<type>& la::MatQRSolve(la::Matrix<type>& X, const la::Matrix<type>& QR,                         \
+                                              const std::vector<type>& tau, const la::Matrix<type>& B,                 \
+                                              const int& flags);
 
 #define INSTANTIATE_ALL_QR_TEMPLATES                                                                                   \
     INSTANTIATE_QR_TEMPLATE(float)                                                                                     \
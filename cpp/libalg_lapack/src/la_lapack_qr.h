@@ -11,7 +11,11 @@
 #error "USE_LAPACK is not defined"
 #endif
 
+#include <stdexcept>
+#include <utility>
+#include <vector>
 #include "la_blas_mult.h"
+#include "la_owned_matrix.h"
 #include "math/algebra/matrix.h"
 #include "math/algebra/matrix_operations.h"
 
@@ -36,6 +40,30 @@ namespace la
     // The columns of Q are normalized
     template <typename T> Matrix<T>& MatQR(Matrix<T>& Q, Matrix<T>& R, const Matrix<T>& A, const int& flags = 0);
 
+    // In-place version, the Householder vectors overwrite A instead of a copy of it (pass std::move(A)).
+    // A is left empty on exit.
+    template <typename T> Matrix<T>& MatQR(Matrix<T>& Q, Matrix<T>& R, Matrix<T>&& A, const int& flags = 0);
+
+    // Compute the QR factorization of a M-by-N matrix A in the packed form of ?geqrf.
+    // R is stored on and above the diagonal of QR, the Householder vectors below it together with tau.
+    // The packed factors can be reused to solve any number of least squares problems with MatQRSolve.
+    template <typename T>
+    Matrix<T>& MatQRFactor(Matrix<T>& QR, std::vector<T>& tau, const Matrix<T>& A, const int& flags = 0);
+
+    // In-place version, QR takes over the buffer of A (pass std::move(A)) and no copy is made
+    template <typename T>
+    Matrix<T>& MatQRFactor(Matrix<T>& QR, std::vector<T>& tau, Matrix<T>&& A, const int& flags = 0);
+
+    // Explicit factors Q (M-by-M) and R (M-by-N) from the packed form computed by MatQRFactor
+    template <typename T>
+    Matrix<T>& MatQRExpand(Matrix<T>& Q, Matrix<T>& R, const Matrix<T>& QR, const std::vector<T>& tau);
+
+    // Least squares solution of min ||A * X - B|| from the packed factors, X = R^-1 * Q^H * B (?ormqr and ?trtrs)
+    // A must have full column rank and m >= n, B is m x nrhs and X is n x nrhs
+    template <typename T>
+    Matrix<T>& MatQRSolve(Matrix<T>& X, const Matrix<T>& QR, const std::vector<T>& tau, const Matrix<T>& B,
+                          const int& flags = 0);
+
     template <typename T> Matrix<T> MatQR(Matrix<T>& R, const Matrix<T>& A, const int& flags)
     {
         Matrix<T> Q{A.GetRowsNb(), A.GetRowsNb()};
@@ -55,20 +83,37 @@ namespace la
     {
       public:
         inline MatrixQR(const Matrix<T>& M)
-            : A_(M), Q_(M.GetRowsNb(), M.GetRowsNb()), R_(M.GetRowsNb(), M.GetColsNb()), C_(0, 0), flags_(0)
+            : A_(M), Q_(M.GetRowsNb(), M.GetRowsNb()), R_(M.GetRowsNb(), M.GetColsNb()), C_(0, 0), QR_(0, 0),
+              flags_(0), owner_(false)
         {
         }
 
-        inline const Matrix<T>& A() const { return A_; }
+        // owning mode, the matrix is moved in without a copy (pass std::move(M) or a temporary).
+        // Compute factorizes it in place into the packed factors, A() then only keeps the dimensions.
+        inline MatrixQR(Matrix<T>&& M)
+            : A_(std::move(M)), Q_(A_->GetRowsNb(), A_->GetRowsNb()), R_(A_->GetRowsNb(), A_->GetColsNb()), C_(0, 0),
+              QR_(0, 0), flags_(0), owner_(true)
+        {
+        }
+
+        inline const Matrix<T>& A() const { return *A_; }
 
         inline const Matrix<T>& Q() const { return Q_; }
 
         inline const Matrix<T>& R() const { return R_; }
 
+        // the packed factors are kept so that QR, tau and Solve do not factorize A again
         inline void Compute(const int& flags = 0)
         {
             flags_ = flags;
-            MatQR(Q_, R_, A_, flags_);
+            C_     = Matrix<T>(0, 0);
+            if (owner_)
+            {
+                if (A_.Own().data().empty()) throw std::runtime_error("MatrixQR: matrix already factorized in place");
+                MatQRFactor(QR_, tau_, std::move(A_.Own()), flags_);
+            }
+            else MatQRFactor(QR_, tau_, *A_, flags_);
+            MatQRExpand(Q_, R_, QR_, tau_);
         }
 
         inline const Matrix<T>& C()
@@ -81,12 +126,41 @@ namespace la
             return C_;
         }
 
+        // packed factors used by Solve, kept by Compute or computed on the first call and reused afterwards
+        inline const Matrix<T>& QR()
+        {
+            if (QR_.size() == 0) MatQRFactor(QR_, tau_, *A_, flags_);
+            return QR_;
+        }
+
+        inline const std::vector<T>& tau()
+        {
+            QR();
+            return tau_;
+        }
+
+        // least squares solution of min ||A * X - B||, see MatQRSolve
+        inline Matrix<T>& Solve(Matrix<T>& X, const Matrix<T>& B)
+        {
+            QR();
+            return MatQRSolve(X, QR_, tau_, B, flags_);
+        }
+
+        inline Matrix<T> Solve(const Matrix<T>& B)
+        {
+            Matrix<T> X{R_.GetColsNb(), B.GetColsNb()};
+            return Solve(X, B);
+        }
+
       private:
-        const Matrix<T>& A_;
+        OwnedMatrix<T> A_;
         Matrix<T> Q_;
         Matrix<T> R_;
         Matrix<T> C_;
+        Matrix<T> QR_;
+        std::vector<T> tau_;
         int flags_;
+        bool owner_;
     };
 } // namespace la
 
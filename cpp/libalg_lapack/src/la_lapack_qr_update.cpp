@@ -0,0 +1,291 @@
+/***************************/
+/* la_lapack_qr_update.cpp */
+/*    Version 1.0          */
+/*     2026/10/19          */
+/***************************/
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <complex>
+#include <type_traits>
+#include <typeinfo>
+#include <vector>
+#include "la_blas_mult.h"
+#include "la_lapack_macro.h"
+#include "la_lapack_qr_update.h"
+#include "lapack_interface.h"
+
+#define INT_C(x)      static_cast<int>(x)
+#define SIZE_T_C(x)   static_cast<size_t>(x)
+#define FLOAT_P_R(x)  reinterpret_cast<float*>(x)
+#define DOUBLE_P_R(x) reinterpret_cast<double*>(x)
+
+namespace la
+{
+    namespace
+    {
+        template <typename T> inline T GivensConj(const T& z)
+        {
+            if constexpr (std::is_same_v<T, float> || std::is_same_v<T, double>) return z;
+            else return std::conj(z);
+        }
+
+        // rotation G = [c s; -conj(s) c] with G * [a; b] = [r; 0], c is real
+        template <typename T> inline void Givens(RealTypeOf<T>& c, T& s, const T& a, const T& b)
+        {
+            using R_ = RealTypeOf<T>;
+            const R_ absa = std::abs(a), absb = std::abs(b);
+            if (absb == R_(0))
+            {
+                c = R_(1);
+                s = T(0);
+            }
+            else if (absa == R_(0))
+            {
+                c = R_(0);
+                s = GivensConj(b) / absb;
+            }
+            else
+            {
+                const R_ r = std::hypot(absa, absb);
+                c          = absa / r;
+                s          = (a / absa) * GivensConj(b) / r;
+            }
+        }
+
+        // rows i and j of R from column c0 are replaced by G * [R(i, :); R(j, :)]
+        template <typename T>
+        inline void RotateRows(Matrix<T>& R, const size_t i, const size_t j, const size_t c0, const RealTypeOf<T>& c,
+                               const T& s)
+        {
+            for (size_t k = c0; k < R.GetColsNb(); ++k)
+            {
+                const T x = R(i, k), y = R(j, k);
+                R(i, k)   = c * x + s * y;
+                R(j, k)   = c * y - GivensConj(s) * x;
+            }
+        }
+
+        // columns i and j of Q are replaced by [Q(:, i) Q(:, j)] * G^H so that Q * R is unchanged
+        template <typename T>
+        inline void RotateCols(Matrix<T>& Q, const size_t i, const size_t j, const RealTypeOf<T>& c, const T& s)
+        {
+            const size_t m = Q.GetRowsNb();
+            T* qi          = Q.data().data() + i * m;
+            T* qj          = Q.data().data() + j * m;
+            for (size_t k = 0; k < m; ++k)
+            {
+                const T x = qi[k], y = qj[k];
+                qi[k]     = c * x + GivensConj(s) * y;
+                qj[k]     = c * y - s * x;
+            }
+        }
+
+        // reduce the upper Hessenberg columns c0, c0 + 1, ... of R to triangular form
+        template <typename T> void QRRetriangulate(Matrix<T>& Q, Matrix<T>& R, const size_t c0)
+        {
+            const size_t m = R.GetRowsNb(), n = R.GetColsNb();
+            for (size_t j = c0; j < n && j + 1 < m; ++j)
+            {
+                RealTypeOf<T> c;
+                T s;
+                Givens(c, s, R(j, j), R(j + 1, j));
+                RotateRows(R, j, j + 1, j, c, s);
+                R(j + 1, j) = T(0);
+                RotateCols(Q, j, j + 1, c, s);
+            }
+        }
+
+        // w = Q^H * x
+        template <typename T> std::vector<T> QRApplyQH(const Matrix<T>& Q, const Matrix<T>& x)
+        {
+            const size_t m = Q.GetRowsNb();
+            std::vector<T> w(m);
+            Gemm('C', 'N', m, 1, m, T(1), Q.data().data(), m, x.data().data(), m, T(0), w.data(), m);
+            return w;
+        }
+    } // namespace
+
+    template <typename T>
+    Matrix<T>& MatQRInsertRow(Matrix<T>& Q, Matrix<T>& R, const Matrix<T>& row, const size_t& k)
+    {
+        const size_t m = R.GetRowsNb(), n = R.GetColsNb();
+        assert(Q.GetRowsNb() == m && Q.GetColsNb() == m);
+        assert(row.size() == n);
+        if (k > m) throw std::runtime_error("MatQRInsertRow: row index out of range");
+        // [row; A] = diag(1, Q) * [row; R], the first row of Q1 is then moved to position k
+        Matrix<T> Q1{m + 1, m + 1}, R1{m + 1, n};
+        for (size_t j = 0; j < n; ++j)
+        {
+            R1(0, j) = row.data()[j];
+            for (size_t i = 0; i < m; ++i) R1(i + 1, j) = R(i, j);
+        }
+        Q1(k, 0) = T(1);
+        for (size_t j = 0; j < m; ++j)
+            for (size_t i = 0; i < m; ++i) Q1(i < k ? i : i + 1, j + 1) = Q(i, j);
+        // R1 is upper Hessenberg
+        QRRetriangulate(Q1, R1, 0);
+        Q = std::move(Q1);
+        R = std::move(R1);
+        return R;
+    }
+
+    template <typename T> Matrix<T>& MatQRDeleteRow(Matrix<T>& Q, Matrix<T>& R, const size_t& k)
+    {
+        const size_t m = R.GetRowsNb(), n = R.GetColsNb();
+        assert(Q.GetRowsNb() == m && Q.GetColsNb() == m);
+        if (k >= m) throw std::runtime_error("MatQRDeleteRow: row index out of range");
+        // rotate q = Q^H * e_k to a multiple of e_1 from the bottom, R becomes upper Hessenberg
+        std::vector<T> q(m);
+        for (size_t j = 0; j < m; ++j) q[j] = GivensConj(Q(k, j));
+        for (size_t i = m - 1; i > 0; --i)
+        {
+            RealTypeOf<T> c;
+            T s;
+            Givens(c, s, q[i - 1], q[i]);
+            q[i - 1] = c * q[i - 1] + s * q[i];
+            q[i]     = T(0);
+            RotateRows(R, i - 1, i, i - 1 < n ? i - 1 : n, c, s);
+            RotateCols(Q, i - 1, i, c, s);
+        }
+        // the first column of Q is now a multiple of e_k, dropping it with row k leaves a unitary Q
+        Matrix<T> Q1{m - 1, m - 1}, R1{m - 1, n};
+        for (size_t j = 1; j < m; ++j)
+            for (size_t i = 0; i < m; ++i)
+                if (i != k) Q1(i < k ? i : i - 1, j - 1) = Q(i, j);
+        for (size_t j = 0; j < n; ++j)
+            for (size_t i = 1; i < m; ++i) R1(i - 1, j) = R(i, j);
+        Q = std::move(Q1);
+        R = std::move(R1);
+        return R;
+    }
+
+    template <typename T>
+    Matrix<T>& MatQRInsertCol(Matrix<T>& Q, Matrix<T>& R, const Matrix<T>& col, const size_t& k)
+    {
+        const size_t m = R.GetRowsNb(), n = R.GetColsNb();
+        assert(Q.GetRowsNb() == m && Q.GetColsNb() == m);
+        assert(col.size() == m);
+        if (k > n) throw std::runtime_error("MatQRInsertCol: column index out of range");
+        // R1 = [R(:, 0:k) Q^H * col R(:, k:n)]
+        std::vector<T> w = QRApplyQH(Q, col);
+        Matrix<T> R1{m, n + 1};
+        std::copy_n(R.data().begin(), m * k, R1.data().begin());
+        std::copy(w.begin(), w.end(), R1.data().begin() + static_cast<std::ptrdiff_t>(m * k));
+        std::copy(R.data().begin() + static_cast<std::ptrdiff_t>(m * k), R.data().end(),
+                  R1.data().begin() + static_cast<std::ptrdiff_t>(m * (k + 1)));
+        // zero the new column below the diagonal from the bottom
+        for (size_t i = m; i > k + 1; --i)
+        {
+            RealTypeOf<T> c;
+            T s;
+            Givens(c, s, R1(i - 2, k), R1(i - 1, k));
+            RotateRows(R1, i - 2, i - 1, k, c, s);
+            R1(i - 1, k) = T(0);
+            RotateCols(Q, i - 2, i - 1, c, s);
+        }
+        R = std::move(R1);
+        return R;
+    }
+
+    template <typename T> Matrix<T>& MatQRDeleteCol(Matrix<T>& Q, Matrix<T>& R, const size_t& k)
+    {
+        const size_t m = R.GetRowsNb(), n = R.GetColsNb();
+        assert(Q.GetRowsNb() == m && Q.GetColsNb() == m);
+        if (k >= n) throw std::runtime_error("MatQRDeleteCol: column index out of range");
+        Matrix<T> R1{m, n - 1};
+        std::copy_n(R.data().begin(), m * k, R1.data().begin());
+        std::copy(R.data().begin() + static_cast<std::ptrdiff_t>(m * (k + 1)), R.data().end(),
+                  R1.data().begin() + static_cast<std::ptrdiff_t>(m * k));
+        // the columns from k are upper Hessenberg
+        QRRetriangulate(Q, R1, k);
+        R = std::move(R1);
+        return R;
+    }
+
+    template <typename T>
+    Matrix<T>& MatQRRank1Update(Matrix<T>& Q, Matrix<T>& R, const Matrix<T>& u, const Matrix<T>& v)
+    {
+        const size_t m = R.GetRowsNb(), n = R.GetColsNb();
+        assert(Q.GetRowsNb() == m && Q.GetColsNb() == m);
+        assert(u.size() == m);
+        assert(v.size() == n);
+        if (m == 0) return R;
+        // A + u * v^H = Q * (R + w * v^H) with w = Q^H * u, w is rotated to a multiple of e_1 from the bottom
+        std::vector<T> w = QRApplyQH(Q, u);
+        for (size_t i = m - 1; i > 0; --i)
+        {
+            RealTypeOf<T> c;
+            T s;
+            Givens(c, s, w[i - 1], w[i]);
+            w[i - 1] = c * w[i - 1] + s * w[i];
+            w[i]     = T(0);
+            RotateRows(R, i - 1, i, i - 1 < n ? i - 1 : n, c, s);
+            RotateCols(Q, i - 1, i, c, s);
+        }
+        // R + w_0 * e_1 * v^H is upper Hessenberg
+        for (size_t j = 0; j < n; ++j) R(0, j) += w[0] * GivensConj(v.data()[j]);
+        QRRetriangulate(Q, R, 0);
+        return R;
+    }
+
+    template <typename T>
+    Matrix<T>& MatQRSolveExplicit(Matrix<T>& X, const Matrix<T>& Q, const Matrix<T>& R, const Matrix<T>& B)
+    {
+        const size_t m = R.GetRowsNb(), n = R.GetColsNb(), nrhs = B.GetColsNb();
+        assert(m >= n);
+        assert(Q.GetRowsNb() == m && Q.GetColsNb() == m);
+        assert(B.GetRowsNb() == m);
+        assert(X.GetRowsNb() == n && X.GetColsNb() == nrhs);
+        if (m < n) throw std::runtime_error("MatQRSolveExplicit: underdetermined system");
+        // X = Q(:, 0:n)^H * B, then R(0:n, 0:n) * X = X in place
+        Gemm('C', 'N', n, nrhs, m, T(1), Q.data().data(), m, B.data().data(), m, T(0), X.data().data(), n);
+        char uplo = 'U', notrans = 'N', diag = 'N';
+        int n_ = INT_C(n), nrhs_ = INT_C(nrhs), lda = std::max(INT_C(m), 1), ldb = std::max(n_, 1), info = 0;
+        // trtrs does not modify the triangular matrix
+        T* a = const_cast<T*>(R.data().data());
+        T* b = X.data().data();
+        if constexpr (std::is_same_v<T, float>) strtrs_(&uplo, &notrans, &diag, &n_, &nrhs_, a, &lda, b, &ldb, &info);
+        else if constexpr (std::is_same_v<T, double>)
+            dtrtrs_(&uplo, &notrans, &diag, &n_, &nrhs_, a, &lda, b, &ldb, &info);
+        else if constexpr (std::is_same_v<T, std::complex<float>>)
+            ctrtrs_(&uplo, &notrans, &diag, &n_, &nrhs_, FLOAT_P_R(a), &lda, FLOAT_P_R(b), &ldb, &info);
+        else if constexpr (std::is_same_v<T, std::complex<double>>)
+            ztrtrs_(&uplo, &notrans, &diag, &n_, &nrhs_, DOUBLE_P_R(a), &lda, DOUBLE_P_R(b), &ldb, &info);
+        else throw std::runtime_error("MatQRSolveExplicit: unsupported type");
+        if (info < 0) throw std::runtime_error("MatQRSolveExplicit: illegal value");
+        else if (info > 0) throw std::runtime_error("MatQRSolveExplicit: matrix is not full rank");
+        return X;
+    }
+
+} // namespace la
+
+#undef DOUBLE_P_R
+#undef FLOAT_P_R
+#undef INT_C
+#undef SIZE_T_C
+
+// Explicit template instantiation
+#define INSTANTIATE_QR_UPDATE_TEMPLATE(type)                                                                           \
+    template la::Matrix<type>& la::MatQRInsertRow(la::Matrix<type>& Q, la::Matrix<type>& R,                            \
+                                                  const la::Matrix<type>& row, const size_t& k);                       \
+    template la::Matrix<type>& la::MatQRDeleteRow(la::Matrix<type>& Q, la::Matrix<type>& R, const size_t& k);          \
+    template la::Matrix<type>& la::MatQRInsertCol(la::Matrix<type>& Q, la::Matrix<type>& R,                            \
+                                                  const la::Matrix<type>& col, const size_t& k);                       \
+    template la::Matrix<type>& la::MatQRDeleteCol(la::Matrix<type>& Q, la::Matrix<type>& R, const size_t& k);          \
+    template la::Matrix<type>& la::MatQRRank1Update(la::Matrix<type>& Q, la::Matrix<type>& R,                          \
+                                                    const la::Matrix<type>& u, const la::Matrix<type>& v);             \
+    template la::Matrix<type>& la::MatQRSolveExplicit(la::Matrix<type>& X, const la::Matrix<type>& Q,                  \
+                                                      const la::Matrix<type>& R, const la::Matrix<type>& B);
+
+#define INSTANTIATE_ALL_QR_UPDATE_TEMPLATES                                                                            \
+    INSTANTIATE_QR_UPDATE_TEMPLATE(float)                                                                              \
+    INSTANTIATE_QR_UPDATE_TEMPLATE(double)                                                                             \
+    INSTANTIATE_QR_UPDATE_TEMPLATE(std::complex<float>)                                                                \
+    INSTANTIATE_QR_UPDATE_TEMPLATE(std::complex<double>)
+
+INSTANTIATE_ALL_QR_UPDATE_TEMPLATES
+
+#undef INSTANTIATE_QR_UPDATE_TEMPLATE
+#undef INSTANTIATE_ALL_QR_UPDATE_TEMPLATES
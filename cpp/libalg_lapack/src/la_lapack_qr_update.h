@@ -0,0 +1,134 @@
+#ifndef _LA_LAPACK_QR_UPDATE_H_CB13DE91C3864603BBC1B69E21A9EDCF_
+#define _LA_LAPACK_QR_UPDATE_H_CB13DE91C3864603BBC1B69E21A9EDCF_
+
+/**************************/
+/* la_lapack_qr_update.h  */
+/*    Version 1.0         */
+/*     2026/10/19         */
+/**************************/
+
+#ifndef USE_LAPACK
+#error "USE_LAPACK is not defined"
+#endif
+
+#include <cassert>
+#include "la_blas_mult.h"
+#include "la_lapack_qr.h"
+#include "math/algebra/matrix.h"
+#include "math/algebra/matrix_operations.h"
+
+namespace la
+{
+    // Updates of the full QR factorization A = Q * R (Q is m x m unitary, R is m x n upper trapezoidal) with Givens
+    // rotations, the factors are modified in place instead of being recomputed with MatQR.
+    // A row update costs O(m^2 + m * n), Q grows or shrinks by one row and one column.
+
+    // factors of A with row (n elements) inserted before row k, k = m appends it
+    template <typename T>
+    Matrix<T>& MatQRInsertRow(Matrix<T>& Q, Matrix<T>& R, const Matrix<T>& row, const size_t& k);
+
+    // factors of A with row k removed
+    template <typename T> Matrix<T>& MatQRDeleteRow(Matrix<T>& Q, Matrix<T>& R, const size_t& k);
+
+    // factors of A with col (m elements) inserted before column k, k = n appends it
+    template <typename T>
+    Matrix<T>& MatQRInsertCol(Matrix<T>& Q, Matrix<T>& R, const Matrix<T>& col, const size_t& k);
+
+    // factors of A with column k removed
+    template <typename T> Matrix<T>& MatQRDeleteCol(Matrix<T>& Q, Matrix<T>& R, const size_t& k);
+
+    // factors of the rank-1 modification A + u * v^H, u has m elements and v has n elements
+    template <typename T>
+    Matrix<T>& MatQRRank1Update(Matrix<T>& Q, Matrix<T>& R, const Matrix<T>& u, const Matrix<T>& v);
+
+    // Least squares solution of min ||A * X - B|| from the explicit factors, X = R(0:n, 0:n)^-1 * Q(:, 0:n)^H * B
+    // A must have full column rank and m >= n, B is m x nrhs and X is n x nrhs
+    template <typename T>
+    Matrix<T>& MatQRSolveExplicit(Matrix<T>& X, const Matrix<T>& Q, const Matrix<T>& R, const Matrix<T>& B);
+
+    template <typename T> class MatrixQRUpdate
+    {
+      public:
+        // factorize M with MatQR
+        inline MatrixQRUpdate(const Matrix<T>& M)
+            : Q_(M.GetRowsNb(), M.GetRowsNb()), R_(M.GetRowsNb(), M.GetColsNb()), C_(0, 0)
+        {
+            MatQR(Q_, R_, M);
+        }
+
+        // start from the factors of a computed MatrixQR
+        inline MatrixQRUpdate(const MatrixQR<T>& qr) : Q_(qr.Q()), R_(qr.R()), C_(0, 0) {}
+
+        inline const Matrix<T>& Q() const { return Q_; }
+
+        inline const Matrix<T>& R() const { return R_; }
+
+        // dimensions of the current matrix
+        inline size_t GetRowsNb() const { return R_.GetRowsNb(); }
+
+        inline size_t GetColsNb() const { return R_.GetColsNb(); }
+
+        // current matrix Q * R
+        inline const Matrix<T>& C()
+        {
+            if (C_.size() == 0)
+            {
+                C_ = Matrix<T>(Q_.GetRowsNb(), R_.GetColsNb());
+                MatMult(C_, Q_, R_);
+            }
+            return C_;
+        }
+
+        inline void InsertRow(const Matrix<T>& row, const size_t& k)
+        {
+            C_ = Matrix<T>(0, 0);
+            MatQRInsertRow(Q_, R_, row, k);
+        }
+
+        inline void AppendRow(const Matrix<T>& row) { InsertRow(row, R_.GetRowsNb()); }
+
+        inline void DeleteRow(const size_t& k)
+        {
+            C_ = Matrix<T>(0, 0);
+            MatQRDeleteRow(Q_, R_, k);
+        }
+
+        inline void InsertCol(const Matrix<T>& col, const size_t& k)
+        {
+            C_ = Matrix<T>(0, 0);
+            MatQRInsertCol(Q_, R_, col, k);
+        }
+
+        inline void AppendCol(const Matrix<T>& col) { InsertCol(col, R_.GetColsNb()); }
+
+        inline void DeleteCol(const size_t& k)
+        {
+            C_ = Matrix<T>(0, 0);
+            MatQRDeleteCol(Q_, R_, k);
+        }
+
+        // A + u * v^H
+        inline void Update(const Matrix<T>& u, const Matrix<T>& v)
+        {
+            C_ = Matrix<T>(0, 0);
+            MatQRRank1Update(Q_, R_, u, v);
+        }
+
+        // least squares solution of min ||A * X - B|| for the current matrix, see MatQRSolveExplicit
+        inline Matrix<T>& Solve(Matrix<T>& X, const Matrix<T>& B) const { return MatQRSolveExplicit(X, Q_, R_, B); }
+
+        inline Matrix<T> Solve(const Matrix<T>& B) const
+        {
+            Matrix<T> X{R_.GetColsNb(), B.GetColsNb()};
+            return Solve(X, B);
+        }
+
+      private:
+        Matrix<T> Q_;
+        Matrix<T> R_;
+        Matrix<T> C_;
+    };
+
+} // namespace la
+
+#endif
@@ -0,0 +1,168 @@
+/************************/
+/*  la_lapack_rsvd.cpp  */
+/*    Version 1.0       */
+/*     2026/10/19       */
+/************************/
+
+#include <algorithm>
+#include <cassert>
+#include <complex>
+#include <random>
+#include <type_traits>
+#include <typeinfo>
+#include <utility>
+#include <vector>
+#include "la_blas_mult.h"
+#include "la_lapack_macro.h"
+#include "la_lapack_rsvd.h"
+#include "la_lapack_svd.h"
+#include "la_thread_pool.h"
+#include "lapack_interface.h"
+
+#define INT_C(x)      static_cast<int>(x)
+#define SIZE_T_C(x)   static_cast<size_t>(x)
+#define FLOAT_P_R(x)  reinterpret_cast<float*>(x)
+#define DOUBLE_P_R(x) reinterpret_cast<double*>(x)
+
+namespace la
+{
+    namespace
+    {
+        template <typename T> void RsvdGeqrf(int m, int n, T* a, T* tau, T* work, int lwork, int& info)
+        {
+            int lda = m;
+            if constexpr (std::is_same_v<T, float>) sgeqrf_(&m, &n, a, &lda, tau, work, &lwork, &info);
+            else if constexpr (std::is_same_v<T, double>) dgeqrf_(&m, &n, a, &lda, tau, work, &lwork, &info);
+            else if constexpr (std::is_same_v<T, std::complex<float>>)
+                cgeqrf_(&m, &n, FLOAT_P_R(a), &lda, FLOAT_P_R(tau), FLOAT_P_R(work), &lwork, &info);
+            else if constexpr (std::is_same_v<T, std::complex<double>>)
+                zgeqrf_(&m, &n, DOUBLE_P_R(a), &lda, DOUBLE_P_R(tau), DOUBLE_P_R(work), &lwork, &info);
+            else throw std::runtime_error("MatSVDRandomized: unsupported type");
+        }
+
+        template <typename T> void RsvdOrgqr(int m, int n, T* a, T* tau, T* work, int lwork, int& info)
+        {
+            int lda = m, k = n;
+            if constexpr (std::is_same_v<T, float>) sorgqr_(&m, &n, &k, a, &lda, tau, work, &lwork, &info);
+            else if constexpr (std::is_same_v<T, double>) dorgqr_(&m, &n, &k, a, &lda, tau, work, &lwork, &info);
+            else if constexpr (std::is_same_v<T, std::complex<float>>)
+                cungqr_(&m, &n, &k, FLOAT_P_R(a), &lda, FLOAT_P_R(tau), FLOAT_P_R(work), &lwork, &info);
+            else if constexpr (std::is_same_v<T, std::complex<double>>)
+                zungqr_(&m, &n, &k, DOUBLE_P_R(a), &lda, DOUBLE_P_R(tau), DOUBLE_P_R(work), &lwork, &info);
+            else throw std::runtime_error("MatSVDRandomized: unsupported type");
+        }
+
+        // replace the columns of Y (m x l, m >= l) by an orthonormal basis of their span (thin QR)
+        template <typename T> void RsvdOrthonormalize(Matrix<T>& Y)
+        {
+            int m = INT_C(Y.GetRowsNb()), l = INT_C(Y.GetColsNb()), lwork = -1, info = 0;
+            std::vector<T> tau(Y.GetColsNb()), work(1);
+            RsvdGeqrf(m, l, Y.data().data(), tau.data(), work.data(), lwork, info);
+            lwork = INT_C(std::real(work[0]));
+            RsvdOrgqr(m, l, Y.data().data(), tau.data(), work.data(), -1, info);
+            lwork = std::max(lwork, INT_C(std::real(work[0])));
+            work.resize(SIZE_T_C(lwork));
+            RsvdGeqrf(m, l, Y.data().data(), tau.data(), work.data(), lwork, info);
+            if (info < 0) throw std::runtime_error("MatSVDRandomized: illegal value");
+            RsvdOrgqr(m, l, Y.data().data(), tau.data(), work.data(), lwork, info);
+            if (info < 0) throw std::runtime_error("MatSVDRandomized: illegal value");
+        }
+
+        // Y = A * X, the rows of A are split among the threads
+        template <typename T> void RsvdMultA(Matrix<T>& Y, const Matrix<T>& A, const Matrix<T>& X)
+        {
+            const size_t m = A.GetRowsNb(), n = A.GetColsNb(), l = X.GetColsNb();
+            ParallelFor(0, m, [&](const size_t first, const size_t last, const size_t) {
+                Gemm('N', 'N', last - first, l, n, T(1), A.data().data() + first, m, X.data().data(), n, T(0),
+                     Y.data().data() + first, m);
+            });
+        }
+
+        // Z = A^H * Y, the columns of A are split among the threads
+        template <typename T> void RsvdMultAH(Matrix<T>& Z, const Matrix<T>& A, const Matrix<T>& Y)
+        {
+            const size_t m = A.GetRowsNb(), n = A.GetColsNb(), l = Y.GetColsNb();
+            ParallelFor(0, n, [&](const size_t first, const size_t last, const size_t) {
+                Gemm('C', 'N', last - first, l, m, T(1), A.data().data() + first * m, m, Y.data().data(), m, T(0),
+                     Z.data().data() + first, n);
+            });
+        }
+    } // namespace
+
+    template <typename T>
+    Matrix<T>& MatSVDRandomized(Matrix<T>& U, Matrix<T>& S, Matrix<T>& V, const Matrix<T>& A, const size_t& k,
+                                const size_t& nOversampling, const size_t& nPowerIter, const int& flags,
+                                const unsigned int& seed)
+    {
+        REALTYPE_DEFINE
+        const size_t m = A.GetRowsNb(), n = A.GetColsNb(), mn = std::min(m, n);
+        assert(k > 0 && k <= mn);
+        assert(U.GetRowsNb() == m);
+        assert(U.GetColsNb() == k);
+        assert(S.GetRowsNb() == k);
+        assert(S.GetColsNb() == k);
+        assert(V.size() == n * k);
+        const size_t l = std::min(k + nOversampling, mn);
+        // gaussian test matrix
+        Matrix<T> X{n, l};
+        std::mt19937 gen(seed);
+        std::normal_distribution<RealType> dist(0, 1);
+        for (auto& x : X.data())
+        {
+            if constexpr (std::is_same_v<T, float> || std::is_same_v<T, double>) x = dist(gen);
+            else
+            {
+                const RealType re = dist(gen);
+                x                 = T(re, dist(gen));
+            }
+        }
+        // range finder with subspace iterations
+        Matrix<T> Q{m, l};
+        RsvdMultA(Q, A, X);
+        RsvdOrthonormalize(Q);
+        for (size_t i = 0; i < nPowerIter; ++i)
+        {
+            RsvdMultAH(X, A, Q);
+            RsvdOrthonormalize(X);
+            RsvdMultA(Q, A, X);
+            RsvdOrthonormalize(Q);
+        }
+        // Q^H * A = X^H with X = A^H * Q, so the SVD of X (n x l) gives both factors:
+        // X = Ux * Sx * Vx^H  ->  A ~ (Q * Vx) * Sx * Ux^H
+        RsvdMultAH(X, A, Q);
+        Matrix<T> Ux{n, l}, Vx{l, l};
+        std::vector<RealType> sx;
+        MatSVD(Ux, sx, Vx, std::move(X), la::DRIVER::GESDD, la::SVD::THIN);
+        // U = Q * Vx(:, 0:k)
+        Gemm('N', 'N', m, k, l, T(1), Q.data().data(), m, Vx.data().data(), l, T(0), U.data().data(), m);
+        S.Zeros();
+        for (size_t i = 0; i < k; ++i) S(i, i) = sx[i];
+        V.Reshape(n, k);
+        std::copy(Ux.data().begin(), Ux.data().begin() + static_cast<std::ptrdiff_t>(n * k), V.data().begin());
+        if (flags & la::SVD::V_HT) V.Hermitian();
+        return S;
+    }
+
+} // namespace la
+
+#undef DOUBLE_P_R
+#undef FLOAT_P_R
+#undef INT_C
+#undef SIZE_T_C
+
+// Explicit template instantiation
+#define INSTANTIATE_RSVD_TEMPLATE(type)                                                                                \
+    template la::Matrix<type>& la::MatSVDRandomized<type>(la::Matrix<type>&, la::Matrix<type>&, la::Matrix<type>&,     \
+                                                          const la::Matrix<type>&, const size_t&, const size_t&,       \
+                                                          const size_t&, const int&, const unsigned int&);
+
+#define INSTANTIATE_ALL_RSVD_TEMPLATES                                                                                 \
+    INSTANTIATE_RSVD_TEMPLATE(float)                                                                                   \
+    INSTANTIATE_RSVD_TEMPLATE(double)                                                                                  \
+    INSTANTIATE_RSVD_TEMPLATE(std::complex<float>)                                                                     \
+    INSTANTIATE_RSVD_TEMPLATE(std::complex<double>)
+
+INSTANTIATE_ALL_RSVD_TEMPLATES
+
+#undef INSTANTIATE_RSVD_TEMPLATE
+#undef INSTANTIATE_ALL_RSVD_TEMPLATES
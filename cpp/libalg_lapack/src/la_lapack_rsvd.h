@@ -0,0 +1,54 @@
+#ifndef _LA_LAPACK_RSVD_H_A8F6ABE5934040B190A4E30BAF14F428_
+#define _LA_LAPACK_RSVD_H_A8F6ABE5934040B190A4E30BAF14F428_
+
+/************************/
+/*   la_lapack_rsvd.h   */
+/*    Version 1.0       */
+/*     2026/10/19       */
+/************************/
+
+#ifndef USE_LAPACK
+#error "USE_LAPACK is not defined"
+#endif
+
+#include "la_blas_mult.h"
+#include "la_lapack_svd.h"
+#include "math/algebra/matrix.h"
+#include "math/algebra/matrix_operations.h"
+
+namespace la
+{
+    // compute the k largest singular triplets of A with a randomized range finder
+    // A ~ U * S * V'
+    // A is m x n, U is m x k, S is k x k diagonal, V is n x k (k x n with V_HT)
+    // the range of A is sampled with l = k + nOversampling gaussian vectors and refined with nPowerIter
+    // subspace iterations (re-orthonormalized at every step), then the SVD of the small l x n projection is computed.
+    // The products with A are split in row or column blocks among the threads of la::ThreadPool().
+    // seed makes the result reproducible
+    template <typename T>
+    Matrix<T>& MatSVDRandomized(Matrix<T>& U, Matrix<T>& S, Matrix<T>& V, const Matrix<T>& A, const size_t& k,
+                                const size_t& nOversampling = 10, const size_t& nPowerIter = 2, const int& flags = 0,
+                                const unsigned int& seed = 0);
+
+    template <typename T>
+    Matrix<T> MatSVDRandomized(Matrix<T>& S, Matrix<T>& V, const Matrix<T>& A, const size_t& k,
+                               const size_t& nOversampling = 10, const size_t& nPowerIter = 2, const int& flags = 0)
+    {
+        Matrix<T> U{A.GetRowsNb(), k};
+        return MatSVDRandomized(U, S, V, A, k, nOversampling, nPowerIter, flags);
+    }
+
+    template <typename T>
+    Matrix<T> MatSVDRandomized(const Matrix<T>& A, const size_t& k, const size_t& nOversampling = 10,
+                               const size_t& nPowerIter = 2)
+    {
+        Matrix<T> U{A.GetRowsNb(), k};
+        Matrix<T> V{A.GetColsNb(), k};
+        Matrix<T> S{k, k};
+        // return S
+        return MatSVDRandomized(U, S, V, A, k, nOversampling, nPowerIter);
+    }
+
+} // namespace la
+
+#endif
@@ -8,6 +8,7 @@
 #include <complex>
 #include <type_traits>
 #include <typeinfo>
+#include <utility>
 #include "la_lapack_macro.h"
 #include "la_lapack_schur.h"
 #include "lapack_interface.h"
@@ -39,15 +40,15 @@ namespace la
     }
 
     template <typename T>
-    Matrix<T>& MatSchur(Matrix<T>& E, Matrix<T>* pV, Matrix<T>& S, const Matrix<T>& A, const int& flags)
+    Matrix<T>& MatSchur(Matrix<T>& E, Matrix<T>* pV, Matrix<T>& S, Matrix<T>&& A, const int& flags)
     {
         (void)flags;
         assert(E.GetRowsNb() == A.GetRowsNb());
         assert(A.GetRowsNb() == A.GetColsNb());
         REALTYPE_DEFINE
         int n = INT_C(A.GetRowsNb());
-        // Assign A to S so it will contains Schur form
-        S     = A;
+        // Move A to S so it will contains Schur form
+        S     = std::move(A);
         char jobvs, sort = (flags & la::SCHUR::SORT) ? 'S' : 'N';
         T* pVTmp = nullptr;
         if (pV)
@@ -122,6 +123,12 @@ namespace la
         return E;
     }
 
+    template <typename T>
+    Matrix<T>& MatSchur(Matrix<T>& E, Matrix<T>* pV, Matrix<T>& S, const Matrix<T>& A, const int& flags)
+    {
+        return MatSchur(E, pV, S, Matrix<T>(A), flags);
+    }
+
 } // namespace la
 
 #undef DOUBLE_P_R
@@ -131,7 +138,9 @@ namespace la
 
 #define INSTANTIATE_SCHUR_TEMPLATE(type)                                                                               \
     template la::Matrix<type>& la::MatSchur<type>(la::Matrix<type>&, la::Matrix<type>*, la::Matrix<type>&,             \
-                                                  const la::Matrix<type>&, const int&);
+                                                  const la::Matrix<type>&, const int&);                                \
+    template la::Matrix<type>& la::MatSchur<type>(la::Matrix<type>&, la::Matrix<type>*, la::Matrix<type>&,             \
+                                                  la::Matrix<type>&&, const int&);
 
 #define INSTANTIATE_ALL_SCHUR_TEMPLATES                                                                                \
     INSTANTIATE_SCHUR_TEMPLATE(float)                                                                                  \
@@ -11,7 +11,10 @@
 #error "USE_LAPACK is not defined"
 #endif
 
+#include <stdexcept>
+#include <utility>
 #include "la_blas_mult.h"
+#include "la_owned_matrix.h"
 #include "math/algebra/matrix.h"
 #include "math/algebra/matrix_operations.h"
 
@@ -29,6 +32,10 @@ namespace la
     template <typename T>
     Matrix<T>& MatSchur(Matrix<T>& E, Matrix<T>* pV, Matrix<T>& S, const Matrix<T>& A, const int& flags = 0);
 
+    // In-place version, S takes over the buffer of A (pass std::move(A)) and no copy is made
+    template <typename T>
+    Matrix<T>& MatSchur(Matrix<T>& E, Matrix<T>* pV, Matrix<T>& S, Matrix<T>&& A, const int& flags = 0);
+
     template <typename T> Matrix<T>& MatSchur(Matrix<T>& E, Matrix<T>& S, const Matrix<T>& A, const int& flags = 0)
     {
         return MatSchur<T>(E, nullptr, S, A, flags);
@@ -38,21 +45,21 @@ namespace la
     {
       public:
         inline MatrixSchur(const Matrix<T>& A)
-            : A_(A), S_(A.GetRowsNb(), A.GetColsNb()), V_(A.GetRowsNb(), A.GetColsNb()), C_(0, 0), flags_(0)
+            : A_(A), S_(A.GetRowsNb(), A.GetColsNb()), V_(A.GetRowsNb(), A.GetColsNb()), C_(0, 0), flags_(0),
+              owner_(false)
         {
-            if constexpr (std::is_same<T, float>::value || std::is_same<T, double>::value)
-            {
-                E_ = Matrix<T>(A.GetRowsNb(), 2);
-            }
-            else if constexpr (std::is_same<T, std::complex<float>>::value ||
-                               std::is_same<T, std::complex<double>>::value)
-            {
-                E_ = Matrix<T>(A.GetRowsNb(), 1);
-            }
-            else { throw std::invalid_argument("MatrixSchur: invalid type"); }
+            Allocate();
+        }
+
+        // owning mode, the matrix is moved in without a copy (pass std::move(A) or a temporary).
+        // Compute reduces it in place to the Schur form, A() then only keeps the dimensions.
+        inline MatrixSchur(Matrix<T>&& A)
+            : A_(std::move(A)), S_(0, 0), V_(A_->GetRowsNb(), A_->GetColsNb()), C_(0, 0), flags_(0), owner_(true)
+        {
+            Allocate();
         }
 
-        inline const Matrix<T>& A() const { return A_; }
+        inline const Matrix<T>& A() const { return *A_; }
 
         inline const Matrix<T>& E() const { return E_; }
 
@@ -64,7 +71,7 @@ namespace la
         {
             if (C_.size() == 0)
             {
-                C_ = Matrix<T>(A_.GetRowsNb(), A_.GetColsNb());
+                C_ = Matrix<T>(A_->GetRowsNb(), A_->GetColsNb());
                 MatMult(C_, MatMult(V_, S_), MatHermitian(V_));
             }
             return C_;
@@ -79,17 +86,37 @@ namespace la
             flags_        = flags;
             Matrix<T>* pV = nullptr;
             if (flags_ & SCHUR::COMPUTE_V) pV = &V_;
-            MatSchur(E_, pV, S_, A_, flags_);
+            if (owner_)
+            {
+                if (A_.Own().data().empty()) throw std::runtime_error("MatrixSchur: matrix already reduced in place");
+                MatSchur(E_, pV, S_, std::move(A_.Own()), flags_);
+            }
+            else MatSchur(E_, pV, S_, *A_, flags_);
             return E_;
         }
 
       private:
-        const Matrix<T>& A_;
+        inline void Allocate()
+        {
+            if constexpr (std::is_same<T, float>::value || std::is_same<T, double>::value)
+            {
+                E_ = Matrix<T>(A_->GetRowsNb(), 2);
+            }
+            else if constexpr (std::is_same<T, std::complex<float>>::value ||
+                               std::is_same<T, std::complex<double>>::value)
+            {
+                E_ = Matrix<T>(A_->GetRowsNb(), 1);
+            }
+            else { throw std::invalid_argument("MatrixSchur: invalid type"); }
+        }
+
+        OwnedMatrix<T> A_;
         Matrix<T> E_;
         Matrix<T> S_;
         Matrix<T> V_;
         Matrix<T> C_;
         int flags_;
+        bool owner_;
     };
 
 } // namespace la
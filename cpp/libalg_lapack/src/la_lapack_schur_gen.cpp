@@ -0,0 +1,155 @@
+/************************/
+/*la_lapack_schur_gen.cpp*/
+/*    Version 1.0       */
+/*     2026/10/19       */
+/************************/
+
+#include <algorithm>
+#include <cassert>
+#include <complex>
+#include <type_traits>
+#include <utility>
+#include "la_lapack_macro.h"
+#include "la_lapack_schur_gen.h"
+#include "lapack_interface.h"
+
+#define INT_C(x)      static_cast<int>(x)
+#define SIZE_T_C(x)   static_cast<size_t>(x)
+#define FLOAT_P_R(x)  reinterpret_cast<float*>(x)
+#define DOUBLE_P_R(x) reinterpret_cast<double*>(x)
+
+namespace la
+{
+    namespace
+    {
+        // finite eigenvalue (alphar + i * alphai) / beta with a positive real part, beta is non negative
+        template <typename R> int SelectGenRealType(R* alphar, R* alphai, R* beta)
+        {
+            (void)alphai;
+            return *alphar > R(0) && *beta > R(0);
+        }
+
+        // finite eigenvalue alpha / beta with a positive real part, alpha and beta point to complex values
+        template <typename R> int SelectGenComplexType(R* alpha, R* beta)
+        {
+            const std::complex<R> a(alpha[0], alpha[1]), b(beta[0], beta[1]);
+            return std::real(a * std::conj(b)) > R(0);
+        }
+    } // namespace
+
+    template <typename T>
+    int MatGenSchur(Matrix<T>& alpha, Matrix<T>& beta, Matrix<T>* pQ, Matrix<T>* pZ, Matrix<T>& S, Matrix<T>& P,
+                    Matrix<T>&& A, Matrix<T>&& B, const int& flags, LapackWork<T>* pWork)
+    {
+        REALTYPE_DEFINE
+        assert(A.GetRowsNb() == A.GetColsNb());
+        assert(B.GetRowsNb() == A.GetRowsNb() && B.GetColsNb() == A.GetColsNb());
+        assert(alpha.GetRowsNb() == A.GetRowsNb());
+        assert(beta.GetRowsNb() == A.GetRowsNb() && beta.GetColsNb() == 1);
+        int n = INT_C(A.GetRowsNb());
+        // S and P take over the buffers, a self move would release them
+        if (&S != &A) S = std::move(A);
+        if (&P != &B) P = std::move(B);
+        char jobvsl = pQ ? 'V' : 'N', jobvsr = pZ ? 'V' : 'N', sort = (flags & GEN_SCHUR::SORT) ? 'S' : 'N';
+        // ?gges references the Schur vector arrays with ld >= 1 even when they are not computed
+        T dummy[1];
+        T* vsl = dummy;
+        T* vsr = dummy;
+        if (pQ)
+        {
+            assert(pQ->GetRowsNb() == S.GetRowsNb() && pQ->GetColsNb() == S.GetColsNb());
+            vsl = pQ->data().data();
+        }
+        if (pZ)
+        {
+            assert(pZ->GetRowsNb() == S.GetRowsNb() && pZ->GetColsNb() == S.GetColsNb());
+            vsr = pZ->data().data();
+        }
+        int lda = std::max(n, 1), ldb = lda, ldvsl = pQ ? lda : 1, ldvsr = pZ ? lda : 1, sdim = 0, lwork = -1;
+        int info = 0;
+        LapackWork<T> local_;
+        LapackWork<T>& w_ = pWork ? *pWork : local_;
+        if (sort == 'S' && w_.bwork.size() < SIZE_T_C(n)) w_.bwork.resize(SIZE_T_C(n));
+        int* bwork = w_.bwork.empty() ? nullptr : w_.bwork.data();
+        T wkopt;
+        T *a = S.data().data(), *b = P.data().data(), *bt = beta.data().data();
+        if constexpr (std::is_same_v<T, float> || std::is_same_v<T, double>)
+        {
+            assert(alpha.GetColsNb() == 2);
+            int (*select)(T*, T*, T*) = (sort == 'S') ? SelectGenRealType<T> : nullptr;
+            T *ar = &alpha.data()[0], *ai = &alpha.data()[SIZE_T_C(n)];
+            for (int pass = 0; pass < 2; ++pass)
+            {
+                T* work = pass ? w_.work.data() : &wkopt;
+                if constexpr (std::is_same_v<T, float>)
+                    sgges_(&jobvsl, &jobvsr, &sort, select, &n, a, &lda, b, &ldb, &sdim, ar, ai, bt, vsl, &ldvsl, vsr,
+                           &ldvsr, work, &lwork, bwork, &info);
+                else
+                    dgges_(&jobvsl, &jobvsr, &sort, select, &n, a, &lda, b, &ldb, &sdim, ar, ai, bt, vsl, &ldvsl, vsr,
+                           &ldvsr, work, &lwork, bwork, &info);
+                if (info != 0 || pass) break;
+                lwork = std::max(INT_C(wkopt), 1);
+                if (w_.work.size() < SIZE_T_C(lwork)) w_.work.resize(SIZE_T_C(lwork));
+            }
+        }
+        else if constexpr (std::is_same_v<T, std::complex<float>> || std::is_same_v<T, std::complex<double>>)
+        {
+            assert(alpha.GetColsNb() == 1);
+            int (*select)(RealType*, RealType*) = (sort == 'S') ? SelectGenComplexType<RealType> : nullptr;
+            if (w_.rwork.size() < 8 * SIZE_T_C(n)) w_.rwork.resize(8 * SIZE_T_C(n));
+            T* al = alpha.data().data();
+            for (int pass = 0; pass < 2; ++pass)
+            {
+                T* work = pass ? w_.work.data() : &wkopt;
+                if constexpr (std::is_same_v<T, std::complex<float>>)
+                    cgges_(&jobvsl, &jobvsr, &sort, select, &n, FLOAT_P_R(a), &lda, FLOAT_P_R(b), &ldb, &sdim,
+                           FLOAT_P_R(al), FLOAT_P_R(bt), FLOAT_P_R(vsl), &ldvsl, FLOAT_P_R(vsr), &ldvsr,
+                           FLOAT_P_R(work), &lwork, w_.rwork.data(), bwork, &info);
+                else
+                    zgges_(&jobvsl, &jobvsr, &sort, select, &n, DOUBLE_P_R(a), &lda, DOUBLE_P_R(b), &ldb, &sdim,
+                           DOUBLE_P_R(al), DOUBLE_P_R(bt), DOUBLE_P_R(vsl), &ldvsl, DOUBLE_P_R(vsr), &ldvsr,
+                           DOUBLE_P_R(work), &lwork, w_.rwork.data(), bwork, &info);
+                if (info != 0 || pass) break;
+                lwork = std::max(INT_C(wkopt.real()), 1);
+                if (w_.work.size() < SIZE_T_C(lwork)) w_.work.resize(SIZE_T_C(lwork));
+            }
+        }
+        else { throw std::runtime_error("MatGenSchur: unsupported type"); }
+        if (info < 0) throw std::runtime_error("MatGenSchur: illegal value");
+        else if (info > 0 && info <= n + 1) throw std::runtime_error("MatGenSchur: failed to converge");
+        else if (info > n + 1) throw std::runtime_error("MatGenSchur: reordering failed");
+        return sdim;
+    }
+
+    template <typename T>
+    int MatGenSchur(Matrix<T>& alpha, Matrix<T>& beta, Matrix<T>* pQ, Matrix<T>* pZ, Matrix<T>& S, Matrix<T>& P,
+                    const Matrix<T>& A, const Matrix<T>& B, const int& flags, LapackWork<T>* pWork)
+    {
+        return MatGenSchur(alpha, beta, pQ, pZ, S, P, Matrix<T>(A), Matrix<T>(B), flags, pWork);
+    }
+
+} // namespace la
+
+#undef DOUBLE_P_R
+#undef FLOAT_P_R
+#undef INT_C
+#undef SIZE_T_C
+
+#define INSTANTIATE_SCHUR_GEN_TEMPLATE(type)                                                                           \
+    template int la::MatGenSchur<type>(la::Matrix<type>&, la::Matrix<type>&, la::Matrix<type>*, la::Matrix<type>*,     \
+                                       la::Matrix<type>&, la::Matrix<type>&, la::Matrix<type>&&, la::Matrix<type>&&,   \
+                                       const int&, la::LapackWork<type>*);                                             \
+    template int la::MatGenSchur<type>(la::Matrix<type>&, la::Matrix<type>&, la::Matrix<type>*, la::Matrix<type>*,     \
+                                       la::Matrix<type>&, la::Matrix<type>&, const la::Matrix<type>&,                  \
+                                       const la::Matrix<type>&, const int&, la::LapackWork<type>*);
+
+#define INSTANTIATE_ALL_SCHUR_GEN_TEMPLATES                                                                            \
+    INSTANTIATE_SCHUR_GEN_TEMPLATE(float)                                                                              \
+    INSTANTIATE_SCHUR_GEN_TEMPLATE(double)                                                                             \
+    INSTANTIATE_SCHUR_GEN_TEMPLATE(std::complex<float>)                                                                \
+    INSTANTIATE_SCHUR_GEN_TEMPLATE(std::complex<double>)
+
+INSTANTIATE_ALL_SCHUR_GEN_TEMPLATES
+
+#undef INSTANTIATE_SCHUR_GEN_TEMPLATE
+#undef INSTANTIATE_ALL_SCHUR_GEN_TEMPLATES
@@ -0,0 +1,136 @@
+#ifndef _LA_LAPACK_SCHUR_GEN_H_542734CEB58A4653BAE987A5A59ECAC5_
+#define _LA_LAPACK_SCHUR_GEN_H_542734CEB58A4653BAE987A5A59ECAC5_
+
+/************************/
+/* la_lapack_schur_gen.h*/
+/*    Version 1.0       */
+/*     2026/10/19       */
+/************************/
+
+#ifndef USE_LAPACK
+#error "USE_LAPACK is not defined"
+#endif
+
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include "la_blas_mult.h"
+#include "la_lapack_macro.h"
+#include "math/algebra/matrix.h"
+#include "math/algebra/matrix_operations.h"
+
+namespace la
+{
+
+    namespace GEN_SCHUR
+    {
+        enum Flags : int {
+            // move the finite eigenvalues with a positive real part to the leading block
+            SORT      = 1 << 0,
+            COMPUTE_Q = 1 << 1,
+            COMPUTE_Z = 1 << 2,
+        };
+    }
+
+    // Generalized Schur (QZ) decomposition of the pair (A, B) (?gges), A = Q * S * Z^H and B = Q * P * Z^H with
+    // S upper quasi-triangular (upper triangular for complex types) and P upper triangular.
+    // alpha and beta are laid out as in MatGenEigen, pQ and pZ, when not null, are n x n.
+    // S and P take over the buffers of A and B (they may be A and B themselves), pWork keeps the workspaces between
+    // calls. Returns the number of eigenvalues selected by SORT.
+    template <typename T>
+    int MatGenSchur(Matrix<T>& alpha, Matrix<T>& beta, Matrix<T>* pQ, Matrix<T>* pZ, Matrix<T>& S, Matrix<T>& P,
+                    Matrix<T>&& A, Matrix<T>&& B, const int& flags = 0, LapackWork<T>* pWork = nullptr);
+
+    template <typename T>
+    int MatGenSchur(Matrix<T>& alpha, Matrix<T>& beta, Matrix<T>* pQ, Matrix<T>* pZ, Matrix<T>& S, Matrix<T>& P,
+                    const Matrix<T>& A, const Matrix<T>& B, const int& flags = 0, LapackWork<T>* pWork = nullptr);
+
+    template <typename T> class MatrixGenSchur
+    {
+      public:
+        inline MatrixGenSchur(const Matrix<T>& A, const Matrix<T>& B)
+            : A_(A), B_(B), alpha_(0, 0), beta_(A.GetRowsNb(), 1), S_(0, 0), P_(0, 0), Q_(0, 0), Z_(0, 0), C_(0, 0),
+              flags_(0), sdim_(0)
+        {
+            if (A.GetRowsNb() != A.GetColsNb() || B.GetRowsNb() != B.GetColsNb() || A.GetRowsNb() != B.GetRowsNb())
+                throw std::invalid_argument("MatrixGenSchur: A and B must be square and of the same size");
+            if constexpr (std::is_same<T, float>::value || std::is_same<T, double>::value)
+                alpha_ = Matrix<T>(A_.GetRowsNb(), 2);
+            else alpha_ = Matrix<T>(A_.GetRowsNb(), 1);
+        }
+
+        inline const Matrix<T>& A() const { return A_; }
+
+        inline const Matrix<T>& B() const { return B_; }
+
+        inline const Matrix<T>& alpha() const { return alpha_; }
+
+        inline const Matrix<T>& beta() const { return beta_; }
+
+        inline const Matrix<T>& S() const { return S_; }
+
+        inline const Matrix<T>& P() const { return P_; }
+
+        inline const Matrix<T>& Q() const { return Q_; }
+
+        inline const Matrix<T>& Z() const { return Z_; }
+
+        // number of eigenvalues in the leading block with SORT
+        inline int SortedNb() const { return sdim_; }
+
+        // Q * S * Z^H (first) or Q * P * Z^H reconstructed from the factors, Compute must have been called with
+        // GEN_SCHUR::COMPUTE_Q and GEN_SCHUR::COMPUTE_Z
+        inline const Matrix<T>& C(const bool& first = true)
+        {
+            if (!(flags_ & GEN_SCHUR::COMPUTE_Q) || !(flags_ & GEN_SCHUR::COMPUTE_Z))
+                throw std::runtime_error("MatrixGenSchur: C requires COMPUTE_Q and COMPUTE_Z");
+            C_ = Matrix<T>(A_.GetRowsNb(), A_.GetColsNb());
+            MatMult(C_, MatMult(Q_, first ? S_ : P_), Z_, MULT::B_HT);
+            return C_;
+        }
+
+        inline int GetFlags() const { return flags_; }
+
+        inline void SetFlags(int flags) { flags_ = flags; }
+
+        // S, P, Q, Z and the LAPACK workspaces are kept, so calling Compute again after changing the matrices (of the
+        // same size) does not allocate
+        inline const Matrix<T>& Compute(const int& flags = 0)
+        {
+            flags_         = flags;
+            const size_t n = A_.GetRowsNb();
+            S_             = A_;
+            P_             = B_;
+            Matrix<T>*pQ   = nullptr, *pZ = nullptr;
+            if (flags_ & GEN_SCHUR::COMPUTE_Q)
+            {
+                if (Q_.GetRowsNb() != n || Q_.GetColsNb() != n) Q_ = Matrix<T>(n, n);
+                pQ = &Q_;
+            }
+            if (flags_ & GEN_SCHUR::COMPUTE_Z)
+            {
+                if (Z_.GetRowsNb() != n || Z_.GetColsNb() != n) Z_ = Matrix<T>(n, n);
+                pZ = &Z_;
+            }
+            sdim_ = MatGenSchur<T>(alpha_, beta_, pQ, pZ, S_, P_, std::move(S_), std::move(P_), flags_, &work_);
+            return S_;
+        }
+
+      private:
+        const Matrix<T>& A_;
+        const Matrix<T>& B_;
+        Matrix<T> alpha_;
+        Matrix<T> beta_;
+        Matrix<T> S_;
+        Matrix<T> P_;
+        Matrix<T> Q_;
+        Matrix<T> Z_;
+        Matrix<T> C_;
+        LapackWork<T> work_;
+        int flags_;
+        int sdim_;
+    };
+
+} // namespace la
+
+#endif
@@ -8,6 +8,8 @@
 #include <complex>
 #include <type_traits>
 #include <typeinfo>
+#include <utility>
+#include <vector>
 #include "la_blas_mult.h"
 #include "la_lapack_macro.h"
 #include "la_lapack_qr.h"
@@ -22,46 +24,53 @@
 namespace la
 {
     template <typename T>
-    Matrix<T>& MatSVD(Matrix<T>& U, Matrix<T>& S, Matrix<T>& V, const Matrix<T>& A, const int& DRIVER, const int& flags)
+    std::vector<RealTypeOf<T>>& MatSVD(Matrix<T>& U, std::vector<RealTypeOf<T>>& s, Matrix<T>& V, Matrix<T>&& A,
+                                       const int& DRIVER, const int& flags)
     {
+        const bool bThin = flags & la::SVD::THIN;
+        const size_t mn = std::min(A.GetRowsNb(), A.GetColsNb());
         assert(U.GetRowsNb() == A.GetRowsNb());
-        assert(U.GetColsNb() == A.GetRowsNb());
-        assert(S.GetRowsNb() == A.GetRowsNb());
-        assert(S.GetColsNb() == A.GetColsNb());
-        assert(V.GetRowsNb() == A.GetColsNb());
-        assert(V.GetColsNb() == A.GetColsNb());
+        assert(U.GetColsNb() == (bThin ? mn : A.GetRowsNb()));
+        assert(V.size() == A.GetColsNb() * (bThin ? mn : A.GetColsNb()));
         REALTYPE_DEFINE
         int m = INT_C(A.GetRowsNb()), n = INT_C(A.GetColsNb());
-        Matrix<T> Atmp = A;
+        // the drivers destroy the caller's buffer
+        Matrix<T>& Atmp = A;
         if ((DRIVER == la::DRIVER::GESVJ || DRIVER == la::DRIVER::GEJSV) && n > m)
         {
             Atmp.Transpose();
-            Matrix<T> Stmp = Matrix<T>{SIZE_T_C(n), SIZE_T_C(m)};
             // Compute the SVD of the transpose of A V_HT is purposely not se
             int flagsTmp   = 0;
             if (flags & la::SVD::COMPLETE_U) flagsTmp |= la::SVD::COMPLETE_V;
             if (flags & la::SVD::COMPLETE_V) flagsTmp |= la::SVD::COMPLETE_U;
+            if (bThin)
+            {
+                flagsTmp |= la::SVD::THIN;
+                // V holds the thin U of the transpose
+                V.Resize(SIZE_T_C(n), mn);
+            }
 
-            MatSVD(V, Stmp, U, Atmp, DRIVER, flagsTmp);
-            // S is the transpose of Stmp
-            MatTranspose(S, Stmp);
+            // the singular values of the transpose are the same
+            MatSVD(V, s, U, std::move(Atmp), DRIVER, flagsTmp);
             // U is the transpose conjugate
             U.Conjugate();
             //  V is the transpose conjugate
             if (flags & la::SVD::V_HT) V.Transpose();
             else V.Conjugate();
-            return S;
+            return s;
         }
-        char jobu = 'A';
+        char jobu = bThin ? 'S' : 'A';
         if (DRIVER == la::DRIVER::GESVJ || DRIVER == la::DRIVER::GEJSV) jobu = 'U';
-        int lda = m, ldu = m, ldvt = n;
+        // in thin mode V^H is mn x n
+        int lda = m, ldu = m, ldvt = bThin ? INT_C(mn) : n;
         int lwork = -1, lrwork, info;
         std::vector<int> iwork(8 * SIZE_T_C(std::min(m, n)));
         std::vector<T> work;
         T wkopt;
         // RealType is used because lapack is using float and double for complex function call
-        std::vector<RealType> Stmp(SIZE_T_C(std::min(m, n))), rwork;
-        const size_t mn = SIZE_T_C(std::min(m, n)), mx = SIZE_T_C(std::max(m, n));
+        std::vector<RealType> rwork;
+        s.resize(mn);
+        const size_t mx = SIZE_T_C(std::max(m, n));
         // the following are only relevant for GESVJ OR GEJSV
         char joba = 'G';
         char jobv = 'V';
@@ -75,32 +84,28 @@ namespace la
             {
             case DRIVER::GESVD:
                 // call to get optimal work size
-                sgesvd_(&jobu, &jobu, &m, &n, Atmp.data().data(), &lda, Stmp.data(), U.data().data(), &ldu,
+                sgesvd_(&jobu, &jobu, &m, &n, Atmp.data().data(), &lda, s.data(), U.data().data(), &ldu,
                         V.data().data(), &ldvt, &wkopt, &lwork, &info);
                 // allocate work
                 lwork = INT_C(wkopt);
                 work.resize(SIZE_T_C(lwork));
                 // call lapack
-                sgesvd_(&jobu, &jobu, &m, &n, Atmp.data().data(), &lda, Stmp.data(), U.data().data(), &ldu,
+                sgesvd_(&jobu, &jobu, &m, &n, Atmp.data().data(), &lda, s.data(), U.data().data(), &ldu,
                         V.data().data(), &ldvt, work.data(), &lwork, &info);
-                // Since LAPACK stores the singular values in a vector, we need to convert it to a diagonal matrix
-                for (size_t i = 0; i < Stmp.size(); i++) S(i, i) = Stmp[i];
                 break;
             case DRIVER::GESDD:
-                sgesdd_(&jobu, &m, &n, Atmp.data().data(), &lda, Stmp.data(), U.data().data(), &ldu, V.data().data(),
+                sgesdd_(&jobu, &m, &n, Atmp.data().data(), &lda, s.data(), U.data().data(), &ldu, V.data().data(),
                         &ldvt, &wkopt, &lwork, iwork.data(), &info);
                 lwork = INT_C(wkopt);
                 work.resize(SIZE_T_C(lwork));
-                sgesdd_(&jobu, &m, &n, Atmp.data().data(), &lda, Stmp.data(), U.data().data(), &ldu, V.data().data(),
+                sgesdd_(&jobu, &m, &n, Atmp.data().data(), &lda, s.data(), U.data().data(), &ldu, V.data().data(),
                         &ldvt, work.data(), &lwork, iwork.data(), &info);
-                for (size_t i = 0; i < Stmp.size(); i++) S(i, i) = Stmp[i];
                 break;
             case DRIVER::GESVJ:
                 lwork = std::max(6, m + n);
                 work.resize(SIZE_T_C(lwork));
-                sgesvj_(&joba, &jobu, &jobv, &m, &n, Atmp.data().data(), &lda, Stmp.data(), &mv, V.data().data(), &ldvt,
+                sgesvj_(&joba, &jobu, &jobv, &m, &n, Atmp.data().data(), &lda, s.data(), &mv, V.data().data(), &ldvt,
                         work.data(), &lwork, &info);
-                for (size_t i = 0; i < Stmp.size(); i++) S(i, i) = Stmp[i];
                 // U are stored in the first m rows of Atmp
                 for (size_t i = 0; i < SIZE_T_C(m); i++)
                     for (size_t j = 0; j < SIZE_T_C(n); j++) U(i, j) = Atmp(i, j);
@@ -108,9 +113,8 @@ namespace la
             case DRIVER::GEJSV:
                 lwork = std::max(2 * m + n, 6 * n + 2 * n * n);
                 work.resize(SIZE_T_C(lwork));
-                sgejsv_(&joba, &jobu, &jobv, &jobr, &jobt, &jobp, &m, &n, Atmp.data().data(), &lda, Stmp.data(),
+                sgejsv_(&joba, &jobu, &jobv, &jobr, &jobt, &jobp, &m, &n, Atmp.data().data(), &lda, s.data(),
                         U.data().data(), &ldu, V.data().data(), &ldvt, work.data(), &lwork, iwork.data(), &info);
-                for (size_t i = 0; i < Stmp.size(); i++) S(i, i) = Stmp[i];
                 break;
             default:
                 // throw runtime error
@@ -122,38 +126,34 @@ namespace la
             switch (DRIVER)
             {
             case DRIVER::GESVD:
-                dgesvd_(&jobu, &jobu, &m, &n, Atmp.data().data(), &lda, Stmp.data(), U.data().data(), &ldu,
+                dgesvd_(&jobu, &jobu, &m, &n, Atmp.data().data(), &lda, s.data(), U.data().data(), &ldu,
                         V.data().data(), &ldvt, &wkopt, &lwork, &info);
                 lwork = INT_C(wkopt);
                 work.resize(SIZE_T_C(lwork));
-                dgesvd_(&jobu, &jobu, &m, &n, Atmp.data().data(), &lda, Stmp.data(), U.data().data(), &ldu,
+                dgesvd_(&jobu, &jobu, &m, &n, Atmp.data().data(), &lda, s.data(), U.data().data(), &ldu,
                         V.data().data(), &ldvt, work.data(), &lwork, &info);
-                for (size_t i = 0; i < Stmp.size(); i++) S(i, i) = Stmp[i];
                 break;
             case DRIVER::GESDD:
-                dgesdd_(&jobu, &m, &n, Atmp.data().data(), &lda, Stmp.data(), U.data().data(), &ldu, V.data().data(),
+                dgesdd_(&jobu, &m, &n, Atmp.data().data(), &lda, s.data(), U.data().data(), &ldu, V.data().data(),
                         &ldvt, &wkopt, &lwork, iwork.data(), &info);
                 lwork = INT_C(wkopt);
                 work.resize(SIZE_T_C(lwork));
-                dgesdd_(&jobu, &m, &n, Atmp.data().data(), &lda, Stmp.data(), U.data().data(), &ldu, V.data().data(),
+                dgesdd_(&jobu, &m, &n, Atmp.data().data(), &lda, s.data(), U.data().data(), &ldu, V.data().data(),
                         &ldvt, work.data(), &lwork, iwork.data(), &info);
-                for (size_t i = 0; i < Stmp.size(); i++) S(i, i) = Stmp[i];
                 break;
             case DRIVER::GESVJ:
                 lwork = std::max(6, m + n);
                 work.resize(SIZE_T_C(lwork));
-                dgesvj_(&joba, &jobu, &jobv, &m, &n, Atmp.data().data(), &lda, Stmp.data(), &mv, V.data().data(), &ldvt,
+                dgesvj_(&joba, &jobu, &jobv, &m, &n, Atmp.data().data(), &lda, s.data(), &mv, V.data().data(), &ldvt,
                         work.data(), &lwork, &info);
-                for (size_t i = 0; i < Stmp.size(); i++) S(i, i) = Stmp[i];
                 for (size_t i = 0; i < SIZE_T_C(m); i++)
                     for (size_t j = 0; j < SIZE_T_C(n); j++) U(i, j) = Atmp(i, j);
                 break;
             case DRIVER::GEJSV:
                 lwork = std::max(2 * m + n, 6 * n + 2 * n * n);
                 work.resize(SIZE_T_C(lwork));
-                dgejsv_(&joba, &jobu, &jobv, &jobr, &jobt, &jobp, &m, &n, Atmp.data().data(), &lda, Stmp.data(),
+                dgejsv_(&joba, &jobu, &jobv, &jobr, &jobt, &jobp, &m, &n, Atmp.data().data(), &lda, s.data(),
                         U.data().data(), &ldu, V.data().data(), &ldvt, work.data(), &lwork, iwork.data(), &info);
-                for (size_t i = 0; i < Stmp.size(); i++) S(i, i) = Stmp[i];
                 break;
             default:
                 // throw runtime error
@@ -167,37 +167,34 @@ namespace la
             {
             case DRIVER::GESVD:
                 rwork.resize(5 * SIZE_T_C(std::min(m, n)));
-                cgesvd_(&jobu, &jobu, &m, &n, FLOAT_P_R(Atmp.data().data()), &lda, Stmp.data(),
+                cgesvd_(&jobu, &jobu, &m, &n, FLOAT_P_R(Atmp.data().data()), &lda, s.data(),
                         FLOAT_P_R(U.data().data()), &ldu, FLOAT_P_R(V.data().data()), &ldvt, FLOAT_P_R(&wkopt), &lwork,
                         rwork.data(), &info);
                 lwork = INT_C(wkopt.real());
                 work.resize(SIZE_T_C(lwork));
-                cgesvd_(&jobu, &jobu, &m, &n, FLOAT_P_R(Atmp.data().data()), &lda, Stmp.data(),
+                cgesvd_(&jobu, &jobu, &m, &n, FLOAT_P_R(Atmp.data().data()), &lda, s.data(),
                         FLOAT_P_R(U.data().data()), &ldu, FLOAT_P_R(V.data().data()), &ldvt, FLOAT_P_R(work.data()),
                         &lwork, rwork.data(), &info);
-                for (size_t i = 0; i < Stmp.size(); i++) S(i, i) = Stmp[i];
                 break;
             case DRIVER::GESDD:
                 rwork.resize(SIZE_T_C(std::max(5 * mn * mn + 5 * mn, 2 * mx * mn + 2 * mn * mn + mn)));
-                cgesdd_(&jobu, &m, &n, FLOAT_P_R(Atmp.data().data()), &lda, Stmp.data(), FLOAT_P_R(U.data().data()),
+                cgesdd_(&jobu, &m, &n, FLOAT_P_R(Atmp.data().data()), &lda, s.data(), FLOAT_P_R(U.data().data()),
                         &ldu, FLOAT_P_R(V.data().data()), &ldvt, FLOAT_P_R(&wkopt), &lwork, rwork.data(), iwork.data(),
                         &info);
                 lwork = INT_C(wkopt.real());
                 work.resize(SIZE_T_C(lwork));
-                cgesdd_(&jobu, &m, &n, FLOAT_P_R(Atmp.data().data()), &lda, Stmp.data(), FLOAT_P_R(U.data().data()),
+                cgesdd_(&jobu, &m, &n, FLOAT_P_R(Atmp.data().data()), &lda, s.data(), FLOAT_P_R(U.data().data()),
                         &ldu, FLOAT_P_R(V.data().data()), &ldvt, FLOAT_P_R(work.data()), &lwork, rwork.data(),
                         iwork.data(), &info);
-                for (size_t i = 0; i < Stmp.size(); i++) S(i, i) = Stmp[i];
                 break;
             case DRIVER::GESVJ:
                 lwork = m + n;
                 work.resize(SIZE_T_C(lwork));
                 lrwork = std::max(6, m + n);
                 rwork.resize(SIZE_T_C(lrwork));
-                cgesvj_(&joba, &jobu, &jobv, &m, &n, FLOAT_P_R(Atmp.data().data()), &lda, Stmp.data(), &mv,
+                cgesvj_(&joba, &jobu, &jobv, &m, &n, FLOAT_P_R(Atmp.data().data()), &lda, s.data(), &mv,
                         FLOAT_P_R(V.data().data()), &ldvt, FLOAT_P_R(work.data()), &lwork, rwork.data(), &lrwork,
                         &info);
-                for (size_t i = 0; i < Stmp.size(); i++) S(i, i) = Stmp[i];
                 for (size_t i = 0; i < SIZE_T_C(m); i++)
                     for (size_t j = 0; j < SIZE_T_C(n); j++) U(i, j) = Atmp(i, j);
                 break;
@@ -207,16 +204,15 @@ namespace la
                 rwork.resize(1);
                 work.resize(2);
                 cgejsv_(&joba, &jobu, &jobv, &jobr, &jobt, &jobp, &m, &n, FLOAT_P_R(Atmp.data().data()), &lda,
-                        Stmp.data(), FLOAT_P_R(U.data().data()), &ldu, FLOAT_P_R(V.data().data()), &ldvt,
+                        s.data(), FLOAT_P_R(U.data().data()), &ldu, FLOAT_P_R(V.data().data()), &ldvt,
                         FLOAT_P_R(work.data()), &lwork, rwork.data(), &lrwork, iwork.data(), &info);
                 lrwork = INT_C(rwork[0]);
                 rwork.resize(SIZE_T_C(lrwork));
                 lwork = INT_C(work[0].real());
                 work.resize(SIZE_T_C(lwork));
                 cgejsv_(&joba, &jobu, &jobv, &jobr, &jobt, &jobp, &m, &n, FLOAT_P_R(Atmp.data().data()), &lda,
-                        Stmp.data(), FLOAT_P_R(U.data().data()), &ldu, FLOAT_P_R(V.data().data()), &ldvt,
+                        s.data(), FLOAT_P_R(U.data().data()), &ldu, FLOAT_P_R(V.data().data()), &ldvt,
                         FLOAT_P_R(work.data()), &lwork, FLOAT_P_R(rwork.data()), &lrwork, iwork.data(), &info);
-                for (size_t i = 0; i < Stmp.size(); i++) S(i, i) = Stmp[i];
                 break;
             }
         }
@@ -227,37 +223,34 @@ namespace la
             {
             case DRIVER::GESVD:
                 rwork.resize(5 * SIZE_T_C(std::min(m, n)));
-                zgesvd_(&jobu, &jobu, &m, &n, DOUBLE_P_R(Atmp.data().data()), &lda, Stmp.data(),
+                zgesvd_(&jobu, &jobu, &m, &n, DOUBLE_P_R(Atmp.data().data()), &lda, s.data(),
                         DOUBLE_P_R(U.data().data()), &ldu, DOUBLE_P_R(V.data().data()), &ldvt, DOUBLE_P_R(&wkopt),
                         &lwork, rwork.data(), &info);
                 lwork = INT_C(wkopt.real());
                 work.resize(SIZE_T_C(lwork));
-                zgesvd_(&jobu, &jobu, &m, &n, DOUBLE_P_R(Atmp.data().data()), &lda, Stmp.data(),
+                zgesvd_(&jobu, &jobu, &m, &n, DOUBLE_P_R(Atmp.data().data()), &lda, s.data(),
                         DOUBLE_P_R(U.data().data()), &ldu, DOUBLE_P_R(V.data().data()), &ldvt, DOUBLE_P_R(work.data()),
                         &lwork, rwork.data(), &info);
-                for (size_t i = 0; i < Stmp.size(); i++) S(i, i) = Stmp[i];
                 break;
             case DRIVER::GESDD:
                 rwork.resize(SIZE_T_C(std::max(5 * mn * mn + 5 * mn, 2 * mx * mn + 2 * mn * mn + mn)));
-                zgesdd_(&jobu, &m, &n, DOUBLE_P_R(Atmp.data().data()), &lda, Stmp.data(), DOUBLE_P_R(U.data().data()),
+                zgesdd_(&jobu, &m, &n, DOUBLE_P_R(Atmp.data().data()), &lda, s.data(), DOUBLE_P_R(U.data().data()),
                         &ldu, DOUBLE_P_R(V.data().data()), &ldvt, DOUBLE_P_R(&wkopt), &lwork, rwork.data(),
                         iwork.data(), &info);
                 lwork = INT_C(wkopt.real());
                 work.resize(SIZE_T_C(lwork));
-                zgesdd_(&jobu, &m, &n, DOUBLE_P_R(Atmp.data().data()), &lda, Stmp.data(), DOUBLE_P_R(U.data().data()),
+                zgesdd_(&jobu, &m, &n, DOUBLE_P_R(Atmp.data().data()), &lda, s.data(), DOUBLE_P_R(U.data().data()),
                         &ldu, DOUBLE_P_R(V.data().data()), &ldvt, DOUBLE_P_R(work.data()), &lwork, rwork.data(),
                         iwork.data(), &info);
-                for (size_t i = 0; i < Stmp.size(); i++) S(i, i) = Stmp[i];
                 break;
             case DRIVER::GESVJ:
                 lwork = m + n;
                 work.resize(SIZE_T_C(lwork));
                 lrwork = std::max(6, m + n);
                 rwork.resize(SIZE_T_C(lrwork));
-                zgesvj_(&joba, &jobu, &jobv, &m, &n, DOUBLE_P_R(Atmp.data().data()), &lda, Stmp.data(), &mv,
+                zgesvj_(&joba, &jobu, &jobv, &m, &n, DOUBLE_P_R(Atmp.data().data()), &lda, s.data(), &mv,
                         DOUBLE_P_R(V.data().data()), &ldvt, DOUBLE_P_R(work.data()), &lwork, DOUBLE_P_R(rwork.data()),
                         &lrwork, &info);
-                for (size_t i = 0; i < Stmp.size(); i++) S(i, i) = Stmp[i];
                 for (size_t i = 0; i < SIZE_T_C(m); i++)
                     for (size_t j = 0; j < SIZE_T_C(n); j++) U(i, j) = Atmp(i, j);
                 break;
@@ -267,16 +260,15 @@ namespace la
                 rwork.resize(1);
                 work.resize(2);
                 zgejsv_(&joba, &jobu, &jobv, &jobr, &jobt, &jobp, &m, &n, DOUBLE_P_R(Atmp.data().data()), &lda,
-                        Stmp.data(), DOUBLE_P_R(U.data().data()), &ldu, DOUBLE_P_R(V.data().data()), &ldvt,
+                        s.data(), DOUBLE_P_R(U.data().data()), &ldu, DOUBLE_P_R(V.data().data()), &ldvt,
                         DOUBLE_P_R(work.data()), &lwork, rwork.data(), &lrwork, iwork.data(), &info);
                 lrwork = INT_C(rwork[0]);
                 rwork.resize(SIZE_T_C(lrwork));
                 lwork = INT_C(work[0].real());
                 work.resize(SIZE_T_C(lwork));
                 zgejsv_(&joba, &jobu, &jobv, &jobr, &jobt, &jobp, &m, &n, DOUBLE_P_R(Atmp.data().data()), &lda,
-                        Stmp.data(), DOUBLE_P_R(U.data().data()), &ldu, DOUBLE_P_R(V.data().data()), &ldvt,
+                        s.data(), DOUBLE_P_R(U.data().data()), &ldu, DOUBLE_P_R(V.data().data()), &ldvt,
                         DOUBLE_P_R(work.data()), &lwork, DOUBLE_P_R(rwork.data()), &lrwork, iwork.data(), &info);
-                for (size_t i = 0; i < Stmp.size(); i++) S(i, i) = Stmp[i];
                 break;
             }
         }
@@ -307,10 +299,63 @@ namespace la
         }
         else
         {
+            if (bThin) V.Reshape(mn, SIZE_T_C(n));
             if (!(flags & la::SVD::V_HT)) V.Hermitian();
         }
+        return s;
+    }
+
+    template <typename T>
+    std::vector<RealTypeOf<T>>& MatSVD(Matrix<T>& U, std::vector<RealTypeOf<T>>& s, Matrix<T>& V, const Matrix<T>& A,
+                                       const int& DRIVER, const int& flags)
+    {
+        return MatSVD(U, s, V, Matrix<T>(A), DRIVER, flags);
+    }
+
+    template <typename T>
+    Matrix<T>& MatSVD(Matrix<T>& U, Matrix<T>& S, Matrix<T>& V, Matrix<T>&& A, const int& DRIVER, const int& flags)
+    {
+        assert(S.GetRowsNb() == ((flags & la::SVD::THIN) ? std::min(A.GetRowsNb(), A.GetColsNb()) : A.GetRowsNb()));
+        assert(S.GetColsNb() == ((flags & la::SVD::THIN) ? std::min(A.GetRowsNb(), A.GetColsNb()) : A.GetColsNb()));
+        std::vector<RealTypeOf<T>> s;
+        MatSVD(U, s, V, std::move(A), DRIVER, flags);
+        // diagonal matrix from the singular values
+        for (size_t i = 0; i < s.size(); i++) S(i, i) = s[i];
         return S;
     }
+
+    template <typename T>
+    Matrix<T>& MatSVD(Matrix<T>& U, Matrix<T>& S, Matrix<T>& V, const Matrix<T>& A, const int& DRIVER, const int& flags)
+    {
+        return MatSVD(U, S, V, Matrix<T>(A), DRIVER, flags);
+    }
+
+    template <typename T>
+    Matrix<T>& MatSVDReconstruct(Matrix<T>& C, const Matrix<T>& U, const std::vector<RealTypeOf<T>>& s,
+                                 const Matrix<T>& V, const size_t& k, const int& flags)
+    {
+        const size_t m = U.GetRowsNb(), n = (flags & la::SVD::V_HT) ? V.GetColsNb() : V.GetRowsNb();
+        const size_t r = std::min(k, s.size());
+        assert(C.GetRowsNb() == m && C.GetColsNb() == n);
+        assert(U.GetColsNb() >= r);
+        if (r == 0)
+        {
+            C.Zeros();
+            return C;
+        }
+        // W = U(:, 0:r) * diag(s(0:r)), the columns of U are contiguous
+        Matrix<T> W{m, r};
+        for (size_t j = 0; j < r; ++j)
+        {
+            const T sj = static_cast<T>(s[j]);
+            for (size_t i = 0; i < m; ++i) W(i, j) = U(i, j) * sj;
+        }
+        // C = W * V(:, 0:r)^H, V is stored as V^H (the first r rows) with V_HT
+        if (flags & la::SVD::V_HT)
+            Gemm('N', 'N', m, n, r, T(1), W.data().data(), m, V.data().data(), V.GetRowsNb(), T(0), C.data().data(), m);
+        else Gemm('N', 'C', m, n, r, T(1), W.data().data(), m, V.data().data(), n, T(0), C.data().data(), m);
+        return C;
+    }
 } // namespace la
 
 #undef DOUBLE_P_R
@@ -321,7 +366,21 @@ namespace la
 // Explicit template instantiation
 #define INSTANTIATE_SVD_TEMPLATE(type)                                                                                 \
     template la::Matrix<type>& la::MatSVD<type>(la::Matrix<type> & U, la::Matrix<type> & S, la::Matrix<type> & V,      \
-                                                const la::Matrix<type>& A, const int& DRIVER, const int& flags);
+                                                const la::Matrix<type>& A, const int& DRIVER, const int& flags);       \
+    template la::Matrix<type>& la::MatSVD<type>(la::Matrix<type> & U, la::Matrix<type> & S, la::Matrix<type> & V,      \
+                                                la::Matrix<type>&& A, const int& DRIVER, const int& flags);            \
+    template std::vector<la::RealTypeOf<type>>& la::MatSVD<type>(la::Matrix<type> & U,                                 \
+                                                                 std::vector<la::RealTypeOf<type>> & s,                \
+                                                                 la::Matrix<type> & V, const la::Matrix<type>& A,      \
+                                                                 const int& DRIVER, const int& flags);                 \
+    template std::vector<la::RealTypeOf<type>>& la::MatSVD<type>(la::Matrix<type> & U,                                 \
+                                                                 std::vector<la::RealTypeOf<type>> & s,                \
+                                                                 la::Matrix<type> & V, la::Matrix<type> && A,          \
+                                                                 const int& DRIVER, const int& flags);                 \
+    template la::Matrix<type>& la::MatSVDReconstruct<type>(la::Matrix<type> & C, const la::Matrix<type>& U,            \
+                                                           const std::vector<la::RealTypeOf<type>>& s,                 \
+                                                           const la::Matrix<type>& V, const size_t& k,                 \
+                                                           const int& flags);
 
 #define INSTANTIATE_ALL_SVD_TEMPLATES                                                                                  \
     INSTANTIATE_SVD_TEMPLATE(float)                                                                                    \
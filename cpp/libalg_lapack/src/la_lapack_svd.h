@@ -11,7 +11,15 @@
 #error "USE_LAPACK is not defined"
 #endif
 
+#include <algorithm>
+#include <cassert>
+#include <limits>
+#include <stdexcept>
+#include <utility>
+#include <vector>
 #include "la_blas_mult.h"
+#include "la_lapack_macro.h"
+#include "la_owned_matrix.h"
 #include "math/algebra/matrix.h"
 #include "math/algebra/matrix_operations.h"
 
@@ -33,6 +41,9 @@ namespace la
             V_HT       = 1 << 0,
             COMPLETE_U = 1 << 1,
             COMPLETE_V = 1 << 2,
+            // economy size decomposition (jobu = 'S'), with mn = min(m, n)
+            // U is m x mn, S is mn x mn and V is n x mn (mn x n with V_HT)
+            THIN       = 1 << 3,
         };
     }
 
@@ -48,6 +59,27 @@ namespace la
     Matrix<T>& MatSVD(Matrix<T>& U, Matrix<T>& S, Matrix<T>& V, const Matrix<T>& A, const int& DRIVER = 1,
                       const int& flags = false);
 
+    // In-place version, the driver works directly on the buffer of A (pass std::move(A)) instead of a copy of it.
+    // The content of A is undefined on exit.
+    template <typename T>
+    Matrix<T>& MatSVD(Matrix<T>& U, Matrix<T>& S, Matrix<T>& V, Matrix<T>&& A, const int& DRIVER = 1,
+                      const int& flags = false);
+
+    // singular values stored in a vector of min(m, n) real values (descending) instead of a dense m x n diagonal S
+    template <typename T>
+    std::vector<RealTypeOf<T>>& MatSVD(Matrix<T>& U, std::vector<RealTypeOf<T>>& s, Matrix<T>& V, const Matrix<T>& A,
+                                       const int& DRIVER = 1, const int& flags = false);
+
+    template <typename T>
+    std::vector<RealTypeOf<T>>& MatSVD(Matrix<T>& U, std::vector<RealTypeOf<T>>& s, Matrix<T>& V, Matrix<T>&& A,
+                                       const int& DRIVER = 1, const int& flags = false);
+
+    // rank-k reconstruction C = U(:, 0:k) * diag(s(0:k)) * V(:, 0:k)^H in O(m * n * k), no diagonal matrix is formed.
+    // V is stored as V^H with SVD::V_HT, C is m x n and k is clamped to the number of singular values.
+    template <typename T>
+    Matrix<T>& MatSVDReconstruct(Matrix<T>& C, const Matrix<T>& U, const std::vector<RealTypeOf<T>>& s,
+                                 const Matrix<T>& V, const size_t& k, const int& flags = 0);
+
     template <typename T>
     Matrix<T> MatSVD(Matrix<T>& S, Matrix<T>& V, const Matrix<T>& A, const int& DRIVER, const int& flags)
     {
@@ -75,16 +107,38 @@ namespace la
 
       public:
         inline MatrixSVD(const Matrix<T>& M)
-            : A_(M), U_(M.GetRowsNb(), M.GetRowsNb()), S_(M.GetRowsNb(), M.GetColsNb()),
-              V_(M.GetColsNb(), M.GetColsNb()), C_(0, 0), DRIVER_(0), flags_(0)
+            : A_(M), U_(M.GetRowsNb(), M.GetRowsNb()), S_(0, 0), V_(M.GetColsNb(), M.GetColsNb()), C_(0, 0),
+              DRIVER_(0), flags_(0), owner_(false)
         {
         }
 
-        inline const Matrix<T>& A() const { return A_; }
+        // owning mode, the matrix is moved in without a copy (pass std::move(M) or a temporary).
+        // Compute runs the driver in place and releases it, A() then only keeps the dimensions.
+        inline MatrixSVD(Matrix<T>&& M)
+            : A_(std::move(M)), U_(A_->GetRowsNb(), A_->GetRowsNb()), S_(0, 0), V_(A_->GetColsNb(), A_->GetColsNb()),
+              C_(0, 0), DRIVER_(0), flags_(0), owner_(true)
+        {
+        }
+
+        inline const Matrix<T>& A() const { return *A_; }
 
         inline const Matrix<T>& U() const { return U_; }
 
-        inline const Matrix<T>& S() const { return S_; }
+        // singular values in descending order
+        inline const std::vector<RealTypeOf<T>>& SingularValues() const { return s_; }
+
+        // dense diagonal matrix of the singular values (m x n, mn x mn with SVD::THIN), formed on first use
+        inline const Matrix<T>& S() const
+        {
+            if (S_.size() == 0)
+            {
+                const size_t mn = std::min(A_->GetRowsNb(), A_->GetColsNb());
+                if (flags_ & la::SVD::THIN) S_ = Matrix<T>(mn, mn);
+                else S_ = Matrix<T>(A_->GetRowsNb(), A_->GetColsNb());
+                for (size_t i = 0; i < s_.size(); i++) S_(i, i) = s_[i];
+            }
+            return S_;
+        }
 
         inline const Matrix<T>& V() const { return V_; }
 
@@ -96,30 +150,106 @@ namespace la
         {
             flags_  = flags;
             DRIVER_ = DRIVER;
-            MatSVD(U_, S_, V_, A_, DRIVER_, flags_);
+            const size_t m = A_->GetRowsNb(), n = A_->GetColsNb(), mn = std::min(m, n);
+            if (flags_ & la::SVD::THIN)
+            {
+                U_.Resize(m, mn);
+                if (flags_ & la::SVD::V_HT) V_.Resize(mn, n);
+                else V_.Resize(n, mn);
+            }
+            else
+            {
+                U_.Resize(m, m);
+                V_.Resize(n, n);
+            }
+            S_ = Matrix<T>(0, 0);
+            C_ = Matrix<T>(0, 0);
+            if (owner_)
+            {
+                if (A_.Own().data().empty()) throw std::runtime_error("MatrixSVD: matrix already decomposed in place");
+                Matrix<T> Awork = std::move(A_.Own());
+                MatSVD(U_, s_, V_, std::move(Awork), DRIVER_, flags_);
+            }
+            else MatSVD(U_, s_, V_, *A_, DRIVER_, flags_);
         }
 
         inline const Matrix<T>& C()
         {
             if (C_.size() == 0)
             {
-                C_ = Matrix<T>(U_.GetRowsNb(), V_.GetColsNb());
-                if (flags_ & la::SVD::V_HT) MatMult(C_, U_, MatMult(S_, V_));
-                else MatMult(C_, U_, MatMult(S_, MatHermitian(V_)));
+                C_ = Matrix<T>(A_->GetRowsNb(), A_->GetColsNb());
+                MatSVDReconstruct(C_, U_, s_, V_, s_.size(), flags_);
             }
             return C_;
         }
 
+        // best rank-k approximation of A from the computed factors (see MatSVDReconstruct)
+        inline Matrix<T>& C(Matrix<T>& Ck, const size_t& k) const
+        {
+            return MatSVDReconstruct(Ck, U_, s_, V_, k, flags_);
+        }
+
+        inline Matrix<T> C(const size_t& k) const
+        {
+            Matrix<T> Ck{A_->GetRowsNb(), A_->GetColsNb()};
+            return C(Ck, k);
+        }
+
         inline int GetFlags() const { return flags_; }
 
+        // number of singular values above rcond times the largest one (rcond < 0 selects max(m, n) * eps)
+        inline size_t Rank(RealTypeOf<T> rcond = -1) const
+        {
+            const size_t mn = s_.size();
+            if (mn == 0) return 0;
+            if (rcond < 0)
+                rcond = static_cast<RealTypeOf<T>>(std::max(A_->GetRowsNb(), A_->GetColsNb())) *
+                        std::numeric_limits<RealTypeOf<T>>::epsilon();
+            const RealTypeOf<T> cut_ = rcond * s_[0];
+            size_t r                 = 0;
+            while (r < mn && s_[r] > cut_) ++r;
+            return r;
+        }
+
+        // X = A^+ * B applied from the computed factors, V * S^+ * U^H * B, without forming the pseudoinverse
+        // B is m x nrhs and X is n x nrhs, the singular values cut by Rank(rcond) are treated as zero
+        inline Matrix<T>& PinvMult(Matrix<T>& X, const Matrix<T>& B, const RealTypeOf<T>& rcond = -1) const
+        {
+            const size_t m = A_->GetRowsNb(), n = A_->GetColsNb(), nrhs = B.GetColsNb(), r = Rank(rcond);
+            assert(B.GetRowsNb() == m);
+            assert(X.GetRowsNb() == n && X.GetColsNb() == nrhs);
+            X.Zeros();
+            if (r == 0) return X;
+            // Y = S(0:r, 0:r)^-1 * U(:, 0:r)^H * B
+            Matrix<T> Y{r, nrhs};
+            Gemm('C', 'N', r, nrhs, m, T(1), U_.data().data(), m, B.data().data(), m, T(0), Y.data().data(), r);
+            for (size_t j = 0; j < nrhs; ++j)
+                for (size_t i = 0; i < r; ++i) Y(i, j) /= s_[i];
+            // X = V(:, 0:r) * Y, V is stored as V^H with V_HT
+            if (flags_ & la::SVD::V_HT)
+                Gemm('C', 'N', n, nrhs, r, T(1), V_.data().data(), V_.GetRowsNb(), Y.data().data(), r, T(0),
+                     X.data().data(), n);
+            else Gemm('N', 'N', n, nrhs, r, T(1), V_.data().data(), n, Y.data().data(), r, T(0), X.data().data(), n);
+            return X;
+        }
+
+        inline Matrix<T> PinvMult(const Matrix<T>& B, const RealTypeOf<T>& rcond = -1) const
+        {
+            Matrix<T> X{A_->GetColsNb(), B.GetColsNb()};
+            return PinvMult(X, B, rcond);
+        }
+
       private:
-        const Matrix<T>& A_;
+        OwnedMatrix<T> A_;
         Matrix<T> U_;
-        Matrix<T> S_;
+        std::vector<RealTypeOf<T>> s_;
+        // dense diagonal view of s_, only formed by S()
+        mutable Matrix<T> S_;
         Matrix<T> V_;
         Matrix<T> C_;
         int DRIVER_;
         int flags_;
+        bool owner_;
     };
 
 } // namespace la
@@ -0,0 +1,60 @@
+#ifndef _LA_OWNED_MATRIX_H_E69387EE422C49518E8A7941C3F324A2_
+#define _LA_OWNED_MATRIX_H_E69387EE422C49518E8A7941C3F324A2_
+
+/************************/
+/*  la_owned_matrix.h   */
+/*    Version 1.0       */
+/*     2026/10/19       */
+/************************/
+
+#include <utility>
+#include "math/algebra/matrix.h"
+
+namespace la
+{
+    // Input matrix of the decomposition classes, either borrowed from the caller or owned (moved in).
+    // It is held through a pointer which a copy or a move re-points to its own storage in owning mode, so the
+    // classes can be copied and moved in both modes.
+    template <typename T> class OwnedMatrix
+    {
+      public:
+        explicit OwnedMatrix(const Matrix<T>& M) : own_(0, 0), p_(&M) {}
+
+        explicit OwnedMatrix(Matrix<T>&& M) : own_(std::move(M)), p_(&own_) {}
+
+        OwnedMatrix(const OwnedMatrix& o) : own_(o.own_), p_(o.Owner() ? &own_ : o.p_) {}
+
+        OwnedMatrix(OwnedMatrix&& o) : own_(std::move(o.own_)), p_(o.Owner() ? &own_ : o.p_) {}
+
+        OwnedMatrix& operator=(const OwnedMatrix& o)
+        {
+            if (this == &o) return *this;
+            own_ = o.own_;
+            p_   = o.Owner() ? &own_ : o.p_;
+            return *this;
+        }
+
+        OwnedMatrix& operator=(OwnedMatrix&& o)
+        {
+            if (this == &o) return *this;
+            own_ = std::move(o.own_);
+            p_   = o.Owner() ? &own_ : o.p_;
+            return *this;
+        }
+
+        inline bool Owner() const { return p_ == &own_; }
+
+        inline const Matrix<T>& operator*() const { return *p_; }
+
+        inline const Matrix<T>* operator->() const { return p_; }
+
+        // storage of the owned matrix, moved out by the in place decompositions
+        inline Matrix<T>& Own() { return own_; }
+
+      private:
+        Matrix<T> own_;
+        const Matrix<T>* p_;
+    };
+} // namespace la
+
+#endif
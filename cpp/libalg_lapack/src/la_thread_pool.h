@@ -0,0 +1,85 @@
+#ifndef _LA_THREAD_POOL_H_33985906551C46CC9F724678BF964399_
+#define _LA_THREAD_POOL_H_33985906551C46CC9F724678BF964399_
+
+/************************/
+/*   la_thread_pool.h   */
+/*    Version 1.0       */
+/*     2026/10/19       */
+/************************/
+
+#include <algorithm>
+#include <cstddef>
+#include "thread/thread_pool.hpp"
+#ifdef USE_BLAS
+#include "la_blas_threads.h"
+#endif
+
+namespace la
+{
+    // pool shared by the parallel routines of the library, created on first use with one thread per core
+    inline tp::thread_pool& ThreadPool()
+    {
+        static tp::thread_pool pool_{};
+        return pool_;
+    }
+
+    // true while the calling thread is executing a block submitted by ParallelFor
+    inline bool& InPoolWorker()
+    {
+        static thread_local bool bWorker_ = false;
+        return bWorker_;
+    }
+
+    // split [first, last) in nBlocks contiguous blocks and call f(begin, end, block) for each of them on the pool.
+    // block is in [0, nBlocks) so it can be used to select a per-thread workspace.
+    // The loop is executed serially when called from a pool worker, so nested calls cannot deadlock the pool.
+    // With USE_BLAS the BLAS calls made by the blocks run single-threaded (see BlasAutoThreads).
+    template <typename F> void ParallelFor(const size_t first, const size_t last, F&& f, size_t nBlocks = 0)
+    {
+        if (last <= first) return;
+        tp::thread_pool& pool_ = ThreadPool();
+        if (nBlocks == 0) nBlocks = static_cast<size_t>(pool_.get_thread_count());
+        nBlocks = std::min(nBlocks, last - first);
+        if (nBlocks <= 1 || InPoolWorker())
+        {
+            f(first, last, static_cast<size_t>(0));
+            return;
+        }
+        struct WorkerGuard
+        {
+            WorkerGuard() { InPoolWorker() = true; }
+
+            ~WorkerGuard() { InPoolWorker() = false; }
+#ifdef USE_BLAS
+            BlasPoolWorker blas_;
+#endif
+        };
+#ifdef USE_BLAS
+        BlasPoolRegion blasRegion_;
+#endif
+        const size_t bs_ = (last - first) / nBlocks, rem_ = (last - first) % nBlocks;
+        tp::multi_future<void> mf_;
+        size_t start_ = first;
+        for (size_t b = 0; b < nBlocks; ++b)
+        {
+            const size_t end_ = start_ + bs_ + (b < rem_ ? 1 : 0);
+            mf_.push_back(pool_.submit([&f, start_, end_, b]() {
+                WorkerGuard guard_;
+                f(start_, end_, b);
+            }));
+            start_ = end_;
+        }
+        // wait for all the blocks before rethrowing the first exception, if any
+        mf_.wait();
+        mf_.get();
+    }
+
+    // number of blocks ParallelFor uses by default
+    inline size_t ParallelBlocksNb()
+    {
+        return InPoolWorker() ? 1 : static_cast<size_t>(ThreadPool().get_thread_count());
+    }
+
+} // namespace la
+
+#endif
@@ -13,6 +13,9 @@
 #include <iostream>
 #include <string>
 #include "la_decomposition.h"
+#ifdef USE_BLAS
+#include "la_blas_mult.h"
+#endif
 #include "matrix.h"
 #include "matrix_operations.h"
 
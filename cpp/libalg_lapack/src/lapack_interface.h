@@ -33,18 +33,31 @@ extern "C" void zgeev_(char* jobvl, char* jobvr, int* n, double* a, int* lda, do
 // LU interface
 #ifdef _MSC_VER
 #define sgetrf_ SGETRF
+#define sgetrs_ SGETRS
+
 #define dgetrf_ DGETRF
+#define dgetrs_ DGETRS
+
 #define cgetrf_ CGETRF
+#define cgetrs_ CGETRS
+
 #define zgetrf_ ZGETRF
+#define zgetrs_ ZGETRS
 #endif
 // float
 extern "C" void sgetrf_(int* m, int* n, float* a, int* lda, int* ipiv, int* info);
+extern "C" void sgetrs_(char* trans, int* n, int* nrhs, float* a, int* lda, int* ipiv, float* b, int* ldb, int* info);
 // double
 extern "C" void dgetrf_(int* m, int* n, double* a, int* lda, int* ipiv, int* info);
+extern "C" void dgetrs_(char* trans, int* n, int* nrhs, double* a, int* lda, int* ipiv, double* b, int* ldb,
+                        int* info);
 // complex
 extern "C" void cgetrf_(int* m, int* n, float* a, int* lda, int* ipiv, int* info);
+extern "C" void cgetrs_(char* trans, int* n, int* nrhs, float* a, int* lda, int* ipiv, float* b, int* ldb, int* info);
 // double complex
 extern "C" void zgetrf_(int* m, int* n, double* a, int* lda, int* ipiv, int* info);
+extern "C" void zgetrs_(char* trans, int* n, int* nrhs, double* a, int* lda, int* ipiv, double* b, int* ldb,
+                        int* info);
 
 // QR interface
 #ifdef _MSC_VER
@@ -156,3 +169,279 @@ extern "C" void zgesvj_(char* joba, char* jobu, char* jobv, int* m, int* n, doub
 extern "C" void zgejsv_(char* joba, char* jobu, char* jobv, char* jobr, char* jobt, char* jobp, int* m, int* n,
                         double* a, int* lda, double* sva, double* u, int* ldu, double* v, int* ldv, double* work,
                         int* lwork, double* rwork, int* lrwork, int* iwork, int* info);
+
+// Symmetric and hermitian eigenvalues interface
+#ifdef _MSC_VER
+#define ssyevd_ SSYEVD
+#define ssyevr_ SSYEVR
+
+#define dsyevd_ DSYEVD
+#define dsyevr_ DSYEVR
+
+#define cheevd_ CHEEVD
+#define cheevr_ CHEEVR
+
+#define zheevd_ ZHEEVD
+#define zheevr_ ZHEEVR
+#endif
+// float
+extern "C" void ssyevd_(char* jobz, char* uplo, int* n, float* a, int* lda, float* w, float* work, int* lwork,
+                        int* iwork, int* liwork, int* info);
+extern "C" void ssyevr_(char* jobz, char* range, char* uplo, int* n, float* a, int* lda, float* vl, float* vu, int* il,
+                        int* iu, float* abstol, int* m, float* w, float* z, int* ldz, int* isuppz, float* work,
+                        int* lwork, int* iwork, int* liwork, int* info);
+// double
+extern "C" void dsyevd_(char* jobz, char* uplo, int* n, double* a, int* lda, double* w, double* work, int* lwork,
+                        int* iwork, int* liwork, int* info);
+extern "C" void dsyevr_(char* jobz, char* range, char* uplo, int* n, double* a, int* lda, double* vl, double* vu,
+                        int* il, int* iu, double* abstol, int* m, double* w, double* z, int* ldz, int* isuppz,
+                        double* work, int* lwork, int* iwork, int* liwork, int* info);
+// complex
+extern "C" void cheevd_(char* jobz, char* uplo, int* n, float* a, int* lda, float* w, float* work, int* lwork,
+                        float* rwork, int* lrwork, int* iwork, int* liwork, int* info);
+extern "C" void cheevr_(char* jobz, char* range, char* uplo, int* n, float* a, int* lda, float* vl, float* vu, int* il,
+                        int* iu, float* abstol, int* m, float* w, float* z, int* ldz, int* isuppz, float* work,
+                        int* lwork, float* rwork, int* lrwork, int* iwork, int* liwork, int* info);
+// double complex
+extern "C" void zheevd_(char* jobz, char* uplo, int* n, double* a, int* lda, double* w, double* work, int* lwork,
+                        double* rwork, int* lrwork, int* iwork, int* liwork, int* info);
+extern "C" void zheevr_(char* jobz, char* range, char* uplo, int* n, double* a, int* lda, double* vl, double* vu,
+                        int* il, int* iu, double* abstol, int* m, double* w, double* z, int* ldz, int* isuppz,
+                        double* work, int* lwork, double* rwork, int* lrwork, int* iwork, int* liwork, int* info);
+
+// Cholesky and LDLT interface
+#ifdef _MSC_VER
+#define spotrf_ SPOTRF
+#define spotrs_ SPOTRS
+#define spstrf_ SPSTRF
+#define ssytrf_ SSYTRF
+#define ssytrs_ SSYTRS
+
+#define dpotrf_ DPOTRF
+#define dpotrs_ DPOTRS
+#define dpstrf_ DPSTRF
+#define dsytrf_ DSYTRF
+#define dsytrs_ DSYTRS
+
+#define cpotrf_ CPOTRF
+#define cpotrs_ CPOTRS
+#define cpstrf_ CPSTRF
+#define csytrf_ CSYTRF
+#define csytrs_ CSYTRS
+#define chetrf_ CHETRF
+#define chetrs_ CHETRS
+
+#define zpotrf_ ZPOTRF
+#define zpotrs_ ZPOTRS
+#define zpstrf_ ZPSTRF
+#define zsytrf_ ZSYTRF
+#define zsytrs_ ZSYTRS
+#define zhetrf_ ZHETRF
+#define zhetrs_ ZHETRS
+#endif
+// float
+extern "C" void spotrf_(char* uplo, int* n, float* a, int* lda, int* info);
+extern "C" void spotrs_(char* uplo, int* n, int* nrhs, float* a, int* lda, float* b, int* ldb, int* info);
+extern "C" void spstrf_(char* uplo, int* n, float* a, int* lda, int* piv, int* rank, float* tol, float* work,
+                        int* info);
+extern "C" void ssytrf_(char* uplo, int* n, float* a, int* lda, int* ipiv, float* work, int* lwork, int* info);
+extern "C" void ssytrs_(char* uplo, int* n, int* nrhs, float* a, int* lda, int* ipiv, float* b, int* ldb, int* info);
+// double
+extern "C" void dpotrf_(char* uplo, int* n, double* a, int* lda, int* info);
+extern "C" void dpotrs_(char* uplo, int* n, int* nrhs, double* a, int* lda, double* b, int* ldb, int* info);
+extern "C" void dpstrf_(char* uplo, int* n, double* a, int* lda, int* piv, int* rank, double* tol, double* work,
+                        int* info);
+extern "C" void dsytrf_(char* uplo, int* n, double* a, int* lda, int* ipiv, double* work, int* lwork, int* info);
+extern "C" void dsytrs_(char* uplo, int* n, int* nrhs, double* a, int* lda, int* ipiv, double* b, int* ldb,
+                        int* info);
+// complex
+extern "C" void cpotrf_(char* uplo, int* n, float* a, int* lda, int* info);
+extern "C" void cpotrs_(char* uplo, int* n, int* nrhs, float* a, int* lda, float* b, int* ldb, int* info);
+extern "C" void cpstrf_(char* uplo, int* n, float* a, int* lda, int* piv, int* rank, float* tol, float* work,
+                        int* info);
+extern "C" void csytrf_(char* uplo, int* n, float* a, int* lda, int* ipiv, float* work, int* lwork, int* info);
+extern "C" void csytrs_(char* uplo, int* n, int* nrhs, float* a, int* lda, int* ipiv, float* b, int* ldb, int* info);
+extern "C" void chetrf_(char* uplo, int* n, float* a, int* lda, int* ipiv, float* work, int* lwork, int* info);
+extern "C" void chetrs_(char* uplo, int* n, int* nrhs, float* a, int* lda, int* ipiv, float* b, int* ldb, int* info);
+// double complex
+extern "C" void zpotrf_(char* uplo, int* n, double* a, int* lda, int* info);
+extern "C" void zpotrs_(char* uplo, int* n, int* nrhs, double* a, int* lda, double* b, int* ldb, int* info);
+extern "C" void zpstrf_(char* uplo, int* n, double* a, int* lda, int* piv, int* rank, double* tol, double* work,
+                        int* info);
+extern "C" void zsytrf_(char* uplo, int* n, double* a, int* lda, int* ipiv, double* work, int* lwork, int* info);
+extern "C" void zsytrs_(char* uplo, int* n, int* nrhs, double* a, int* lda, int* ipiv, double* b, int* ldb,
+                        int* info);
+extern "C" void zhetrf_(char* uplo, int* n, double* a, int* lda, int* ipiv, double* work, int* lwork, int* info);
+extern "C" void zhetrs_(char* uplo, int* n, int* nrhs, double* a, int* lda, int* ipiv, double* b, int* ldb,
+                        int* info);
+
+// Least squares interface
+#ifdef _MSC_VER
+#define sgels_  SGELS
+#define sgelsd_ SGELSD
+#define sgelsy_ SGELSY
+#define sormqr_ SORMQR
+#define strtrs_ STRTRS
+
+#define dgels_  DGELS
+#define dgelsd_ DGELSD
+#define dgelsy_ DGELSY
+#define dormqr_ DORMQR
+#define dtrtrs_ DTRTRS
+
+#define cgels_  CGELS
+#define cgelsd_ CGELSD
+#define cgelsy_ CGELSY
+#define cunmqr_ CUNMQR
+#define ctrtrs_ CTRTRS
+
+#define zgels_  ZGELS
+#define zgelsd_ ZGELSD
+#define zgelsy_ ZGELSY
+#define zunmqr_ ZUNMQR
+#define ztrtrs_ ZTRTRS
+#endif
+// float
+extern "C" void sgels_(char* trans, int* m, int* n, int* nrhs, float* a, int* lda, float* b, int* ldb, float* work,
+                       int* lwork, int* info);
+extern "C" void sgelsd_(int* m, int* n, int* nrhs, float* a, int* lda, float* b, int* ldb, float* s, float* rcond,
+                        int* rank, float* work, int* lwork, int* iwork, int* info);
+extern "C" void sgelsy_(int* m, int* n, int* nrhs, float* a, int* lda, float* b, int* ldb, int* jpvt, float* rcond,
+                        int* rank, float* work, int* lwork, int* info);
+extern "C" void sormqr_(char* side, char* trans, int* m, int* n, int* k, float* a, int* lda, float* tau, float* c,
+                        int* ldc, float* work, int* lwork, int* info);
+extern "C" void strtrs_(char* uplo, char* trans, char* diag, int* n, int* nrhs, float* a, int* lda, float* b, int* ldb,
+                        int* info);
+// double
+extern "C" void dgels_(char* trans, int* m, int* n, int* nrhs, double* a, int* lda, double* b, int* ldb, double* work,
+                       int* lwork, int* info);
+extern "C" void dgelsd_(int* m, int* n, int* nrhs, double* a, int* lda, double* b, int* ldb, double* s, double* rcond,
+                        int* rank, double* work, int* lwork, int* iwork, int* info);
+extern "C" void dgelsy_(int* m, int* n, int* nrhs, double* a, int* lda, double* b, int* ldb, int* jpvt, double* rcond,
+                        int* rank, double* work, int* lwork, int* info);
+extern "C" void dormqr_(char* side, char* trans, int* m, int* n, int* k, double* a, int* lda, double* tau, double* c,
+                        int* ldc, double* work, int* lwork, int* info);
+extern "C" void dtrtrs_(char* uplo, char* trans, char* diag, int* n, int* nrhs, double* a, int* lda, double* b,
+                        int* ldb, int* info);
+// complex
+extern "C" void cgels_(char* trans, int* m, int* n, int* nrhs, float* a, int* lda, float* b, int* ldb, float* work,
+                       int* lwork, int* info);
+extern "C" void cgelsd_(int* m, int* n, int* nrhs, float* a, int* lda, float* b, int* ldb, float* s, float* rcond,
+                        int* rank, float* work, int* lwork, float* rwork, int* iwork, int* info);
+extern "C" void cgelsy_(int* m, int* n, int* nrhs, float* a, int* lda, float* b, int* ldb, int* jpvt, float* rcond,
+                        int* rank, float* work, int* lwork, float* rwork, int* info);
+extern "C" void cunmqr_(char* side, char* trans, int* m, int* n, int* k, float* a, int* lda, float* tau, float* c,
+                        int* ldc, float* work, int* lwork, int* info);
+extern "C" void ctrtrs_(char* uplo, char* trans, char* diag, int* n, int* nrhs, float* a, int* lda, float* b, int* ldb,
+                        int* info);
+// double complex
+extern "C" void zgels_(char* trans, int* m, int* n, int* nrhs, double* a, int* lda, double* b, int* ldb, double* work,
+                       int* lwork, int* info);
+extern "C" void zgelsd_(int* m, int* n, int* nrhs, double* a, int* lda, double* b, int* ldb, double* s, double* rcond,
+                        int* rank, double* work, int* lwork, double* rwork, int* iwork, int* info);
+extern "C" void zgelsy_(int* m, int* n, int* nrhs, double* a, int* lda, double* b, int* ldb, int* jpvt, double* rcond,
+                        int* rank, double* work, int* lwork, double* rwork, int* info);
+extern "C" void zunmqr_(char* side, char* trans, int* m, int* n, int* k, double* a, int* lda, double* tau, double* c,
+                        int* ldc, double* work, int* lwork, int* info);
+extern "C" void ztrtrs_(char* uplo, char* trans, char* diag, int* n, int* nrhs, double* a, int* lda, double* b,
+                        int* ldb, int* info);
+
+// Norm and condition number interface
+#ifdef _MSC_VER
+#define slange_ SLANGE
+#define sgecon_ SGECON
+#define spocon_ SPOCON
+
+#define dlange_ DLANGE
+#define dgecon_ DGECON
+#define dpocon_ DPOCON
+
+#define clange_ CLANGE
+#define cgecon_ CGECON
+#define cpocon_ CPOCON
+
+#define zlange_ ZLANGE
+#define zgecon_ ZGECON
+#define zpocon_ ZPOCON
+#endif
+// float
+extern "C" float slange_(char* norm, int* m, int* n, float* a, int* lda, float* work);
+extern "C" void sgecon_(char* norm, int* n, float* a, int* lda, float* anorm, float* rcond, float* work, int* iwork,
+                        int* info);
+extern "C" void spocon_(char* uplo, int* n, float* a, int* lda, float* anorm, float* rcond, float* work, int* iwork,
+                        int* info);
+// double
+extern "C" double dlange_(char* norm, int* m, int* n, double* a, int* lda, double* work);
+extern "C" void dgecon_(char* norm, int* n, double* a, int* lda, double* anorm, double* rcond, double* work, int* iwork,
+                        int* info);
+extern "C" void dpocon_(char* uplo, int* n, double* a, int* lda, double* anorm, double* rcond, double* work, int* iwork,
+                        int* info);
+// complex
+extern "C" float clange_(char* norm, int* m, int* n, float* a, int* lda, float* work);
+extern "C" void cgecon_(char* norm, int* n, float* a, int* lda, float* anorm, float* rcond, float* work, float* rwork,
+                        int* info);
+extern "C" void cpocon_(char* uplo, int* n, float* a, int* lda, float* anorm, float* rcond, float* work, float* rwork,
+                        int* info);
+// double complex
+extern "C" double zlange_(char* norm, int* m, int* n, double* a, int* lda, double* work);
+extern "C" void zgecon_(char* norm, int* n, double* a, int* lda, double* anorm, double* rcond, double* work,
+                        double* rwork, int* info);
+extern "C" void zpocon_(char* uplo, int* n, double* a, int* lda, double* anorm, double* rcond, double* work,
+                        double* rwork, int* info);
+
+// Generalized eigenvalues and Schur interface
+#ifdef _MSC_VER
+#define sggev_  SGGEV
+#define sgges_  SGGES
+#define ssygvd_ SSYGVD
+
+#define dggev_  DGGEV
+#define dgges_  DGGES
+#define dsygvd_ DSYGVD
+
+#define cggev_  CGGEV
+#define cgges_  CGGES
+#define chegvd_ CHEGVD
+
+#define zggev_  ZGGEV
+#define zgges_  ZGGES
+#define zhegvd_ ZHEGVD
+#endif
+// float
+extern "C" void sggev_(char* jobvl, char* jobvr, int* n, float* a, int* lda, float* b, int* ldb, float* alphar,
+                       float* alphai, float* beta, float* vl, int* ldvl, float* vr, int* ldvr, float* work, int* lwork,
+                       int* info);
+extern "C" void sgges_(char* jobvsl, char* jobvsr, char* sort, int (*selctg)(float*, float*, float*), int* n, float* a,
+                       int* lda, float* b, int* ldb, int* sdim, float* alphar, float* alphai, float* beta, float* vsl,
+                       int* ldvsl, float* vsr, int* ldvsr, float* work, int* lwork, int* bwork, int* info);
+extern "C" void ssygvd_(int* itype, char* jobz, char* uplo, int* n, float* a, int* lda, float* b, int* ldb, float* w,
+                        float* work, int* lwork, int* iwork, int* liwork, int* info);
+// double
+extern "C" void dggev_(char* jobvl, char* jobvr, int* n, double* a, int* lda, double* b, int* ldb, double* alphar,
+                       double* alphai, double* beta, double* vl, int* ldvl, double* vr, int* ldvr, double* work,
+                       int* lwork, int* info);
+extern "C" void dgges_(char* jobvsl, char* jobvsr, char* sort, int (*selctg)(double*, double*, double*), int* n,
+                       double* a, int* lda, double* b, int* ldb, int* sdim, double* alphar, double* alphai,
+                       double* beta, double* vsl, int* ldvsl, double* vsr, int* ldvsr, double* work, int* lwork,
+                       int* bwork, int* info);
+extern "C" void dsygvd_(int* itype, char* jobz, char* uplo, int* n, double* a, int* lda, double* b, int* ldb,
+                        double* w, double* work, int* lwork, int* iwork, int* liwork, int* info);
+// complex
+extern "C" void cggev_(char* jobvl, char* jobvr, int* n, float* a, int* lda, float* b, int* ldb, float* alpha,
+                       float* beta, float* vl, int* ldvl, float* vr, int* ldvr, float* work, int* lwork, float* rwork,
+                       int* info);
+extern "C" void cgges_(char* jobvsl, char* jobvsr, char* sort, int (*selctg)(float*, float*), int* n, float* a,
+                       int* lda, float* b, int* ldb, int* sdim, float* alpha, float* beta, float* vsl, int* ldvsl,
+                       float* vsr, int* ldvsr, float* work, int* lwork, float* rwork, int* bwork, int* info);
+extern "C" void chegvd_(int* itype, char* jobz, char* uplo, int* n, float* a, int* lda, float* b, int* ldb, float* w,
+                        float* work, int* lwork, float* rwork, int* lrwork, int* iwork, int* liwork, int* info);
+// double complex
+extern "C" void zggev_(char* jobvl, char* jobvr, int* n, double* a, int* lda, double* b, int* ldb, double* alpha,
+                       double* beta, double* vl, int* ldvl, double* vr, int* ldvr, double* work, int* lwork,
+                       double* rwork, int* info);
+extern "C" void zgges_(char* jobvsl, char* jobvsr, char* sort, int (*selctg)(double*, double*), int* n, double* a,
+                       int* lda, double* b, int* ldb, int* sdim, double* alpha, double* beta, double* vsl, int* ldvsl,
+                       double* vsr, int* ldvsr, double* work, int* lwork, double* rwork, int* bwork, int* info);
+extern "C" void zhegvd_(int* itype, char* jobz, char* uplo, int* n, double* a, int* lda, double* b, int* ldb,
+                        double* w, double* work, int* lwork, double* rwork, int* lrwork, int* iwork, int* liwork,
+                        int* info);
@@ -17,6 +17,9 @@ PYBIND11_MODULE(cpp_nn_py, m)
     py::class_<nn::ANN_MLP_GA<float>>(m, "ANN_MLP_GA_float")
         .def(py::init<>())
         .def(py::init<std::vector<size_t>, int, size_t, size_t, size_t, bool>())
+        .def(py::init<std::vector<size_t>, int, size_t, size_t, size_t, bool, size_t>(), py::arg("size"),
+             py::arg("seed"), py::arg("populationSize"), py::arg("topPerformersSize"), py::arg("activationFunction"),
+             py::arg("bGenerateMixed"), py::arg("blocksNb"))
 
         .def("PrintNetworkInfo", &nn::ANN_MLP_GA<float>::PrintNetworkInfo)
         .def("PrintBiases", &nn::ANN_MLP_GA<float>::PrintBiases)
@@ -47,12 +50,22 @@ PYBIND11_MODULE(cpp_nn_py, m)
         .def("TestGA", &nn::ANN_MLP_GA<float>::TestGA)
         .def("SetMixed", &nn::ANN_MLP_GA<float>::SetMixed)
         .def("GetMixed", &nn::ANN_MLP_GA<float>::GetMixed)
+        .def("SetBlocksNb", &nn::ANN_MLP_GA<float>::SetBlocksNb,
+             "Maximum number of parallel blocks of the population in TrainGA (0 for one per core), the blocks run "
+             "on a shared pool of one thread per core",
+             py::arg("blocksNb"))
+        .def("GetBlocksNb", &nn::ANN_MLP_GA<float>::GetBlocksNb)
+        .def("SetStacked", &nn::ANN_MLP_GA<float>::SetStacked)
+        .def("GetStacked", &nn::ANN_MLP_GA<float>::GetStacked)
         .def("CreatePopulation", &nn::ANN_MLP_GA<float>::CreatePopulation);
 
     // expose ANN_MLP_GA<double> to Python
     py::class_<nn::ANN_MLP_GA<double>>(m, "ANN_MLP_GA_double")
         .def(py::init<>())
         .def(py::init<std::vector<size_t>, int, size_t, size_t, size_t, bool>())
+        .def(py::init<std::vector<size_t>, int, size_t, size_t, size_t, bool, size_t>(), py::arg("size"),
+             py::arg("seed"), py::arg("populationSize"), py::arg("topPerformersSize"), py::arg("activationFunction"),
+             py::arg("bGenerateMixed"), py::arg("blocksNb"))
 
         .def("PrintNetworkInfo", &nn::ANN_MLP_GA<double>::PrintNetworkInfo)
         .def("PrintBiases", &nn::ANN_MLP_GA<double>::PrintBiases)
@@ -83,5 +96,12 @@ PYBIND11_MODULE(cpp_nn_py, m)
         .def("TestGA", &nn::ANN_MLP_GA<double>::TestGA)
         .def("SetMixed", &nn::ANN_MLP_GA<double>::SetMixed)
         .def("GetMixed", &nn::ANN_MLP_GA<double>::GetMixed)
+        .def("SetBlocksNb", &nn::ANN_MLP_GA<double>::SetBlocksNb,
+             "Maximum number of parallel blocks of the population in TrainGA (0 for one per core), the blocks run "
+             "on a shared pool of one thread per core",
+             py::arg("blocksNb"))
+        .def("GetBlocksNb", &nn::ANN_MLP_GA<double>::GetBlocksNb)
+        .def("SetStacked", &nn::ANN_MLP_GA<double>::SetStacked)
+        .def("GetStacked", &nn::ANN_MLP_GA<double>::GetStacked)
         .def("CreatePopulation", &nn::ANN_MLP_GA<double>::CreatePopulation);
 }
@@ -10,6 +10,9 @@
 #include "math/algebra/matrix_operations.h"
 #include "ann_mlp_ga_v1.h"
 #include "la_blas_mult.h"
+#include "la_thread_pool.h"
+
+#define T_C(x) static_cast<T>(x)
 
 namespace nnflags
 {
@@ -22,8 +25,8 @@ template <typename T> nn::ANN_MLP_GA<T>::ANN_MLP_GA() {}
 
 template <typename T>
 nn::ANN_MLP_GA<T>::ANN_MLP_GA(std::vector<size_t> size, int seed, size_t populationSize, size_t topPerformersSize,
-                              size_t activationFunction, bool bGenerateMixed)
-    : ANN_MLP<T>(size, seed, populationSize, topPerformersSize, activationFunction)
+                              size_t activationFunction, bool bGenerateMixed, size_t blocksNb)
+    : ANN_MLP<T>(size, seed, populationSize, topPerformersSize, activationFunction), nParallelBlocks(blocksNb)
 {
     flags = bGenerateMixed ? flags | nnflags::NNFlags::MIXED_POPULATION : flags & ~nnflags::NNFlags::MIXED_POPULATION;
     AllocatePopulation();
@@ -82,7 +85,6 @@ void nn::ANN_MLP_GA<T>::TrainGA(const std::vector<std::vector<T>>& data, const s
 {
     std::random_device rd;
     std::vector<size_t> s_(data.size()), f_(nPopSize), v_(nPopSize);
-    std::vector<size_t>::iterator it_;
     std::mt19937 g_{rd()};
     void (*pAct)(T*, size_t) = nullptr;
     switch (act)
@@ -92,9 +94,19 @@ void nn::ANN_MLP_GA<T>::TrainGA(const std::vector<std::vector<T>>& data, const s
     default: throw std::invalid_argument("Unknown activation function");
     }
 
-    // Allocate the memory for the computed activations
-    std::vector<la::Matrix<T>> na_;
-    for (size_t i = 0; i < nLayers; ++i) { na_.push_back(la::Matrix<T>(vSize[i], 1)); }
+    // the samples of the batch are the columns of x_ and each layer of a member is evaluated on the whole batch with a
+    // single GEMM, the bias, the activation and the scoring are then applied column by column while it is in cache
+    const size_t nBatch = std::min(s_.size(), BatchSize), nIn = vSize[0], nHidden = vSize[1];
+    const size_t nBlocks = nParallelBlocks ? nParallelBlocks : la::ParallelBlocksNb();
+    la::Matrix<T> x_{nIn, nBatch};
+    // activations of the members evaluated by each block, allocated once for all the generations
+    std::vector<std::vector<la::Matrix<T>>> na_(nBlocks);
+    for (size_t b = 0; b < nBlocks; ++b)
+        for (size_t l = 1; l < nLayers; ++l) na_[b].push_back(la::Matrix<T>{vSize[l], nBatch});
+    // stacked evaluation: the first layer weights of all the members are copied row-wise in w1_ so that the first
+    // layer of the whole population is a single GEMM, z1_ (population x hidden x batch) is then shared by the blocks
+    const size_t nStack = bStacked ? nPopSize * nHidden : 0;
+    la::Matrix<T> w1_{nStack, bStacked ? nIn : 0}, z1_{nStack, bStacked ? nBatch : 0};
 
     for (size_t i = 0; i < nGenerations; ++i)
     {
@@ -107,35 +119,64 @@ void nn::ANN_MLP_GA<T>::TrainGA(const std::vector<std::vector<T>>& data, const s
         }
         // create the population
         CreatePopulation();
-        // reset the fitness vector
-        std::fill(f_.begin(), f_.end(), 0);
-        // all population is tested vs the reference
-        for (size_t j = 0; j < std::min(s_.size(), BatchSize); ++j)
+        // gather the batch
+        for (size_t j = 0; j < nBatch; ++j)
         {
-            it_ = s_.begin() + (ptrdiff_t)j;
-            // first activation layer - input data. Is never overwritten and therefore can be allocated only once
-            na_[0].assign(data[*it_]);
+            assert(data[s_[j]].size() == nIn);
+            std::copy(data[s_[j]].begin(), data[s_[j]].end(), x_.data().begin() + (ptrdiff_t)(j * nIn));
+        }
+        if (bStacked)
+        {
+            T* w1 = w1_.data().data();
             for (size_t k = 0; k < nPopSize; ++k)
             {
-                // first activation layer - input data.
-                vNaPop[k][0].assign(data[*it_]);
-                // feedforward the network
+                const T* w = vWeightsPop[k][0].data().data();
+                for (size_t c = 0; c < nIn; ++c)
+                    std::copy(w + c * nHidden, w + (c + 1) * nHidden, w1 + c * nStack + k * nHidden);
+            }
+            la::Gemm('N', 'N', nStack, nBatch, nIn, T_C(1), w1, nStack, x_.data().data(), nIn, T_C(0),
+                     z1_.data().data(), nStack);
+        }
+        // all population is tested vs the reference, the members are independent so they are split between the
+        // threads. The fitness of a member is only counted by the thread evaluating it, therefore the result does not
+        // depend on the number of threads.
+        la::ParallelFor(0, nPopSize, [&](const size_t first, const size_t last, const size_t b) {
+            for (size_t k = first; k < last; ++k)
+            {
+                const T* a = x_.data().data();
+                size_t lda = nIn, f = 0;
                 for (size_t l = 1; l < nLayers; ++l)
                 {
-                    la::MatMultVec(vNaPop[k][l], vWeightsPop[k][l - 1], vNaPop[k][l - 1]);
-                    vNaPop[k][l] += vBiasesPop[k][l - 1];
-                    nn::ActFunc(vNaPop[k][l], pAct);
+                    const size_t m = vSize[l];
+                    T* z           = na_[b][l - 1].data().data();
+                    size_t ldz     = m;
+                    if (l == 1 && bStacked)
+                    {
+                        // rows of the member in the stacked product
+                        z   = z1_.data().data() + k * nHidden;
+                        ldz = nStack;
+                    }
+                    else la::Gemm('N', 'N', m, nBatch, vSize[l - 1], T_C(1), vWeightsPop[k][l - 1].data().data(), m, a,
+                                  lda, T_C(0), z, ldz);
+                    const T* bias = vBiasesPop[k][l - 1].data().data();
+                    for (size_t j = 0; j < nBatch; ++j)
+                    {
+                        T* zj = z + j * ldz;
+                        for (size_t r = 0; r < m; ++r) zj[r] += bias[r];
+                        pAct(zj, m);
+                        // compute the fitness (+1 if the result is correct)
+                        if (l == nLayers - 1)
+                        {
+                            const size_t maxPos = static_cast<size_t>(std::distance(zj, std::max_element(zj, zj + m)));
+                            if (reference[s_[j]][maxPos] == 1) f++;
+                        }
+                    }
+                    a   = z;
+                    lda = ldz;
                 }
-                // compute the fitness (+1 if the result is correct)
-                typename std::vector<T>& res                 = vNaPop[k][nLayers - 1].data();
-                const typename std::vector<T>::iterator it2_ = std::max_element(res.begin(), res.end());
-                const ptrdiff_t maxPos                       = std::distance(res.begin(), it2_);
-                if (reference[j][static_cast<size_t>(maxPos)] == 1) f_[k]++;
+                f_[k] = f;
             }
-
-            // update to the next sample
-            it_++;
-        }
+        }, nBlocks);
         // sort in descending order and store the index
         std::iota(v_.begin(), v_.end(), 0);
         std::sort(v_.begin(), v_.end(), [&](size_t i, size_t j) { return f_[i] > f_[j]; });
@@ -205,16 +246,12 @@ template <typename T> void nn::ANN_MLP_GA<T>::AllocatePopulation()
     {
         vBiasesPop.push_back(std::vector<la::Matrix<T>>{});
         vWeightsPop.push_back(std::vector<la::Matrix<T>>{});
-        vNaPop.push_back(std::vector<la::Matrix<T>>{});
-
-        vNaPop[i].push_back(la::Matrix<T>(vSize[0]));
 
         for (size_t j = 1; j < nLayers; ++j)
         {
             const size_t nRows = vSize[j], nCols = vSize[j - 1];
             vBiasesPop[i].push_back(la::Matrix<T>{nRows});
             vWeightsPop[i].push_back(la::Matrix<T>{nRows, nCols});
-            vNaPop[i].push_back(la::Matrix<T>(nRows));
         }
     }
 }
@@ -373,3 +410,5 @@ template <typename T> bool nn::ANN_MLP_GA<T>::GetMixed()
 // Explicit template instantiation
 template class nn::ANN_MLP_GA<float>;
 template class nn::ANN_MLP_GA<double>;
+
+#undef T_C
@@ -32,7 +32,8 @@ namespace nn
       public:
         ANN_MLP_GA();
         ANN_MLP_GA(std::vector<size_t> size, int seed = 4041, size_t populationSize = 130,
-                   size_t topPerformersSize = 10, size_t activationFunction = SIGMOID, bool bGenerateMixed = false);
+                   size_t topPerformersSize = 10, size_t activationFunction = SIGMOID, bool bGenerateMixed = false,
+                   size_t blocksNb = 0);
 
         void UpdateWeightsAndBiases(const std::vector<size_t>& v_);
 
@@ -46,6 +47,19 @@ namespace nn
         void SetMixed(bool b);
         bool GetMixed();
 
+        // number of blocks the population is split in by TrainGA, 0 uses la::ParallelBlocksNb(). The blocks run on the
+        // shared pool of one thread per core so this is a maximum degree of parallelism, not a thread count, and each
+        // block allocates its own activation buffers.
+        inline void SetBlocksNb(size_t n) { nParallelBlocks = n; }
+
+        inline size_t GetBlocksNb() const { return nParallelBlocks; }
+
+        // evaluate the first layer of the whole population with a single GEMM in TrainGA, faster for small hidden
+        // layers but it needs a population x hidden x batch buffer
+        inline void SetStacked(bool b) { bStacked = b; }
+
+        inline bool GetStacked() const { return bStacked; }
+
         void CreatePopulation(bool bKeepPrevious = true);
 
         void Serialize(const std::string& fname);
@@ -57,7 +71,8 @@ namespace nn
         void CreatePopulationMixed(bool bKeepPrevious);
         std::vector<std::vector<la::Matrix<T>>> vBiasesPop{};
         std::vector<std::vector<la::Matrix<T>>> vWeightsPop{};
-        std::vector<std::vector<la::Matrix<T>>> vNaPop{};
+        size_t nParallelBlocks{0};
+        bool bStacked{false};
     };
 
 } // namespace nn
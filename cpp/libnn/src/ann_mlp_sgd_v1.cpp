@@ -9,11 +9,23 @@
 #include <iostream>
 #include <numeric>
 #include <random>
+#include <typeinfo>
 #include <assert.h>
+#include "hdf5/hdf5_ext.h"
 #include "math/algebra/matrix_operations.h"
 #include "ann_mlp_sgd_v1.h"
 #include "la_blas_mult.h"
 
+#define T_C(x) static_cast<T>(x)
+
+namespace nnflags
+{
+    enum NNSGDFlags : int {
+        // the state of the optimizer is serialized
+        OPTIMIZER_STATE = 1 << 1,
+    };
+}
+
 template <typename T> nn::ANN_MLP_SGD<T>::ANN_MLP_SGD() {}
 
 template <typename T>
@@ -51,105 +63,114 @@ void nn::ANN_MLP_SGD<T>::TrainSGD(const std::vector<std::vector<T>>& data, const
     (void)pAct;
     (void)pDAct;
 
-    // allocate temporary memory for Gradient Descent
+    // allocate temporary memory for Gradient Descent, each column of the matrices is a sample of the mini-batch
     // na_ store the activation
-    // nb_, nw_ store the nabla of the gradient
-    // dnb_, dnw_ store the gradient of the nabla of the gradient
-    // dno_ store the delta for backpropagation (same size as the biases)
-    std::vector<la::Matrix<T>> na_, nzv_, dno_, dno2_, nb_, nw_, dnb_, dnw_, wt_;
+    // nzv_ store the weighted input, then the derivative of the activation
+    // dno_ store the delta for backpropagation (same rows as the biases)
+    // ny_ store the reference of the mini-batch
+    // one_ is a vector of ones summing the deltas of the mini-batch into the biases
+    std::vector<la::Matrix<T>> na_, nzv_, dno_;
+    const size_t nOut = vSize[nLayers - 1];
+    la::Matrix<T> ny_{nOut, miniBatchSize}, one_{miniBatchSize, 1};
+    std::fill(one_.data().begin(), one_.data().end(), T_C(1));
 
-    na_.push_back(la::Matrix<T>(vSize[0], 1));
+    na_.push_back(la::Matrix<T>(vSize[0], miniBatchSize));
 
     for (size_t i = 1; i < nLayers; ++i)
     {
-        const size_t nRows = vSize[i], nCols = vSize[i - 1];
-        na_.push_back(la::Matrix<T>{nRows, 1});
-        nzv_.push_back(la::Matrix<T>{nRows, 1});
-        dno_.push_back(la::Matrix<T>{nRows, 1});
-        dno2_.push_back(la::Matrix<T>{nRows, 1});
-        nb_.push_back(la::Matrix<T>{nRows, 1});
-        dnb_.push_back(la::Matrix<T>{nRows, 1});
-        nw_.push_back(la::Matrix<T>{nRows, nCols});
-        dnw_.push_back(la::Matrix<T>{nRows, nCols});
-        wt_.push_back(la::Matrix<T>{nCols, nRows});
+        const size_t nRows = vSize[i];
+        na_.push_back(la::Matrix<T>{nRows, miniBatchSize});
+        nzv_.push_back(la::Matrix<T>{nRows, miniBatchSize});
+        dno_.push_back(la::Matrix<T>{nRows, miniBatchSize});
     }
 
+    // with an optimizer the gradients of the mini-batch are stored in nw_ and nb_ before the optimizer updates the
+    // parameters, with plain SGD the update is fused in the GEMM computing the gradient
+    std::vector<la::Matrix<T>> nw_, nb_;
+    if (pOpt)
+    {
+        for (size_t i = 1; i < nLayers; ++i)
+        {
+            nw_.push_back(la::Matrix<T>{vSize[i], vSize[i - 1]});
+            nb_.push_back(la::Matrix<T>{vSize[i], 1});
+        }
+        pOpt->Allocate(ParamsSizes());
+    }
+
+    // the gradient is averaged over the mini-batch
+    const T scale = T_C(1. / static_cast<double>(miniBatchSize)), alpha = T_C(-eta) * scale;
+
     for (size_t i = 0; i < epochs; ++i)
     {
         // populate and shuffle the interator of integers for training
         std::iota(s_.begin(), s_.end(), 0);
         std::shuffle(s_.begin(), s_.end(), g_);
-        for (size_t j = 0; j < s_.size() - miniBatchSize; j += miniBatchSize)
+        for (size_t j = 0; j + miniBatchSize < s_.size(); j += miniBatchSize)
         {
-            // process a mini-batch of data
+            // gather the mini-batch of data and reference into the columns of na_[0] and ny_
             it_ = s_.begin() + (long)j;
-            // Zeros the Gradient
-            for (size_t l = 0; l < nLayers - 1; ++l)
+            for (size_t k = 0; k < miniBatchSize; ++k, ++it_)
             {
-                nb_[l].Zeros();
-                nw_[l].Zeros();
+                assert(data[*it_].size() == vSize[0] && reference[*it_].size() == nOut);
+                std::copy(data[*it_].begin(), data[*it_].end(), na_[0].data().begin() + (long)(k * vSize[0]));
+                std::copy(reference[*it_].begin(), reference[*it_].end(), ny_.data().begin() + (long)(k * nOut));
             }
 
-            for (size_t k = 0; k < miniBatchSize; ++k)
+            // forward pass, Z = W * A + b with the bias broadcast to each column before the product
+            for (size_t l = 1; l < nLayers; ++l)
             {
-                for (size_t l = 0; l < nLayers - 1; ++l)
-                {
-                    nzv_[l].Zeros();
-                    dnb_[l].Zeros();
-                    dnw_[l].Zeros();
-                    // as the weights are not updated, the transpose can be computed here
-                    la::MatTranspose(wt_[l], vWeights[0][l]);
-                }
+                const size_t m = vSize[l], n = vSize[l - 1];
+                const T* b     = vBiases[0][l - 1].data().data();
+                T* z           = nzv_[l - 1].data().data();
+                for (size_t k = 0; k < miniBatchSize; ++k) std::copy(b, b + m, z + k * m);
+                la::Gemm('N', 'N', m, miniBatchSize, n, T_C(1), vWeights[0][l - 1].data().data(), m,
+                         na_[l - 1].data().data(), n, T_C(1), z, m);
+                nn::ActFunc(na_[l], nzv_[l - 1], pAct);
+            }
 
-                // first activation layer - input data
-                na_[0].assign(data[*it_]);
-                for (size_t j = 1; j < nLayers; ++j)
-                {
-                    // with MSVC and O2 / Ox the following MatMultVec with BLAS DGEMV is returning nan in nzv_[j - 1].
-                    // O1 is necessary to avoid wrong results
-                    la::MatMultVec(nzv_[j - 1], vWeights[0][j - 1], na_[j - 1]);
-                    nzv_[j - 1] += vBiases[0][j - 1];
-                    nn::ActFunc(na_[j], nzv_[j - 1], pAct);
-                }
-                {
-                    // compute delta from the output layer
-                    const size_t osize = dno_.size() - 1;
-                    dno2_[osize]       = na_[osize + 1];
-                    dno2_[osize] -= reference[*it_];
-                    nn::ActFunc(nzv_[osize], pDAct);
-                    MatHadamard(dno_[osize], dno2_[osize], nzv_[osize]);
-                    dnb_[osize] = dno_[osize];
-                    MatOuter(dnw_[osize], dno_[osize], na_[osize]);
-                }
+            {
+                // compute delta from the output layer
+                const size_t osize = dno_.size() - 1;
+                nn::ActFunc(nzv_[osize], pDAct);
+                const std::vector<T>& a  = na_[osize + 1].data();
+                const std::vector<T>& y  = ny_.data();
+                const std::vector<T>& dz = nzv_[osize].data();
+                std::vector<T>& d        = dno_[osize].data();
+                for (size_t k = 0; k < d.size(); ++k) d[k] = (a[k] - y[k]) * dz[k];
+            }
 
-                for (size_t l = nLayers - 2; l > 0; --l)
+            if (pOpt) pOpt->Step();
+            // backpropagation, the update of a layer is applied after its weights have propagated the delta
+            for (size_t l = nLayers - 1; l > 0; --l)
+            {
+                const size_t m = vSize[l], n = vSize[l - 1];
+                if (l > 1)
                 {
-                    nn::ActFunc(nzv_[l - 1], pDAct);
-                    // the transpose is stored at the beginning of the minibatch
-                    la::MatMultVec(dno2_[l - 1], wt_[l], dno_[l]);
-                    MatHadamard(dno_[l - 1], dno2_[l - 1], nzv_[l - 1]);
-                    dnb_[l - 1] = dno_[l - 1];
-                    MatOuter(dnw_[l - 1], dno_[l - 1], na_[l - 1]);
+                    nn::ActFunc(nzv_[l - 2], pDAct);
+                    la::Gemm('T', 'N', n, miniBatchSize, m, T_C(1), vWeights[0][l - 1].data().data(), m,
+                             dno_[l - 1].data().data(), m, T_C(0), dno_[l - 2].data().data(), n);
+                    std::vector<T>& d        = dno_[l - 2].data();
+                    const std::vector<T>& dz = nzv_[l - 2].data();
+                    for (size_t k = 0; k < d.size(); ++k) d[k] *= dz[k];
                 }
-
-                // update nabla
-                for (size_t l = 0; l < (nLayers - 1); ++l)
+                if (pOpt)
                 {
-                    nw_[l] += dnw_[l];
-                    nb_[l] += dnb_[l];
+                    // gradients delta * A^T / batch and delta * 1 / batch, then one pass of the optimizer per tensor
+                    la::Gemm('N', 'T', m, n, miniBatchSize, scale, dno_[l - 1].data().data(), m,
+                             na_[l - 1].data().data(), n, T_C(0), nw_[l - 1].data().data(), m);
+                    la::Gemm('N', 'N', m, 1, miniBatchSize, scale, dno_[l - 1].data().data(), m, one_.data().data(),
+                             miniBatchSize, T_C(0), nb_[l - 1].data().data(), m);
+                    pOpt->Update(2 * (l - 1), vWeights[0][l - 1].data().data(), nw_[l - 1].data().data(), m * n,
+                                 T_C(eta));
+                    pOpt->Update(2 * (l - 1) + 1, vBiases[0][l - 1].data().data(), nb_[l - 1].data().data(), m,
+                                 T_C(eta));
+                    continue;
                 }
-
-                // update to the next sample
-                it_++;
-            }
-
-            // update bias and weights
-            for (size_t l = 0; l < (nLayers - 1); ++l)
-            {
-                nw_[l] *= (eta / static_cast<double>(miniBatchSize));
-                vWeights[0][l] -= nw_[l];
-                nb_[l] *= (eta / static_cast<double>(miniBatchSize));
-                vBiases[0][l] -= nb_[l];
+                // W -= eta / batch * delta * A^T and b -= eta / batch * delta * 1
+                la::Gemm('N', 'T', m, n, miniBatchSize, alpha, dno_[l - 1].data().data(), m, na_[l - 1].data().data(),
+                         n, T_C(1), vWeights[0][l - 1].data().data(), m);
+                la::Gemm('N', 'N', m, 1, miniBatchSize, alpha, dno_[l - 1].data().data(), m, one_.data().data(),
+                         miniBatchSize, T_C(1), vBiases[0][l - 1].data().data(), m);
             }
         }
 
@@ -199,6 +220,97 @@ int nn::ANN_MLP_SGD<T>::TestSGD(const std::vector<std::vector<T>>& data, const s
     return iCorrect;
 }
 
+template <typename T>
+void nn::ANN_MLP_SGD<T>::SetOptimizer(size_t type, double beta1, double beta2, double epsilon, double weightDecay)
+{
+    pOpt = MakeOptimizer<T>(type, beta1, beta2, epsilon, weightDecay);
+}
+
+template <typename T> void nn::ANN_MLP_SGD<T>::SetOptimizer(std::unique_ptr<Optimizer<T>> optimizer)
+{
+    pOpt = std::move(optimizer);
+}
+
+template <typename T> size_t nn::ANN_MLP_SGD<T>::GetOptimizer() const
+{
+    return pOpt ? pOpt->Type() : SGD;
+}
+
+template <typename T> std::vector<size_t> nn::ANN_MLP_SGD<T>::ParamsSizes() const
+{
+    // weights and biases of each layer, in the order of the optimizer tensors
+    std::vector<size_t> sizes_;
+    for (size_t i = 1; i < nLayers; ++i)
+    {
+        sizes_.push_back(vSize[i] * vSize[i - 1]);
+        sizes_.push_back(vSize[i]);
+    }
+    return sizes_;
+}
+
+template <typename T> void nn::ANN_MLP_SGD<T>::Serialize(const std::string& fname)
+{
+    // only the optimizers of MakeOptimizer can be rebuilt by Deserialize
+    if (pOpt)
+    {
+        const size_t type_ = pOpt->Type();
+        const std::unique_ptr<Optimizer<T>> pRef_ =
+            type_ >= MOMENTUM && type_ <= ADAMW ? MakeOptimizer<T>(type_) : nullptr;
+        const Optimizer<T>& opt_ = *pOpt;
+        if (!pRef_ || typeid(opt_) != typeid(*pRef_))
+            throw std::runtime_error("Optimizer not serializable nn::ANN_MLP_SGD::Serialize.");
+    }
+    flags = pOpt ? flags | nnflags::NNSGDFlags::OPTIMIZER_STATE : flags & ~nnflags::NNSGDFlags::OPTIMIZER_STATE;
+    // called the super class
+    nn::ANN_MLP<T>::Serialize(fname);
+    if (!pOpt) return;
+    std::lock_guard<std::mutex> lock(mtx);
+    h5::H5ppWriter h5(fname);
+    const std::string s_ = "NN/" + this->GetName() + "/optimizer/";
+    h5.write(s_ + "type", pOpt->Type());
+    h5.write(s_ + "params", pOpt->GetParams());
+    h5.write(s_ + "nSteps", pOpt->Steps());
+    std::vector<std::vector<T>>& state_ = pOpt->State();
+    h5.write(s_ + "nState", state_.size());
+    for (size_t i = 0; i < state_.size(); ++i) h5.write(s_ + "state[" + std::to_string(i) + "]", state_[i]);
+}
+
+template <typename T> void nn::ANN_MLP_SGD<T>::Deserialize(const std::string& fname)
+{
+    // called the super class
+    nn::ANN_MLP<T>::Deserialize(fname);
+    // the optimizer set by SetOptimizer is kept when the file has no optimizer state
+    if (!(flags & nnflags::NNSGDFlags::OPTIMIZER_STATE)) return;
+    std::lock_guard<std::mutex> lock(mtx);
+    h5::H5ppReader h5(fname);
+    const std::string s_ = "NN/" + this->GetName() + "/optimizer/";
+    size_t type_, nSteps_, nState_;
+    std::vector<double> params_;
+    h5.read(s_ + "type", type_);
+    h5.read(s_ + "params", params_);
+    h5.read(s_ + "nSteps", nSteps_);
+    h5.read(s_ + "nState", nState_);
+    if (params_.size() != 4) throw std::runtime_error("Invalid optimizer parameters nn::ANN_MLP_SGD::Deserialize.");
+    if (type_ < MOMENTUM || type_ > ADAMW)
+        throw std::runtime_error("Invalid optimizer type nn::ANN_MLP_SGD::Deserialize.");
+    std::unique_ptr<Optimizer<T>> pOpt_ = MakeOptimizer<T>(type_, params_[0], params_[1], params_[2], params_[3]);
+    pOpt_->Allocate(ParamsSizes());
+    std::vector<std::vector<T>>& state_ = pOpt_->State();
+    // the state is empty when the optimizer was saved before the first training step
+    if (nState_ != 0 && nState_ != state_.size())
+        throw std::runtime_error("Invalid optimizer state nn::ANN_MLP_SGD::Deserialize.");
+    for (size_t i = 0; i < nState_; ++i)
+        h5.read(s_ + "state[" + std::to_string(i) + "]", 1, [&](size_t n) {
+            if (n != state_[i].size())
+                throw std::runtime_error("Invalid optimizer state size nn::ANN_MLP_SGD::Deserialize.");
+            return state_[i].data();
+        });
+    pOpt_->Steps() = nSteps_;
+    pOpt           = std::move(pOpt_);
+}
+
 // Explicit template instantiation
 template class nn::ANN_MLP_SGD<float>;
 template class nn::ANN_MLP_SGD<double>;
+
+#undef T_C
@@ -8,8 +8,10 @@
 /************************/
 
 #include <iterator>
+#include <memory>
 #include <vector>
 #include "ann_mlp_v1.h"
+#include "optimizers.h"
 
 namespace nn
 {
@@ -25,6 +27,8 @@ namespace nn
         using ANN_MLP<T>::act;
         using ANN_MLP<T>::flags;
         using ANN_MLP<T>::mtx;
+        using ANN_MLP<T>::Serialize;
+        using ANN_MLP<T>::Deserialize;
 
       public:
         ANN_MLP_SGD();
@@ -34,7 +38,20 @@ namespace nn
 
         int TestSGD(const std::vector<std::vector<T>>& data, const std::vector<std::vector<T>>& reference);
 
+        // update rule of TrainSGD (OPT type or a user defined Optimizer), plain SGD by default. The state of the
+        // optimizer is kept between the calls of TrainSGD and stored by Serialize, which throws for a user defined
+        // Optimizer since Deserialize can only rebuild the OPT types.
+        void SetOptimizer(size_t type, double beta1 = 0.9, double beta2 = 0.999, double epsilon = 1e-8,
+                          double weightDecay = 0);
+        void SetOptimizer(std::unique_ptr<Optimizer<T>> optimizer);
+        size_t GetOptimizer() const;
+
+        void Serialize(const std::string& fname);
+        void Deserialize(const std::string& fname);
+
       private:
+        std::vector<size_t> ParamsSizes() const;
+        std::unique_ptr<Optimizer<T>> pOpt{};
     };
 
 } // namespace nn
@@ -24,6 +24,8 @@ namespace nn
 
         void SetName(const std::string& s) { sName = s; };
 
+        inline const std::string& GetName() const { return sName; }
+
         void SetEpochs(size_t n) { nEpochs = n; };
 
         void UpdateEpochs(size_t n = 1) { nEpochs += n; };
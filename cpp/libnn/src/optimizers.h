@@ -0,0 +1,205 @@
+#ifndef _OPTIMIZERS_H_D1AF9C50551C4C79B893FCD74CE37427_
+#define _OPTIMIZERS_H_D1AF9C50551C4C79B893FCD74CE37427_
+
+/************************/
+/*    optimizers.h      */
+/*    Version 1.0       */
+/*     2026/10/19       */
+/************************/
+
+#include <cmath>
+#include <memory>
+#include <stdexcept>
+#include <vector>
+
+#define T_C(x) static_cast<T>(x)
+
+namespace nn
+{
+    enum OPT : size_t { SGD = 0, MOMENTUM, NESTEROV, RMSPROP, ADAM, ADAMW };
+
+    // Update rule of the parameters of ANN_MLP_SGD. The parameter tensors (weights and biases of each layer) are
+    // numbered in the order they are given to Allocate, each one has StateNb() state buffers of its size allocated
+    // once, and Update applies the rule to a tensor in a single pass with the gradient averaged on the minibatch.
+    // A new rule derives from this class and implements Type, StateNb and Update.
+    template <typename T> class Optimizer
+    {
+      public:
+        Optimizer(double beta1, double beta2, double epsilon, double weightDecay)
+            : vParams{beta1, beta2, epsilon, weightDecay}
+        {
+        }
+
+        virtual ~Optimizer() = default;
+
+        virtual size_t Type() const = 0;
+
+        // number of state buffers per parameter tensor
+        virtual size_t StateNb() const = 0;
+
+        // allocate the state of the tensors of the given sizes, an existing state of the same sizes is kept so that
+        // the training can continue where it stopped
+        void Allocate(const std::vector<size_t>& sizes)
+        {
+            bool bSame = vState.size() == sizes.size() * StateNb();
+            for (size_t i = 0; bSame && i < vState.size(); ++i) bSame = vState[i].size() == sizes[i / StateNb()];
+            if (bSame) return;
+            vState.clear();
+            for (const size_t& n : sizes)
+                for (size_t j = 0; j < StateNb(); ++j) vState.push_back(std::vector<T>(n, T_C(0)));
+            nSteps = 0;
+        }
+
+        // called once per minibatch before the tensors are updated
+        virtual void Step() { ++nSteps; }
+
+        // p -= update(g) for the tensor i of n elements
+        virtual void Update(size_t i, T* p, const T* g, size_t n, T eta) = 0;
+
+        // hyperparameters {beta1, beta2, epsilon, weightDecay}, step count and state, for the serialization
+        inline const std::vector<double>& GetParams() const { return vParams; }
+
+        inline size_t& Steps() { return nSteps; }
+
+        inline std::vector<std::vector<T>>& State() { return vState; }
+
+      protected:
+        inline T* State(size_t i, size_t j) { return vState[i * StateNb() + j].data(); }
+
+        std::vector<double> vParams;
+        std::vector<std::vector<T>> vState{};
+        size_t nSteps{0};
+    };
+
+    //**********************
+    //  momentum, Nesterov
+    //**********************
+    // v = beta1 * v + g, p -= eta * v (or eta * (g + beta1 * v) with the Nesterov look-ahead)
+    template <typename T> class OptimizerMomentum : public Optimizer<T>
+    {
+        using Optimizer<T>::vParams;
+        using Optimizer<T>::State;
+
+      public:
+        OptimizerMomentum(double beta1, bool bNesterov) : Optimizer<T>(beta1, 0, 0, 0), bNesterov(bNesterov) {}
+
+        size_t Type() const override { return bNesterov ? NESTEROV : MOMENTUM; }
+
+        size_t StateNb() const override { return 1; }
+
+        void Update(size_t i, T* p, const T* g, size_t n, T eta) override
+        {
+            const T mu = T_C(vParams[0]);
+            T* v       = State(i, 0);
+            if (bNesterov)
+                for (size_t k = 0; k < n; ++k)
+                {
+                    v[k] = mu * v[k] + g[k];
+                    p[k] -= eta * (g[k] + mu * v[k]);
+                }
+            else
+                for (size_t k = 0; k < n; ++k)
+                {
+                    v[k] = mu * v[k] + g[k];
+                    p[k] -= eta * v[k];
+                }
+        }
+
+      private:
+        bool bNesterov;
+    };
+
+    //**********************
+    //      RMSProp
+    //**********************
+    // s = beta2 * s + (1 - beta2) * g^2, p -= eta * g / (sqrt(s) + epsilon)
+    template <typename T> class OptimizerRMSProp : public Optimizer<T>
+    {
+        using Optimizer<T>::vParams;
+        using Optimizer<T>::State;
+
+      public:
+        OptimizerRMSProp(double beta2, double epsilon) : Optimizer<T>(0, beta2, epsilon, 0) {}
+
+        size_t Type() const override { return RMSPROP; }
+
+        size_t StateNb() const override { return 1; }
+
+        void Update(size_t i, T* p, const T* g, size_t n, T eta) override
+        {
+            const T rho = T_C(vParams[1]), rho1 = T_C(1 - vParams[1]), eps = T_C(vParams[2]);
+            T* s        = State(i, 0);
+            for (size_t k = 0; k < n; ++k)
+            {
+                s[k] = rho * s[k] + rho1 * g[k] * g[k];
+                p[k] -= eta * g[k] / (std::sqrt(s[k]) + eps);
+            }
+        }
+    };
+
+    //**********************
+    //     Adam, AdamW
+    //**********************
+    // m = beta1 * m + (1 - beta1) * g, v = beta2 * v + (1 - beta2) * g^2 and p -= eta * m^ / (sqrt(v^) + epsilon)
+    // with the bias corrected moments m^ and v^. AdamW first decays the parameters by eta * weightDecay * p,
+    // decoupled from the gradient, the decay applies to the biases too.
+    template <typename T> class OptimizerAdam : public Optimizer<T>
+    {
+        using Optimizer<T>::vParams;
+        using Optimizer<T>::nSteps;
+        using Optimizer<T>::State;
+
+      public:
+        OptimizerAdam(double beta1, double beta2, double epsilon, double weightDecay = 0, bool bDecoupled = false)
+            : Optimizer<T>(beta1, beta2, epsilon, bDecoupled ? weightDecay : 0), bDecoupled(bDecoupled)
+        {
+        }
+
+        size_t Type() const override { return bDecoupled ? ADAMW : ADAM; }
+
+        size_t StateNb() const override { return 2; }
+
+        void Update(size_t i, T* p, const T* g, size_t n, T eta) override
+        {
+            const double t = static_cast<double>(nSteps);
+            // the bias corrections are folded in the step and in epsilon
+            const T b1 = T_C(vParams[0]), b11 = T_C(1 - vParams[0]), b2 = T_C(vParams[1]), b21 = T_C(1 - vParams[1]);
+            const double c2 = std::sqrt(1 - std::pow(vParams[1], t));
+            const T step    = T_C(static_cast<double>(eta) * c2 / (1 - std::pow(vParams[0], t)));
+            const T eps     = T_C(vParams[2] * c2);
+            const T decay   = T_C(1 - static_cast<double>(eta) * vParams[3]);
+            T *m = State(i, 0), *v = State(i, 1);
+            for (size_t k = 0; k < n; ++k)
+            {
+                m[k] = b1 * m[k] + b11 * g[k];
+                v[k] = b2 * v[k] + b21 * g[k] * g[k];
+                p[k] = decay * p[k] - step * m[k] / (std::sqrt(v[k]) + eps);
+            }
+        }
+
+      private:
+        bool bDecoupled;
+    };
+
+    // optimizer of the given OPT type, nullptr for SGD which is applied directly by the training.
+    // beta1 is the momentum of MOMENTUM and NESTEROV, beta2 the decay of the squared gradient of RMSPROP.
+    template <typename T>
+    inline std::unique_ptr<Optimizer<T>> MakeOptimizer(size_t type, double beta1 = 0.9, double beta2 = 0.999,
+                                                       double epsilon = 1e-8, double weightDecay = 0)
+    {
+        switch (type)
+        {
+        case SGD: return nullptr;
+        case MOMENTUM: return std::make_unique<OptimizerMomentum<T>>(beta1, false);
+        case NESTEROV: return std::make_unique<OptimizerMomentum<T>>(beta1, true);
+        case RMSPROP: return std::make_unique<OptimizerRMSProp<T>>(beta2, epsilon);
+        case ADAM: return std::make_unique<OptimizerAdam<T>>(beta1, beta2, epsilon);
+        case ADAMW: return std::make_unique<OptimizerAdam<T>>(beta1, beta2, epsilon, weightDecay, true);
+        default: throw std::invalid_argument("Unknown optimizer");
+        }
+    }
+
+#undef T_C
+
+} // namespace nn
+#endif
@@ -60,8 +60,8 @@ namespace la
         inline const std::vector<T>& data() const { return data_; }
 
         // Scalar Operations
-        template <typename S> inline Matrix operator *=( const S& rval ) { for(size_t i=0;i<size_;++i) data_[i]*=T_C(rval); return *this; }
-        template <typename S> inline Matrix operator /=( const S& rval ) { for(size_t i=0;i<size_;++i) data_[i]/=T_C(rval); return *this; }
+        template <typename S> inline Matrix& operator *=( const S& rval ) { for(size_t i=0;i<size_;++i) data_[i]*=T_C(rval); return *this; }
+        template <typename S> inline Matrix& operator /=( const S& rval ) { for(size_t i=0;i<size_;++i) data_[i]/=T_C(rval); return *this; }
 
         inline friend Matrix operator * (const Matrix& lval, const T& rval) { Matrix m_{lval.rows_, lval.cols_}; for(size_t i=0;i<m_.size_;++i) m_.data_[i]=lval.data_[i]*rval; return m_; }
         inline friend Matrix operator * (const T& lval, const Matrix& rval) { Matrix m_{rval.rows_, rval.cols_}; for(size_t i=0;i<m_.size_;++i) m_.data_[i]=rval.data_[i]*lval; return m_; }
@@ -70,11 +70,11 @@ namespace la
 
         // Matrix operations
         inline Matrix operator + (const Matrix &rval) const { assert(rval.size_==size_); Matrix m_{rows_,cols_}; for(size_t i=0;i<m_.size_;++i) m_.data_[i]=data_[i]+rval.data_[i]; return m_; }
-        inline Matrix operator +=(const Matrix &rval) { assert(rval.size_==size_); for(size_t i=0;i<size_;++i) data_[i]+=rval.data_[i]; return *this; }
-        template <typename S> inline Matrix operator +=(const std::vector<S> &rval) { assert(rval.size()==size_); for(size_t i=0; i<size_; ++i) data_[i]+=T_C(rval[i]); return *this; }
+        inline Matrix& operator +=(const Matrix &rval) { assert(rval.size_==size_); for(size_t i=0;i<size_;++i) data_[i]+=rval.data_[i]; return *this; }
+        template <typename S> inline Matrix& operator +=(const std::vector<S> &rval) { assert(rval.size()==size_); for(size_t i=0; i<size_; ++i) data_[i]+=T_C(rval[i]); return *this; }
         inline Matrix operator - (const Matrix &rval) const { assert(rval.size_==size_); Matrix m_{rows_,cols_}; for(size_t i=0;i<m_.size_;++i) m_.data_[i]=data_[i]-rval.data_[i]; return m_; }
-        inline Matrix operator -=(const Matrix &rval) { assert(rval.size_==size_); for(size_t i=0;i<size_;++i) data_[i]-=rval.data_[i]; return *this; }
-        template <typename S> inline Matrix operator -=(const std::vector<S> &rval)  { assert(rval.size()==size_); for(size_t i=0;i<size_;++i) data_[i]-=T_C(rval[i]); return *this; }
+        inline Matrix& operator -=(const Matrix &rval) { assert(rval.size_==size_); for(size_t i=0;i<size_;++i) data_[i]-=rval.data_[i]; return *this; }
+        template <typename S> inline Matrix& operator -=(const std::vector<S> &rval)  { assert(rval.size()==size_); for(size_t i=0;i<size_;++i) data_[i]-=T_C(rval[i]); return *this; }
 
         inline ColumnProxy       operator[](size_t i)                 { return ColumnProxy(data_, i, rows_); }
         inline const ColumnProxy operator[](size_t i)           const { return ColumnProxy(data_, i, rows_); }
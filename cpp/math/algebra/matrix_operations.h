@@ -221,6 +221,10 @@ namespace la
         return la::MatHadamard(res_, A, B);
     }
 
+#ifdef USE_BLAS
+    // defined in la_blas_mult.h
+    // template <typename T> Matrix<T>& MatOuter(Matrix<T>& res, const Matrix<T>& A, const Matrix<T>& B);
+#else
     template <typename T> inline Matrix<T>& MatOuter(Matrix<T>& res, const Matrix<T>& A, const Matrix<T>& B)
     {
         assert(res.GetRowsNb() == A.GetRowsNb());
@@ -237,7 +241,13 @@ namespace la
         Matrix<T> res_{A.GetRowsNb(), B.GetRowsNb()};
         return la::MatOuter(res_, A, B);
     }
+#endif
 
+#ifdef USE_BLAS
+    // defined in la_blas_mult.h
+    // template <typename T> T MatDot(const Matrix<T>& A, const Matrix<T>& B);
+    // template <typename T> T MatDot(const Matrix<std::complex<T>>& A, const Matrix<std::complex<T>>& B);
+#else
     template <typename T> inline T MatDot(const Matrix<T>& A, const Matrix<T>& B)
     {
         assert(A.GetColsNb() == 1);
@@ -257,6 +267,7 @@ namespace la
             for (size_t j = 0; j < A.GetColsNb(); ++j) res += std::conj(A(i, j)) * B(i, j);
         return res.real();
     }
+#endif
 
     template <typename T>
     Matrix<T>& MatRref(Matrix<T>& res, std::vector<size_t>& vRowsIdx, const size_t& nPivotMax = 0,
@@ -626,6 +637,10 @@ namespace la
         return MatRowsNb(res_, A, tol, false);
     }
 
+#ifdef USE_BLAS
+    // defined in la_blas_mult.h
+    // template <typename T> Matrix<T>& MatAtA(Matrix<T>& res, const Matrix<T>& A);
+#else
     // compute AT * A
     template <typename T> Matrix<T>& MatAtA(Matrix<T>& res, const Matrix<T>& A)
     {
@@ -640,6 +655,7 @@ namespace la
             }
         return res;
     }
+#endif
 
     template <typename T> Matrix<T> MatAtA(const Matrix<T>& A)
     {
@@ -27,3 +27,11 @@ void cfun1_(int* idim1)
     c2->print();
     std::cout << "***Inside C++ function after creating C++ temp object" << std::endl;
 }
+
+void cmat_scale(CFI_cdesc_t* A, double alpha)
+{
+    std::cout << "***Inside C++ function cmat_scale on the Fortran buffer" << std::endl;
+    la::FortranArrayView<double> a(A);
+    for (size_t j = 0; j < a.GetColsNb(); ++j)
+        for (size_t i = 0; i < a.GetRowsNb(); ++i) a(i, j) *= alpha;
+}
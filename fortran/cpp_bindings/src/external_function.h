@@ -12,10 +12,14 @@
 #endif
 
 #include <iostream>
+#include "la_fortran_array.h"
 #include "shared_libraries_export.hpp"
 
 extern "C" DLL_PUBLIC void cfun_(int* idim1);
 extern "C" DLL_PUBLIC void cfun1_(int* idim1);
+// A is a rank 2 REAL(8) array passed by descriptor (BIND(C) interface with an assumed-shape dummy), it is scaled in
+// place, array sections included
+extern "C" DLL_PUBLIC void cmat_scale(CFI_cdesc_t* A, double alpha);
 
 template <class T> class class_1
 {
@@ -6,7 +6,16 @@
 
 PROGRAM MAIN
 
+    INTERFACE
+        SUBROUTINE CMAT_SCALE(A, ALPHA) BIND(C, NAME='cmat_scale')
+            USE, INTRINSIC :: ISO_C_BINDING
+            REAL(C_DOUBLE), DIMENSION(:,:), INTENT(INOUT) :: A
+            REAL(C_DOUBLE), VALUE,          INTENT(IN)    :: ALPHA
+        END SUBROUTINE CMAT_SCALE
+    END INTERFACE
+
     INTEGER IDIM, IDIM1
+    REAL(8) M(3,2)
 
     IDIM = 35
     IDIM1= 45
@@ -15,6 +24,10 @@ PROGRAM MAIN
     CALL CFUN(IDIM)
     WRITE(6,*) 'Inside Fortran calling second C function'
     CALL CFUN1(IDIM1)
+    WRITE(6,*) 'Inside Fortran scaling rows 1 and 3 of M in C++'
+    M = RESHAPE([1D0, 2D0, 3D0, 4D0, 5D0, 6D0], [3, 2])
+    CALL CMAT_SCALE(M(1:3:2, :), 2D0)
+    WRITE(6,*) M
     WRITE(6,*) 'Exiting the Fortran program'
 
 END PROGRAM MAIN
@@ -0,0 +1,27 @@
+!/***********************/
+!/*   algebra_01_c.f90  */
+!/*    VERSION 1.0      */
+!/*    2026/10/19       */
+!/***********************/
+
+! C callable kernels of ALGEBRA_01, the arrays are received through C descriptors (ISO_Fortran_binding.h) so the
+! routines work in place on the caller's column major buffers
+MODULE ALGEBRA_01_C
+  USE, INTRINSIC :: ISO_C_BINDING
+  USE ALGEBRA_01
+  IMPLICIT NONE
+
+! PRIVATE ::
+PUBLIC  :: RREF_C
+
+CONTAINS
+    SUBROUTINE RREF_C(MATRIX, TOLERANCE) BIND(C, NAME='algebra_rref')
+        !DEC$ ATTRIBUTES DLLEXPORT :: RREF_C
+        REAL(C_DOUBLE), DIMENSION(:,:), INTENT(INOUT) :: MATRIX
+        REAL(C_DOUBLE), VALUE,          INTENT(IN)    :: TOLERANCE
+
+        IF (SIZE(MATRIX) == 0) RETURN
+        CALL RREF(MATRIX, TOLERANCE)
+    END SUBROUTINE RREF_C
+
+END MODULE ALGEBRA_01_C
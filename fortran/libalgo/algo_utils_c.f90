@@ -0,0 +1,32 @@
+!/************************/
+!/*  algo_utils_c.f90    */
+!/*    VERSION 1.0       */
+!/************************/
+
+! C callable kernels of ALGO_UTILS, the arrays are received through C descriptors (ISO_Fortran_binding.h) and sorted
+! in place in ascending order
+MODULE ALGO_UTILS_C
+    USE, INTRINSIC :: ISO_C_BINDING
+    USE ALGO_UTILS
+    IMPLICIT NONE
+
+! PRIVATE ::
+PUBLIC  :: QUICKSORT_I4_C, QUICKSORT_R8_C
+
+CONTAINS
+
+    SUBROUTINE QUICKSORT_I4_C(V) BIND(C, NAME='algo_quicksort_i4')
+        !DEC$ ATTRIBUTES DLLEXPORT :: QUICKSORT_I4_C
+        INTEGER(C_INT), DIMENSION(:), INTENT(INOUT) :: V
+
+        IF (SIZE(V) > 1) CALL QUICKSORT_I4(V, 1, SIZE(V))
+    END SUBROUTINE QUICKSORT_I4_C
+
+    SUBROUTINE QUICKSORT_R8_C(V) BIND(C, NAME='algo_quicksort_r8')
+        !DEC$ ATTRIBUTES DLLEXPORT :: QUICKSORT_R8_C
+        REAL(C_DOUBLE), DIMENSION(:), INTENT(INOUT) :: V
+
+        IF (SIZE(V) > 1) CALL QUICKSORT_R8(V, 1, SIZE(V))
+    END SUBROUTINE QUICKSORT_R8_C
+
+END MODULE ALGO_UTILS_C